@@ -18,32 +18,44 @@
 #define HALT 0x00
 #define STOP 0x80
 
+//The SWI number sits in bits 16-23 of an ARM svc and bits 0-7 of a Thumb one
+#ifdef __thumb__
+#define SWI(number) "svc " #number
+#else
+#define SWI(number) "svc " #number "0000"
+#endif
+
 static inline void RegisterRamReset(uint8_t flag)
 {
 	register int r0 asm("r0") = flag;
-	asm volatile("svc 0x010000" :: "r" (r0) : "r1", "r2", "r3");
+	asm volatile(SWI(0x01) :: "r" (r0) : "r1", "r2", "r3");
 }
 
 static inline void Halt(void)
 {
-	asm volatile("mov lr, pc; mov pc, #0x000001A0" ::: "r2", "ip", "lr");
+	asm volatile(SWI(0x02) ::: "r0", "r1", "r2", "r3");
 }
 
 static inline void Stop(void)
 {
-	asm volatile("mov lr, pc; mov pc, #0x000001A8" ::: "r2", "ip", "lr");
+	asm volatile(SWI(0x03) ::: "r0", "r1", "r2", "r3");
+}
+
+static inline void VBlankIntrWait(void)
+{
+	asm volatile(SWI(0x05) ::: "r0", "r1", "r2", "r3");
 }
 
 static inline void CustomHalt(uint8_t flag)
 {
 	register int r2 asm("r2") = flag;
-	asm volatile("mov lr, pc; mov pc, #0x000001AC" :: "r" (r2) : "ip", "lr");
+	asm volatile(SWI(0x27) :: "r" (r2) : "r0", "r1", "r3");
 }
 
 static inline void SoundBias(uint32_t bias)
 {
 	register int r0 asm("r0") = bias;
-	asm volatile("svc 0x190000" :: "r" (r0) : "r1", "r2", "r3");
+	asm volatile(SWI(0x19) :: "r" (r0) : "r1", "r2", "r3");
 }
 
 #endif /* GBA_BIOS_H */
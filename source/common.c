@@ -1,84 +1,139 @@
+#include <gba_dma.h>
+#include <gba_interrupt.h>
+
+#include "bios.h"
 #include "common.h"
-#include "main_screen.h"
+#include "input.h"
+#include "irq.h"
+#include "timers.h"
+#include "trace.h"
+#include "backgrounds.h"
 #include "cursor.h"
+#include "font_kana.h"
+#include "font_num.h"
 
-void wait_vblank()
-{
-	while(IO_H[3] != 0xA0) { }
-}
+//Map entries currently in each frame, SCREEN_DIRTY where something was drawn over the background
+#define SCREEN_DIRTY 0xFFFF
+#define SCREEN_TILE_BYTES (8 * 8 * sizeof(pixel))
+
+static u16 screen_shown[VIDEO_BUFFERS][SCREEN_TILES_W * SCREEN_TILES_H];
+struct screen_profile screen_profile;
+
+#ifdef VIDEO_MODE4
+#define VIDEO_FRAME_1 ((vu16*)0x0600A000)
+#define BG_PALETTE_H ((vu16*)0x05000000)
+
+vu16* video_target = VRAM_H;
+
+static struct {
+	u8 front;
+	u8 target;
+	bool flip;
+	const u16* palette;
+} video;
+#define SCREEN_SHOWN screen_shown[video.target]
+#else
+#define SCREEN_SHOWN screen_shown[0]
+#endif
+
+static void screen_dirty(u32 sx, u32 sy, u32 w, u32 h);
 
-void wait_frames(u32 frames)
+//Sleeps in Stop until any key is pressed. VRAM, the palette and IWRAM keep their contents, so the screen is back as soon as the LCD is
+void sleep_until_key()
 {
-	while(IO_H[3] != 0xA0) { }
+	u16 dispcnt = IO_H[0];
+	u16 ie = irq_suspend();
 
-	u32 counter = 0;
+	//The LCD and sound have to be off before Stop, the clocks they run on are stopped
+	IO_H[0] = dispcnt | 0x80;
+	SoundBias(0);
 
-	while(counter != frames)
-	{
-		while(IO_H[3] != 0x00) { }
-		while(IO_H[3] != 0xA0) { }
-		counter++;
-	}
+	//Any key raises the keypad IRQ, which is the only source left that wakes the CPU
+	IO_H[153] = 0x4000 | 0x3FF;
+	REG_IE = IRQ_KEYPAD;
+	REG_IF = REG_IF;
+
+	Stop();
+
+	IO_H[153] = 0;
+	irq_resume(ie);
+	IO_H[0] = dispcnt;
+
+	//The key that woke it is not a press for whatever is on screen
+	input.held = ~IO_H[152] & 0x3FF;
 }
 
 void setup()
 {
+	//A soft reset or the multiboot loader can leave IO set up, so start from the power on state.
+	//RAM is kept: crt0 has already filled .data and .bss, and every screen is drawn in full anyway
+	RegisterRamReset(RESET_SIO_REG | RESET_SOUND_REG | RESET_REG);
+
 	//Disable IRQs
 	IO_H[256] = 0x00;
 	IO_H[257] = 0xFFFF;
 	IO_H[260] = 0x00;
+
+	//ROM at 3/1 wait states with the prefetch buffer on, SRAM stays at 4
+	IO_H[258] = 0x4014;
 	
 	//Force blank
 	IO_H[0] = 0x80;
 
-	//Draw main screen
-	draw_bitmap(main_screen, main_screen_size, 0, 0, 240);
-
-	//Draw cursor
-	draw_bitmap_cc(cursor, cursor_size, 90, 75, 16, 0x7FFF);
-
-	//Enable BG2 in Mode 3
-	IO_H[0] = 0x403;
-
-	fade_in(4);
+#ifndef BOOT_NO_FADE
+	//Start from black, the first screen fades in once drawn
+	IO_H[40] = 0x4C4;
+	IO_H[42] = 16;
+#endif
 }
 
-void fade_in(u32 frames)
+//Start drawing the next screen; in Mode 4 that is the hidden frame, shown with its palette by video_present()
+void video_compose(const u16* palette)
 {
-	//Fade in gradually (from black)
-	u8 fade_val = 16;
-	IO_H[40] = 0x4C4;
+#ifdef VIDEO_MODE4
+	video.target = video.front ^ 1;
+	video.palette = palette;
+	video_target = video.target ? VIDEO_FRAME_1 : VRAM_H;
+#endif
+}
 
-	while(fade_val != 0)
-	{
-		IO_H[42] = fade_val;
-		wait_frames(frames);
-		fade_val--;
-	}
+void video_present()
+{
+#ifdef VIDEO_MODE4
+	if(video.target != video.front) { video.flip = true; }
+#else
+	IO_H[0] = VIDEO_DISPCNT;
+#endif
 }
 
-void fade_out(u32 frames)
+//Called at the start of VBlank, flips to a composed frame so it is never seen half drawn
+void video_flip()
 {
-	//Fade out gradually (to black)
-	u8 fade_val = 0;
-	IO_H[40] = 0x4C4;
+#ifdef VIDEO_MODE4
+	if(!video.flip) { return; }
 
-	while(fade_val != 16)
+	if(video.palette)
 	{
-		IO_H[42] = fade_val;
-		wait_frames(frames);
-		fade_val++;
+		for(u32 x = 0; x < 256; x++) { BG_PALETTE_H[x] = video.palette[x]; }
 	}
+
+	//Small updates go straight to the frame on screen until the next compose
+	video.front = video.target;
+	video.flip = false;
+	IO_H[0] = VIDEO_DISPCNT | (video.front ? 0x10 : 0);
+#endif
 }
 
-void draw_bitmap(const unsigned char* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw)
+void draw_bitmap(const u16* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw)
 {
+	TRACE_BEGIN(TRACE_DRAW_BITMAP, bmp_size >> 1);
+
 	u32 origin = (sy * 240) + sx;
 	u32 buffer_pos = 0;
 	u32 width_counter = 0;
 	u32 final_offset = 0;
 
-	for(u32 x = 0; x < bmp_size;)
+	for(u32 x = 0; x < (bmp_size >> 1); x++)
 	{
 		if(width_counter == sw)
 		{
@@ -87,28 +142,32 @@ void draw_bitmap(const unsigned char* bmp_src, const int bmp_size, u32 sx, u32 s
 			final_offset += 240;
 		}
 
-		u16 val = (bmp_src[x + 1] << 8) | (bmp_src[x]);
+		u16 val = bmp_src[x];
 		buffer_pos = origin + final_offset;
 
 		if(buffer_pos < 0x9600)
 		{
-			VRAM_H[buffer_pos] = val;
+			plot(buffer_pos, to_pixel(val));
 		}
 
 		final_offset++;
 		width_counter++;
-		x += 2;
 	}
+
+	screen_dirty(sx, sy, sw, (bmp_size >> 1) / sw);
+	TRACE_END(TRACE_DRAW_BITMAP, bmp_size >> 1);
 }
 
-void draw_bitmap_cc(const unsigned char* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw, u16 clear_color)
+void draw_bitmap_cc(const u16* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw, u16 clear_color)
 {
+	TRACE_BEGIN(TRACE_DRAW_BITMAP, bmp_size >> 1);
+
 	u32 origin = (sy * 240) + sx;
 	u32 buffer_pos = 0;
 	u32 width_counter = 0;
 	u32 final_offset = 0;
 
-	for(u32 x = 0; x < bmp_size;)
+	for(u32 x = 0; x < (bmp_size >> 1); x++)
 	{
 		if(width_counter == sw)
 		{
@@ -117,102 +176,255 @@ void draw_bitmap_cc(const unsigned char* bmp_src, const int bmp_size, u32 sx, u3
 			final_offset += 240;
 		}
 
-		u16 val = (bmp_src[x + 1] << 8) | (bmp_src[x]);
+		u16 val = bmp_src[x];
 		buffer_pos = origin + final_offset;
 
 		if((buffer_pos < 0x9600) && (val != clear_color))
 		{
-			VRAM_H[buffer_pos] = val;
+			plot(buffer_pos, to_pixel(val));
 		}
 
 		final_offset++;
 		width_counter++;
-		x += 2;
 	}
+
+	screen_dirty(sx, sy, sw, (bmp_size >> 1) / sw);
+	TRACE_END(TRACE_DRAW_BITMAP, bmp_size >> 1);
 }
 
-void draw_font_cc(const unsigned char* bmp_src, u8 index, u32 sx, u32 sy, u16 clear_color)
+void draw_font_cc(const u16* bmp_src, u8 index, u32 sx, u32 sy, u16 clear_color)
 {
-	u8 font_data[512];
+	TRACE_BEGIN(TRACE_DRAW_FONT, index);
+
+	//Fonts are 320 pixel wide strips of 20 16x16 glyphs per row
+	u16 font_data[256];
 	u8 width_count = 0;
-	u32 buffer_pos = ((index / 20) * 0x2800) + ((index % 20) * 32);
+	u32 buffer_pos = ((index / 20) * (320 * 16)) + ((index % 20) * 16);
 
-	for(u32 x = 0; x < 512; x++)
+	for(u32 x = 0; x < 256; x++)
 	{
 		font_data[x] = bmp_src[buffer_pos++];
 		width_count++;
 
-		if(width_count == 32)
+		if(width_count == 16)
 		{
 			width_count = 0;
-			buffer_pos -= 32;
-			buffer_pos += 640;
+			buffer_pos -= 16;
+			buffer_pos += 320;
 		}
 	}
 
-	draw_bitmap_cc(font_data, 512, sx, sy, 16, clear_color);
+	draw_bitmap_cc(font_data, sizeof(font_data), sx, sy, 16, clear_color);
+	TRACE_END(TRACE_DRAW_FONT, index);
+}
+
+void draw_kana(u8 index, u32 sx, u32 sy)
+{
+	TRACE_BEGIN(TRACE_DRAW_KANA, index);
+
+	//Indices without a glyph show as the blank
+	u8 slot = font_kana_map[index];
+	const u16* glyph = font_kana_glyphs[(slot == FONT_KANA_NONE) ? font_kana_map[0] : slot];
+	u32 buffer_pos = (sy * 240) + sx;
+
+	for(u32 y = 0; y < 16; y++)
+	{
+		u16 bits = glyph[y];
+
+		for(u32 x = 0; bits; x++, bits <<= 1)
+		{
+			if(bits & 0x8000) { plot(buffer_pos + x, PIXEL_BLACK); }
+		}
+
+		buffer_pos += 240;
+	}
+
+	screen_dirty(sx, sy, 16, 16);
+	TRACE_END(TRACE_DRAW_KANA, index);
+}
+
+//Next index in the given direction that has a glyph, wrapping around the byte
+u8 kana_step(u8 index, s32 direction)
+{
+	do { index += direction; } while(font_kana_map[index] == FONT_KANA_NONE);
+	return index;
+}
+
+void draw_number(const u16* bg_src, u32 value, u32 last, u8 digits, u32 sx, u32 sy, bool all)
+{
+	TRACE_BEGIN(TRACE_DRAW_NUMBER, value);
+
+	//Digits are 18 pixels apart, walk them from least significant (rightmost)
+	u32 x = sx + ((digits - 1) * 18);
+
+	for(u8 d = 0; d < digits; d++)
+	{
+		if(all || ((value % 10) != (last % 10)))
+		{
+			clear_char(bg_src, x, sy);
+			draw_font_cc(font_num, (value % 10), x, sy, 0x7FFF);
+		}
+
+		value /= 10;
+		last /= 10;
+		x -= 18;
+	}
+
+	TRACE_END(TRACE_DRAW_NUMBER, digits);
 }
 
 void clear_bitmap()
 {
-	for(u32 x = 0; x < 0x9600; x++) { VRAM_H[x] = 0; }
+	for(u32 x = 0; x < VIDEO_FRAME_HALFWORDS; x++) { video_target[x] = 0; }
 }
 
-void clear_highlight(const unsigned char* bmp_src, u32 sx, u32 sy)
+pixel screen_pixel(const u16* bg_map, u32 x, u32 y)
 {
-	u8 width_count = 0;
-	u16 val = 0;
-	u32 buffer_pos = ((sy * 240) + sx);
-	u32 src_pos = 0;
-	u32 y_pos = 0;
+	u16 entry = bg_map[((y >> 3) * SCREEN_TILES_W) + (x >> 3)];
+	u32 tx = (entry & TILE_HFLIP) ? (7 - (x & 7)) : (x & 7);
+	u32 ty = (entry & TILE_VFLIP) ? (7 - (y & 7)) : (y & 7);
+
+	return backgrounds_tiles[entry & TILE_INDEX_MASK][(ty * 8) + tx];
+}
 
-	for(u32 x = 0; x < 648;)
+static void draw_tile(u16 entry, u32 tx, u32 ty)
+{
+	const pixel* tile = backgrounds_tiles[entry & TILE_INDEX_MASK];
+	u32 buffer_pos = (ty * 8 * 240) + (tx * 8);
+
+	for(u32 y = 0; y < 8; y++)
 	{
+		const pixel* row = tile + (((entry & TILE_VFLIP) ? (7 - y) : y) * 8);
 
-		src_pos = (buffer_pos << 1);
-		val = (bmp_src[src_pos + 1] << 8) | (bmp_src[src_pos]);
+		//Unflipped rows are word aligned at both ends, so DMA copies them far faster than a Thumb loop reading ROM
 
-		if((width_count == 0) || (width_count == 17) || (y_pos == 0) || (y_pos == 17)) { VRAM_H[buffer_pos] = val; }
+#ifdef VIDEO_MODE4
+		//Tiles start on even pixels, so each pair of indices is one halfword
+		vu16* dst = &video_target[buffer_pos >> 1];
+		if(entry & TILE_HFLIP) { for(u32 x = 0; x < 4; x++) { dst[x] = row[7 - (x * 2)] | (row[6 - (x * 2)] << 8); } }
+		else { DMA3COPY(row, dst, DMA32 | 2); }
+#else
+		if(entry & TILE_HFLIP) { for(u32 x = 0; x < 8; x++) { video_target[buffer_pos + x] = row[7 - x]; } }
+		else { DMA3COPY(row, &video_target[buffer_pos], DMA32 | 4); }
+#endif
 
-		width_count++;
-		buffer_pos++;
+		buffer_pos += 240;
+	}
+}
+
+static void screen_dirty(u32 sx, u32 sy, u32 w, u32 h)
+{
+	if(!w || !h || (sx >= 240) || (sy >= 160)) { return; }
+
+	u32 last_x = (sx + w - 1) >> 3;
+	u32 last_y = (sy + h - 1) >> 3;
+	if(last_x >= SCREEN_TILES_W) { last_x = SCREEN_TILES_W - 1; }
+	if(last_y >= SCREEN_TILES_H) { last_y = SCREEN_TILES_H - 1; }
 
-		if(width_count == 18)
+	for(u32 ty = (sy >> 3); ty <= last_y; ty++)
+	{
+		for(u32 tx = (sx >> 3); tx <= last_x; tx++) { SCREEN_SHOWN[(ty * SCREEN_TILES_W) + tx] = SCREEN_DIRTY; }
+	}
+}
+
+void draw_screen(const u16* bg_map)
+{
+	u32 cycles = 0;
+	u32 pos = 0;
+
+	TRACE_BEGIN(TRACE_DRAW_SCREEN, 0);
+
+	for(u32 ty = 0; ty < SCREEN_TILES_H; ty++)
+	{
+		u16 start = TIMER_CNT_L(PROFILE_TIMER);
+
+		for(u32 tx = 0; tx < SCREEN_TILES_W; tx++, pos++)
 		{
-			width_count = 0;
-			buffer_pos -= 18;
-			buffer_pos += 240;
-			y_pos++;
+			draw_tile(bg_map[pos], tx, ty);
+			SCREEN_SHOWN[pos] = bg_map[pos];
 		}
 
-		x += 2;
+		cycles += (u16)(TIMER_CNT_L(PROFILE_TIMER) - start);
 	}
+
+	screen_profile.full_cycles = cycles;
+	screen_profile.full_bytes = SCREEN_TILES_W * SCREEN_TILES_H * SCREEN_TILE_BYTES;
+
+	TRACE_END(TRACE_DRAW_SCREEN, SCREEN_TILES_W * SCREEN_TILES_H);
 }
 
-void clear_char(const unsigned char* bmp_src, u32 sx, u32 sy)
+//Only redraws tiles whose entry differs from what is shown, or that something was drawn over
+void draw_screen_changes(const u16* bg_map)
 {
-	u8 width_count = 0;
-	u16 val = 0;
-	u32 buffer_pos = ((sy * 240) + sx);
-	u32 src_pos = 0;
+	u32 cycles = 0;
+	u32 bytes = 0;
+	u32 pos = 0;
+
+	TRACE_BEGIN(TRACE_DRAW_CHANGES, 0);
 
-	for(u32 x = 0; x < 512;)
+	for(u32 ty = 0; ty < SCREEN_TILES_H; ty++)
 	{
-		src_pos = (buffer_pos << 1);
-		val = (bmp_src[src_pos + 1] << 8) | (bmp_src[src_pos]);
-		VRAM_H[buffer_pos++] = val;
-		width_count++;
+		u16 start = TIMER_CNT_L(PROFILE_TIMER);
 
-		if(width_count == 16)
+		for(u32 tx = 0; tx < SCREEN_TILES_W; tx++, pos++)
 		{
-			width_count = 0;
-			buffer_pos -= 16;
-			buffer_pos += 240;
+			if(bg_map[pos] == SCREEN_SHOWN[pos]) { continue; }
+
+			draw_tile(bg_map[pos], tx, ty);
+			SCREEN_SHOWN[pos] = bg_map[pos];
+			bytes += SCREEN_TILE_BYTES;
+		}
+
+		cycles += (u16)(TIMER_CNT_L(PROFILE_TIMER) - start);
+	}
+
+	screen_profile.changes_cycles = cycles;
+	screen_profile.changes_bytes = bytes;
+
+	//Ends with the number of tiles redrawn
+	TRACE_END(TRACE_DRAW_CHANGES, bytes / SCREEN_TILE_BYTES);
+}
+
+//Expands a delta screen into a full map: the base, then each rectangle row by row from the patch
+void build_screen(u16* bg_map, const struct screen_delta* delta)
+{
+	const u16* patch = delta->patch;
+
+	for(u32 x = 0; x < (SCREEN_TILES_W * SCREEN_TILES_H); x++) { bg_map[x] = delta->base[x]; }
+
+	for(u32 r = 0; r < delta->count; r++)
+	{
+		const u8* rect = delta->rects[r];
+
+		for(u32 y = rect[1]; y < (u32)(rect[1] + rect[3]); y++)
+		{
+			for(u32 x = rect[0]; x < (u32)(rect[0] + rect[2]); x++) { bg_map[(y * SCREEN_TILES_W) + x] = *patch++; }
+		}
+	}
+}
+
+void clear_highlight(const u16* bg_map, u32 sx, u32 sy)
+{
+	//Only the 1 pixel border of the 18x18 highlight needs restoring
+	for(u32 y = 0; y < 18; y++)
+	{
+		for(u32 x = 0; x < 18; x++)
+		{
+			if((x == 0) || (x == 17) || (y == 0) || (y == 17)) { plot(((sy + y) * 240) + sx + x, screen_pixel(bg_map, sx + x, sy + y)); }
 		}
+	}
+}
 
-		x += 2;
+void clear_rect(const u16* bg_map, u32 sx, u32 sy, u32 w, u32 h)
+{
+	for(u32 y = sy; y < (sy + h); y++)
+	{
+		u32 buffer_pos = (y * 240) + sx;
+		for(u32 x = sx; x < (sx + w); x++) { plot(buffer_pos++, screen_pixel(bg_map, x, y)); }
 	}
 }
 
-		
-		
\ No newline at end of file
+void clear_char(const u16* bg_map, u32 sx, u32 sy)
+{
+	clear_rect(bg_map, sx, sy, 16, 16);
+}
@@ -6,14 +6,102 @@
 
 #define VRAM_H ((vu16*)0x06000000)
 
-void wait_vblank();
-void wait_frames(u32 frames);
+//Display backend, VIDEO=mode4 in the Makefile selects Mode 4 (and builds the matching backgrounds)
+#ifdef VIDEO_MODE4
+//8bpp palette indices, two frames: screens are composed in the hidden one and flipped in VBlank
+typedef u8 pixel;
+#define VIDEO_BUFFERS 2
+#define VIDEO_DISPCNT 0x404
+#define VIDEO_FRAME_HALFWORDS (240 * 160 / 2)
+
+//Every screen palette starts with the two colours the overlays use
+#define PIXEL_BLACK 0
+#define PIXEL_WHITE 1
+
+extern vu16* video_target;
+#else
+//BGR555 straight into the single Mode 3 frame
+typedef u16 pixel;
+#define VIDEO_BUFFERS 1
+#define VIDEO_DISPCNT 0x403
+#define VIDEO_FRAME_HALFWORDS (240 * 160)
+
+#define PIXEL_BLACK 0x0000
+#define PIXEL_WHITE 0x7FFF
+
+#define video_target VRAM_H
+#endif
+
+//Full screen backgrounds are tiled, see backgrounds.h
+#define SCREEN_TILES_W (240 / 8)
+#define SCREEN_TILES_H (160 / 8)
+
+//A screen stored as the tile rectangles where it differs from a base screen, see bmp2gba -d
+struct screen_delta
+{
+	const u16* base;
+	const u8 (*rects)[4];
+	const u16* patch;
+	u32 count;
+};
+
+//Cost of the last full and the last partial screen draw, cycles summed one tile row at a time
+struct screen_profile
+{
+	u32 full_cycles;
+	u32 full_bytes;
+	u32 changes_cycles;
+	u32 changes_bytes;
+};
+
+extern struct screen_profile screen_profile;
+
+static inline void plot(u32 pos, pixel value)
+{
+#ifdef VIDEO_MODE4
+	//VRAM ignores byte writes in bitmap modes, so merge into the halfword holding the pixel
+	vu16* pair = &video_target[pos >> 1];
+	*pair = (pos & 1) ? ((*pair & 0x00FF) | (value << 8)) : ((*pair & 0xFF00) | value);
+#else
+	video_target[pos] = value;
+#endif
+}
+
+static inline pixel peek(u32 pos)
+{
+#ifdef VIDEO_MODE4
+	return (pos & 1) ? (video_target[pos >> 1] >> 8) : (video_target[pos >> 1] & 0xFF);
+#else
+	return video_target[pos];
+#endif
+}
+
+//Overlay bitmaps stay BGR555 in both modes; they only use black and white
+static inline pixel to_pixel(u16 color)
+{
+#ifdef VIDEO_MODE4
+	return (color == 0x7FFF) ? PIXEL_WHITE : PIXEL_BLACK;
+#else
+	return color;
+#endif
+}
+
 void setup();
-void fade_in(u32 frames);
-void fade_out(u32 frames);
-void draw_bitmap(const unsigned char* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw);
-void draw_bitmap_cc(const unsigned char* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw, u16 clear_color);
-void draw_font_cc(const unsigned char* bmp_src, u8 index, u32 sx, u32 sy, u16 clear_color);
+void sleep_until_key();
+void draw_bitmap(const u16* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw);
+void draw_bitmap_cc(const u16* bmp_src, const int bmp_size, u32 sx, u32 sy, u32 sw, u16 clear_color);
+void draw_font_cc(const u16* bmp_src, u8 index, u32 sx, u32 sy, u16 clear_color);
+void draw_kana(u8 index, u32 sx, u32 sy);
+u8 kana_step(u8 index, s32 direction);
+void draw_number(const u16* bg_src, u32 value, u32 last, u8 digits, u32 sx, u32 sy, bool all);
 void clear_bitmap();
-void clear_highlight();
-void clear_char();
+void video_compose(const u16* palette);
+void video_present();
+void video_flip();
+pixel screen_pixel(const u16* bg_map, u32 x, u32 y);
+void draw_screen(const u16* bg_map);
+void draw_screen_changes(const u16* bg_map);
+void build_screen(u16* bg_map, const struct screen_delta* delta);
+void clear_highlight(const u16* bg_map, u32 sx, u32 sy);
+void clear_char(const u16* bg_map, u32 sx, u32 sy);
+void clear_rect(const u16* bg_map, u32 sx, u32 sy, u32 w, u32 h);
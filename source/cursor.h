@@ -1,14 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-//---------------------------------------------------------------------------------
-#ifndef _cursor_h_
-#define _cursor_h_
-//---------------------------------------------------------------------------------
-extern const unsigned char cursor[];
-extern const int cursor_size;
-//---------------------------------------------------------------------------------
-#endif //_cursor_h_
-//---------------------------------------------------------------------------------
@@ -1,4809 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-const unsigned char edit_screen_1[] = {
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xd9, 0x52, 
-	0xd9, 0x52, 0xd8, 0x52, 0xd8, 0x52, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 
-	0xb7, 0x4e, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xd9, 0x52, 
-	0xd9, 0x52, 0xd8, 0x52, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 
-	0xb7, 0x4e, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 
-	0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0xfb, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 
-	0xd9, 0x52, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 
-	0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x5b, 0x1b, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x4e, 
-	0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0x97, 0x4a, 0x96, 0x4a, 
-	0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x76, 0x46, 0x76, 0x46, 0x75, 0x46, 0x75, 0x46, 0x75, 0x46, 
-	0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x3b, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 0x3c, 0x57, 0x3c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 
-	0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 
-	0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 
-	0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x53, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0x1b, 0x53, 0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 
-	0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4e, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 
-	0x76, 0x46, 0x75, 0x46, 0x75, 0x46, 0x75, 0x46, 0x75, 0x46, 0x75, 0x42, 0x75, 0x42, 0x75, 0x42, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x57, 0x3c, 0x57, 0x3c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0x1a, 0x53, 0x1a, 0x53, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 
-	0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 
-	0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 
-	0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 
-	0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfb, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 
-	0xb7, 0x4e, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x76, 0x46, 0x75, 0x46, 
-	0x75, 0x46, 0x75, 0x42, 0x55, 0x42, 0x55, 0x42, 0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x57, 0x3c, 0x57, 0x3c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 0xfa, 0x56, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 0x76, 0x46, 0x76, 0x46, 0x75, 0x46, 0x75, 0x42, 0x55, 0x42, 
-	0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x54, 0x3e, 0x54, 0x3e, 0x54, 0x3e, 0x54, 0x3e, 0x54, 0x3e, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 
-	0x3c, 0x57, 0x1c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 
-	0x96, 0x4a, 0x96, 0x46, 0x76, 0x46, 0x76, 0x46, 0x75, 0x42, 0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x34, 0x3e, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 0x3c, 0x57, 0x1c, 0x57, 
-	0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 
-	0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x52, 0xd9, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 
-	0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 
-	0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x52, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x52, 0xd9, 0x52, 
-	0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xfa, 0x4e, 0xfa, 0x4e, 0xfa, 0x4e, 0xfa, 0x4e, 0xfa, 0x4e, 
-	0xfa, 0x4e, 0xfa, 0x4e, 0xf9, 0x4e, 0xf9, 0x4e, 0xf9, 0x4e, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 
-	0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 
-	0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 
-	0x96, 0x46, 0x76, 0x46, 0x75, 0x42, 0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x34, 0x3e, 
-	0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 0x3c, 0x57, 0x3c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x75, 0x42, 0x55, 0x42, 0x55, 0x3e, 0x35, 0x3e, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 0x3c, 0x57, 0x1c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 
-	0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 
-	0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 
-	0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 
-	0xb9, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x96, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x14, 0x36, 
-	0x14, 0x36, 0x14, 0x36, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x13, 0x32, 0x14, 0x32, 0x13, 0x32, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x5b, 0x3c, 0x57, 0x3c, 0x57, 0x1c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 
-	0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 
-	0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 
-	0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb9, 0x4e, 
-	0xb9, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 
-	0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x55, 0x42, 
-	0x55, 0x3e, 0x55, 0x3e, 0x34, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x13, 0x32, 
-	0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0xf3, 0x2d, 0xf3, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 
-	0x3c, 0x57, 0x1c, 0x57, 0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0x1b, 0x53, 0xfb, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 
-	0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 
-	0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 
-	0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x98, 0x4a, 0x98, 0x4a, 
-	0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 
-	0x96, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x34, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x31, 0xf3, 0x31, 
-	0xf3, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 
-	0x1c, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0xfb, 0x52, 0xfb, 0x52, 0xfa, 0x52, 
-	0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x4a, 
-	0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 
-	0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 
-	0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 
-	0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x96, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3a, 
-	0x34, 0x3a, 0x34, 0x36, 0x14, 0x36, 0x13, 0x36, 0x13, 0x32, 0xf3, 0x31, 0xf3, 0x31, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x57, 0x1c, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 
-	0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 
-	0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x36, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x46, 0x97, 0x46, 
-	0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3a, 0x35, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 
-	0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0x1b, 0x53, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3a, 0x35, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x14, 0x36, 0x14, 0x32, 
-	0x13, 0x32, 0x13, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x57, 0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x98, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x35, 0x3a, 0x35, 0x3a, 0x34, 0x36, 0x14, 0x36, 0x14, 0x32, 0x14, 0x32, 0x13, 0x32, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0x1b, 0x53, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 
-	0xd9, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3a, 0x34, 0x36, 0x14, 0x36, 0x14, 0x32, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 
-	0xb9, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x56, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xd9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xd9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xa6, 0x10, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0xf4, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x21, 0x00, 0x85, 0x0c, 0x55, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0xf4, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x4d, 0x25, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x8e, 0x29, 
-	0xc7, 0x14, 0x63, 0x08, 0xe8, 0x18, 0xd0, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xa6, 0x10, 
-	0x00, 0x00, 0x13, 0x3a, 0x6d, 0x29, 0x64, 0x0c, 0xc8, 0x14, 0xf2, 0x35, 0x55, 0x3e, 0x4c, 0x21, 
-	0x64, 0x08, 0x09, 0x19, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xd0, 0x2d, 0xe8, 0x18, 
-	0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0xf4, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x13, 0x3a, 0x42, 0x04, 0x64, 0x08, 0x35, 0x3e, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 
-	0x2b, 0x21, 0xd0, 0x2d, 0xa6, 0x10, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0xc7, 0x14, 
-	0x00, 0x00, 0x2b, 0x21, 0x2b, 0x1d, 0xc7, 0x14, 0x00, 0x00, 0x85, 0x0c, 0x4c, 0x25, 0x2b, 0x21, 
-	0xc7, 0x14, 0x00, 0x00, 0xe8, 0x18, 0x56, 0x42, 0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0x09, 0x19, 
-	0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0xf4, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3e, 0x8e, 0x29, 0x00, 0x00, 0x8e, 0x29, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x55, 0x3e, 0xaf, 0x2d, 0x8e, 0x29, 
-	0x34, 0x3e, 0x56, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x4c, 0x21, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0x4c, 0x21, 0x56, 0x42, 0x34, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 
-	0x34, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x3e, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x34, 0x3a, 
-	0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 0x43, 0x08, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0xf4, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0xfa, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3e, 0x34, 0x3e, 0x63, 0x08, 0x43, 0x08, 
-	0x34, 0x3e, 0x8f, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x09, 0x19, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x85, 0x0c, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x56, 0x42, 0x43, 0x08, 0x00, 0x00, 0x13, 0x3a, 0x12, 0x36, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 
-	0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0xfb, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3e, 0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 
-	0x6e, 0x29, 0xaf, 0x2d, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0xf2, 0x35, 0x0a, 0x1d, 
-	0x64, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x19, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 
-	0x56, 0x42, 0x85, 0x0c, 0x00, 0x00, 0x13, 0x3a, 0xf2, 0x35, 0x00, 0x00, 0x21, 0x00, 0xe8, 0x18, 
-	0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0xfb, 0x52, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x96, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3e, 0x56, 0x42, 0x35, 0x3e, 0x84, 0x0c, 
-	0x21, 0x00, 0x6d, 0x29, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x13, 0x3a, 0x00, 0x00, 0x63, 0x08, 
-	0xf1, 0x31, 0x13, 0x3a, 0xaf, 0x2d, 0x00, 0x00, 0x09, 0x19, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 
-	0x56, 0x42, 0x85, 0x0c, 0x00, 0x00, 0x13, 0x3a, 0x12, 0x36, 0x00, 0x00, 0x22, 0x04, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x29, 0xb1, 0x2d, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 
-	0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x0a, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x4c, 0x25, 0x00, 0x00, 0xe9, 0x18, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 
-	0x56, 0x42, 0x85, 0x0c, 0x00, 0x00, 0x13, 0x3a, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x13, 0x3a, 
-	0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0xe9, 0x18, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x85, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x00, 0x00, 
-	0x8e, 0x29, 0x2b, 0x21, 0x2b, 0x21, 0x00, 0x00, 0x42, 0x04, 0xd0, 0x31, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 
-	0x56, 0x42, 0x85, 0x0c, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0xc7, 0x10, 
-	0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 0x8f, 0x29, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xd3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xb1, 0x2d, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xd0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x8f, 0x29, 0xa6, 0x10, 
-	0x84, 0x0c, 0x6d, 0x25, 0x55, 0x3e, 0xaf, 0x2d, 0xa6, 0x10, 0xe9, 0x18, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 
-	0x56, 0x42, 0x85, 0x0c, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0xb0, 0x2d, 0xe8, 0x14, 
-	0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0xf4, 0x31, 0xf3, 0x31, 0xd3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xb2, 0x2d, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xd3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xd3, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xd3, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xb2, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xd3, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd2, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x46, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x2b, 0x21, 0x00, 0x00, 0x00, 0x00, 
-	0x12, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4a, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x35, 0x3e, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x6d, 0x25, 0x22, 0x04, 
-	0x85, 0x0c, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x2b, 0x21, 0x00, 0x00, 0xf2, 0x35, 0x2b, 0x21, 
-	0x00, 0x00, 0x12, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x6d, 0x25, 
-	0x64, 0x0c, 0xa6, 0x10, 0xaf, 0x2d, 0xd1, 0x31, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0xd0, 0x2d, 0xe8, 0x18, 0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x35, 0x3e, 0x21, 0x00, 0x64, 0x08, 0x55, 0x3e, 0xd1, 0x31, 
-	0x00, 0x00, 0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 
-	0x85, 0x0c, 0x8e, 0x29, 0x0a, 0x1d, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0x8f, 0x29, 0x00, 0x00, 0x09, 0x19, 0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x34, 0x3e, 
-	0x00, 0x00, 0x85, 0x0c, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 
-	0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x55, 0x3e, 
-	0x22, 0x04, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 0x43, 0x08, 0x55, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x2b, 0x21, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 
-	0x0a, 0x1d, 0x00, 0x00, 0x12, 0x36, 0x56, 0x42, 0x56, 0x42, 0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 
-	0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x12, 0x36, 
-	0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x3a, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x55, 0x3e, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x43, 0x08, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0xf2, 0x35, 
-	0x00, 0x00, 0x21, 0x00, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0x13, 0x36, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xd1, 0x31, 0x00, 0x00, 0xa7, 0x10, 0x2b, 0x21, 0x4b, 0x21, 0x4b, 0x21, 
-	0x2b, 0x21, 0x00, 0x00, 0x85, 0x0c, 0x55, 0x3e, 0x56, 0x42, 0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 
-	0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x12, 0x36, 
-	0x00, 0x00, 0x22, 0x04, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x2b, 0x21, 0x00, 0x00, 0xd0, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0xc7, 0x14, 0x00, 0x00, 0x12, 0x36, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 
-	0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x55, 0x3e, 
-	0x22, 0x04, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0xe9, 0x18, 0x55, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x55, 0x3e, 0x21, 0x00, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 
-	0x85, 0x0c, 0x8e, 0x29, 0x0a, 0x1d, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0x8e, 0x29, 0x00, 0x00, 0xc7, 0x10, 0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 0x8f, 0x29, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0xd1, 0x31, 0x00, 0x00, 0xe8, 0x18, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x85, 0x0c, 0x55, 0x3e, 0x56, 0x42, 0x55, 0x3e, 0x4c, 0x25, 
-	0x63, 0x08, 0xa7, 0x10, 0xaf, 0x2d, 0xaf, 0x2d, 0x00, 0x00, 0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0xb0, 0x2d, 0xe8, 0x14, 0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x34, 0x3a, 
-	0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x25, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 
-	0xe9, 0x18, 0xaf, 0x2d, 0x6d, 0x29, 0x00, 0x00, 0x85, 0x0c, 0x35, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x8e, 0x29, 
-	0xc8, 0x14, 0x43, 0x08, 0xc7, 0x14, 0x6d, 0x25, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 
-	0x6e, 0x29, 0x34, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x35, 0x3e, 
-	0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 
-	0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xd0, 0x2d, 
-	0xe8, 0x18, 0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0x6d, 0x25, 0x64, 0x0c, 0xa6, 0x10, 0xaf, 0x2d, 
-	0xd1, 0x31, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x8f, 0x29, 0x86, 0x10, 0xa7, 0x10, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x0a, 0x1d, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 
-	0x09, 0x19, 0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 0x85, 0x0c, 0x8e, 0x29, 0x0a, 0x1d, 
-	0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0x2b, 0x1d, 
-	0x09, 0x19, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0xf1, 0x31, 0xe8, 0x18, 
-	0x00, 0x00, 0x4c, 0x21, 0xb0, 0x2d, 0x55, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 
-	0x34, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 0x43, 0x08, 0x55, 0x3e, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 
-	0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0x2b, 0x21, 
-	0x56, 0x42, 0x56, 0x42, 0x4c, 0x25, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 
-	0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x85, 0x0c, 0xa7, 0x10, 0xa7, 0x10, 0xa7, 0x10, 
-	0xa7, 0x10, 0x22, 0x04, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x00, 0x00, 
-	0xaf, 0x2d, 0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x2b, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 
-	0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x21, 0x00, 
-	0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0x13, 0x36, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0xf2, 0x35, 0x00, 0x00, 0x43, 0x08, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xaf, 0x2d, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 
-	0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x22, 0x04, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 
-	0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 
-	0x13, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0xe9, 0x18, 0x55, 0x3e, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 
-	0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 
-	0x00, 0x00, 0xd0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 
-	0xc7, 0x10, 0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 0x8f, 0x29, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 0x85, 0x0c, 0x8e, 0x29, 0x0a, 0x1d, 
-	0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 
-	0x00, 0x00, 0xc7, 0x14, 0xaf, 0x2d, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x09, 0x19, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xb0, 0x2d, 
-	0xe8, 0x14, 0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 
-	0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0x4c, 0x25, 0x63, 0x08, 0xa7, 0x10, 0xaf, 0x2d, 
-	0xaf, 0x2d, 0x00, 0x00, 0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x34, 0x3a, 
-	0x09, 0x19, 0x42, 0x04, 0xc8, 0x14, 0x35, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x34, 0x3a, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x4c, 0x25, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 0xe9, 0x18, 0xaf, 0x2d, 0x6d, 0x29, 
-	0x00, 0x00, 0x85, 0x0c, 0x35, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x8e, 0x29, 0xc8, 0x14, 0x43, 0x08, 0xc7, 0x14, 
-	0x6d, 0x25, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x57, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0xe8, 0x14, 0x00, 0x00, 0xd0, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x0a, 0x1d, 
-	0x00, 0x00, 0x64, 0x08, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x64, 0x0c, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 
-	0x00, 0x00, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 0x00, 0x00, 0x4b, 0x21, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 0x6e, 0x29, 0x34, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x35, 0x3e, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0xf1, 0x31, 0x00, 0x00, 0xe8, 0x18, 0x56, 0x42, 0x56, 0x42, 0x13, 0x3a, 0x00, 0x00, 
-	0xa6, 0x10, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xb0, 0x2d, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x34, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 
-	0x8f, 0x29, 0x00, 0x00, 0x8e, 0x29, 0x56, 0x42, 0x56, 0x42, 0x86, 0x10, 0x00, 0x00, 0x13, 0x3a, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x2d, 0xe8, 0x18, 0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0x6d, 0x25, 
-	0x64, 0x0c, 0xa6, 0x10, 0xaf, 0x2d, 0xd1, 0x31, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x8f, 0x29, 0x86, 0x10, 0xa7, 0x10, 0xaf, 0x2d, 0x56, 0x42, 
-	0x56, 0x42, 0x0a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 
-	0x34, 0x3a, 0x00, 0x00, 0x09, 0x19, 0x56, 0x42, 0x34, 0x3e, 0x00, 0x00, 0x22, 0x04, 0x55, 0x3e, 
-	0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0x09, 0x19, 0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 0xaf, 0x2d, 
-	0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 
-	0x85, 0x0c, 0x8e, 0x29, 0x0a, 0x1d, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0x2b, 0x1d, 0x09, 0x19, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x31, 
-	0x56, 0x42, 0xf1, 0x31, 0xe8, 0x18, 0x00, 0x00, 0x4c, 0x21, 0xb0, 0x2d, 0x55, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd1, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x6c, 0x25, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0xe8, 0x18, 0x85, 0x0c, 
-	0x56, 0x42, 0xe9, 0x18, 0x21, 0x00, 0x55, 0x3e, 0xf2, 0x35, 0x00, 0x00, 0x2a, 0x1d, 0x56, 0x42, 
-	0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 0x43, 0x08, 
-	0x55, 0x3e, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 
-	0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0x2b, 0x21, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x25, 0x00, 0x00, 0x6d, 0x25, 
-	0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x2e, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x6d, 0x25, 0x55, 0x3e, 0x00, 0x00, 0x2b, 0x21, 
-	0x56, 0x42, 0x6d, 0x29, 0x00, 0x00, 0x13, 0x3a, 0xaf, 0x2d, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 
-	0x12, 0x36, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 0x00, 0x00, 
-	0x13, 0x3a, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 
-	0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x2b, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x33, 0x3a, 0x00, 0x00, 0xe8, 0x14, 0x13, 0x36, 0x00, 0x00, 0xaf, 0x2d, 
-	0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0xd1, 0x31, 0x4c, 0x21, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0xf2, 0x35, 0x00, 0x00, 0x21, 0x00, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 
-	0x13, 0x36, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0xf2, 0x35, 0x00, 0x00, 0x43, 0x08, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x55, 0x42, 0x64, 0x0c, 0x00, 0x00, 0xaf, 0x2d, 0x00, 0x00, 0xf2, 0x35, 
-	0x56, 0x42, 0x13, 0x3a, 0x00, 0x00, 0x8e, 0x29, 0xa6, 0x10, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 
-	0x12, 0x36, 0x00, 0x00, 0x22, 0x04, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 
-	0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xc8, 0x14, 0x00, 0x00, 0x35, 0x3e, 
-	0x56, 0x42, 0x55, 0x3e, 0x42, 0x04, 0xc8, 0x14, 0x00, 0x00, 0xe9, 0x18, 0x56, 0x42, 0x56, 0x42, 
-	0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0xe9, 0x18, 
-	0x55, 0x3e, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 
-	0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 0xd0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x10, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x0a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x29, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0xc7, 0x10, 0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 0x8f, 0x29, 
-	0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 
-	0x85, 0x0c, 0x8e, 0x29, 0x0a, 0x1d, 0xc7, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0xc7, 0x14, 0xaf, 0x2d, 0x55, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x13, 0x36, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x25, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xb0, 0x2d, 0xe8, 0x14, 0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x55, 0x3e, 0x4c, 0x25, 
-	0x63, 0x08, 0xa7, 0x10, 0xaf, 0x2d, 0xaf, 0x2d, 0x00, 0x00, 0x6d, 0x29, 0x56, 0x42, 0x56, 0x42, 
-	0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0x2a, 0x1d, 
-	0x56, 0x42, 0x56, 0x42, 0x34, 0x3a, 0x09, 0x19, 0x42, 0x04, 0xc8, 0x14, 0x35, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x34, 0x3a, 
-	0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x25, 0x00, 0x00, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 
-	0xe9, 0x18, 0xaf, 0x2d, 0x6d, 0x29, 0x00, 0x00, 0x85, 0x0c, 0x35, 0x3e, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x8e, 0x29, 
-	0xc8, 0x14, 0x43, 0x08, 0xc7, 0x14, 0x6d, 0x25, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0xf1, 0x31, 0x2b, 0x1d, 0x85, 0x0c, 0x22, 0x04, 0x86, 0x10, 
-	0x2b, 0x21, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x21, 0x00, 0x2b, 0x21, 0x6d, 0x25, 0xe8, 0x18, 
-	0x00, 0x00, 0x22, 0x04, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 
-	0x4c, 0x21, 0xc8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x43, 0x08, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xd0, 0x2d, 0xe8, 0x18, 
-	0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0xd1, 0x31, 0x00, 0x00, 0xc7, 0x14, 
-	0x55, 0x3e, 0x56, 0x42, 0x35, 0x3e, 0x64, 0x0c, 0x00, 0x00, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x2b, 0x21, 0x00, 0x00, 0x85, 0x0c, 0xaf, 0x2d, 0x13, 0x3a, 0x56, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0x09, 0x19, 
-	0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 
-	0xaf, 0x2d, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 0x8e, 0x29, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x34, 0x3a, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x0c, 
-	0x4c, 0x25, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x34, 0x3a, 
-	0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 0x43, 0x08, 0x55, 0x3e, 0x56, 0x42, 0x35, 0x3e, 0x85, 0x0c, 
-	0x22, 0x04, 0xd0, 0x2d, 0x00, 0x00, 0xe8, 0x18, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 0xf2, 0x35, 0x6d, 0x25, 0xc7, 0x14, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xf1, 0x35, 0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 
-	0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0xf2, 0x35, 
-	0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x34, 0x3a, 
-	0x2a, 0x1d, 0x00, 0x00, 0xc8, 0x14, 0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x21, 0x00, 0xe8, 0x18, 
-	0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x85, 0x0c, 0x00, 0x00, 0xe9, 0x18, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x22, 0x04, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x8f, 0x29, 
-	0x00, 0x00, 0x64, 0x08, 0x00, 0x00, 0xd0, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x13, 0x3a, 0x09, 0x19, 0xc8, 0x14, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xaf, 0x2d, 0x00, 0x00, 0xc7, 0x14, 0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x13, 0x3a, 
-	0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0xe9, 0x18, 0x55, 0x3e, 0x56, 0x42, 0x13, 0x3a, 0x21, 0x00, 
-	0xa7, 0x10, 0x34, 0x3a, 0x63, 0x08, 0x64, 0x08, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x55, 0x3e, 0xe9, 0x18, 0x00, 0x00, 0x22, 0x04, 0x0a, 0x1d, 0x2b, 0x21, 0xc7, 0x14, 
-	0x00, 0x00, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0xc7, 0x10, 
-	0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 0x8f, 0x29, 0x56, 0x42, 0x55, 0x3e, 0xe8, 0x18, 0x00, 0x00, 
-	0xf2, 0x35, 0x56, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x2b, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x55, 0x3e, 0xaf, 0x2d, 0x0a, 0x1d, 0x85, 0x10, 0x22, 0x04, 0xa6, 0x10, 
-	0x4c, 0x21, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xb0, 0x2d, 0xe8, 0x14, 
-	0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x8f, 0x29, 0x00, 0x00, 0x2b, 0x21, 
-	0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0xe8, 0x18, 0x00, 0x00, 0xd0, 0x31, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x77, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x77, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x53, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x77, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x57, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x4e, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0xf1, 0x31, 0x2b, 0x1d, 0x85, 0x0c, 0x22, 0x04, 0x86, 0x10, 
-	0x2b, 0x21, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xf1, 0x35, 0x2b, 0x21, 0x85, 0x0c, 0x22, 0x04, 0x86, 0x10, 0x2b, 0x21, 
-	0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x21, 0x00, 0x2b, 0x21, 0x6d, 0x25, 0xe8, 0x18, 
-	0x00, 0x00, 0x22, 0x04, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0x35, 0x3e, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0xb0, 0x2d, 0x00, 0x00, 0x21, 0x00, 0x2b, 0x21, 0x6d, 0x25, 0xe8, 0x18, 0x00, 0x00, 
-	0x22, 0x04, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 0x6e, 0x29, 0x34, 0x3a, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfb, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 
-	0x4c, 0x21, 0xc8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0xa6, 0x10, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 
-	0xc8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x31, 0xf2, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x43, 0x08, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x0a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 0xd0, 0x2d, 0xe8, 0x18, 0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xa6, 0x10, 0x00, 0x00, 0x12, 0x36, 0x6d, 0x29, 0x85, 0x0c, 
-	0x85, 0x0c, 0x8f, 0x29, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x43, 0x08, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x55, 0x3e, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 
-	0x56, 0x42, 0xd0, 0x2d, 0xe8, 0x18, 0x42, 0x04, 0xc7, 0x14, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x2b, 0x21, 0x00, 0x00, 0x85, 0x0c, 0xaf, 0x2d, 0x13, 0x3a, 0x56, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xf1, 0x31, 0xe8, 0x18, 0x00, 0x00, 0x4c, 0x21, 
-	0xb0, 0x2d, 0x55, 0x42, 0x8f, 0x29, 0x00, 0x00, 0x09, 0x19, 0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 
-	0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xc8, 0x14, 0x4c, 0x21, 0x6d, 0x25, 
-	0x21, 0x00, 0x00, 0x00, 0xd0, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x2b, 0x21, 0x00, 0x00, 0x85, 0x0c, 0xb0, 0x2d, 0x13, 0x3a, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x8e, 0x29, 0x8e, 0x29, 0x8e, 0x29, 0x0a, 0x1d, 0x00, 0x00, 0x64, 0x08, 0x55, 0x3e, 0x56, 0x42, 
-	0x8f, 0x29, 0x00, 0x00, 0x09, 0x19, 0xd1, 0x31, 0x4b, 0x21, 0x00, 0x00, 0xaf, 0x2d, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x34, 0x3a, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x0c, 
-	0x4c, 0x25, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 
-	0x43, 0x08, 0x55, 0x3e, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0x4c, 0x21, 0x56, 0x42, 0x56, 0x42, 
-	0xaf, 0x2d, 0x00, 0x00, 0xe8, 0x18, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x34, 0x3a, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x0c, 0x4c, 0x25, 
-	0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x55, 0x3e, 
-	0x22, 0x04, 0x00, 0x00, 0x34, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0x85, 0x0c, 0x43, 0x08, 0x55, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 0xf2, 0x35, 0x6d, 0x25, 0xc7, 0x14, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xf1, 0x35, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 
-	0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 
-	0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x55, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 0xf2, 0x35, 0x6d, 0x25, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xf1, 0x35, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x6d, 0x25, 0x00, 0x00, 0x4b, 0x21, 0x56, 0x42, 0x56, 0x42, 0x12, 0x36, 
-	0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 0xaf, 0x2d, 0xaf, 0x2d, 0xa7, 0x10, 0x00, 0x00, 0x13, 0x3a, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xda, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x34, 0x3a, 
-	0x2a, 0x1d, 0x00, 0x00, 0xc8, 0x14, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x21, 0x00, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 
-	0xe8, 0x18, 0x13, 0x36, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0x12, 0x36, 0x56, 0x42, 0x56, 0x42, 
-	0x34, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x55, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x34, 0x3a, 0x2a, 0x1d, 
-	0x00, 0x00, 0xc8, 0x14, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x56, 0x42, 0xf2, 0x35, 0x00, 0x00, 0x85, 0x0c, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0xf2, 0x35, 
-	0x00, 0x00, 0x21, 0x00, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0x13, 0x36, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x13, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0x56, 0x42, 0x4b, 0x21, 0x00, 0x00, 0xd1, 0x31, 
-	0x56, 0x42, 0x12, 0x36, 0x00, 0x00, 0x22, 0x04, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf1, 0x35, 0x56, 0x42, 0x56, 0x42, 
-	0x13, 0x3a, 0x00, 0x00, 0x21, 0x00, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x13, 0x3a, 
-	0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x35, 0x3e, 0x86, 0x10, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x12, 0x36, 
-	0x00, 0x00, 0x22, 0x04, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x13, 0x3a, 0x09, 0x19, 0xc8, 0x14, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0xaf, 0x2d, 0x00, 0x00, 0xc7, 0x14, 0x56, 0x42, 0x56, 0x42, 0x4c, 0x21, 0x00, 0x00, 0xd0, 0x2d, 
-	0x56, 0x42, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 
-	0xe9, 0x18, 0x55, 0x3e, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0x6d, 0x25, 0x56, 0x42, 0x56, 0x42, 
-	0xaf, 0x2d, 0x00, 0x00, 0x09, 0x19, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x13, 0x36, 0x09, 0x19, 0xc8, 0x14, 0x34, 0x3e, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xaf, 0x2d, 
-	0x00, 0x00, 0xc7, 0x14, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 
-	0x4c, 0x21, 0x00, 0x00, 0x4c, 0x25, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x22, 0x04, 0x00, 0x00, 0x13, 0x3a, 0x56, 0x42, 0x55, 0x3e, 0xa6, 0x10, 0xe9, 0x18, 0x55, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x55, 0x3e, 0xe9, 0x18, 0x00, 0x00, 0x22, 0x04, 0x0a, 0x1d, 0x2b, 0x21, 0xc7, 0x14, 
-	0x00, 0x00, 0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x8e, 0x29, 0x00, 0x00, 0xc7, 0x14, 
-	0xaf, 0x2d, 0x55, 0x3e, 0x8e, 0x29, 0x00, 0x00, 0xc7, 0x10, 0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 
-	0x8f, 0x29, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xc7, 0x14, 0x6d, 0x25, 0x8e, 0x29, 
-	0x21, 0x00, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x55, 0x3e, 0xe9, 0x18, 0x00, 0x00, 0x22, 0x04, 0x0a, 0x1d, 0x2b, 0x21, 0xc7, 0x14, 0x00, 0x00, 
-	0x00, 0x00, 0xf1, 0x31, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x12, 0x36, 
-	0x00, 0x00, 0x00, 0x00, 0x4c, 0x25, 0x8e, 0x29, 0x8e, 0x29, 0x8e, 0x29, 0x13, 0x3a, 0x56, 0x42, 
-	0x8e, 0x29, 0x00, 0x00, 0xc7, 0x10, 0xaf, 0x2d, 0x2b, 0x21, 0x00, 0x00, 0x8f, 0x29, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x55, 0x3e, 0xaf, 0x2d, 0x0a, 0x1d, 0x85, 0x10, 0x22, 0x04, 0xa6, 0x10, 
-	0x4c, 0x21, 0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x34, 0x3a, 0x09, 0x19, 0x42, 0x04, 
-	0xc8, 0x14, 0x35, 0x3e, 0x56, 0x42, 0xb0, 0x2d, 0xe8, 0x14, 0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf1, 0x35, 0x6d, 0x25, 0x64, 0x0c, 
-	0xa6, 0x10, 0xaf, 0x2d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x55, 0x3e, 0xb0, 0x2d, 0x0a, 0x1d, 0x86, 0x10, 0x22, 0x04, 0xa6, 0x10, 0x4c, 0x21, 
-	0x13, 0x36, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0xf2, 0x35, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x31, 0x56, 0x42, 
-	0x56, 0x42, 0xb0, 0x2d, 0xe8, 0x14, 0x43, 0x08, 0xe8, 0x14, 0xb0, 0x2d, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0xd0, 0x31, 0x00, 0x00, 0x0a, 0x1d, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x31, 0xf2, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xd2, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0xc8, 0x14, 0x00, 0x00, 0xf2, 0x35, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xb1, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x14, 0x36, 0x14, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb9, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 
-	0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0xfa, 0x56, 
-	0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 
-	0x56, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x3b, 0x5b, 0x3b, 0x5b, 0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0xfa, 0x56, 
-	0xfa, 0x52, 0xfa, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x5b, 0x1b, 0x5b, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 0xfa, 0x52, 
-	0xfa, 0x52, 0xf9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd9, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0xb8, 0x4a, 0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd0, 0x2d, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 0xfa, 0x56, 0xfa, 0x52, 
-	0xfa, 0x52, 0xd9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 
-	0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x3a, 0x14, 0x36, 0x13, 0x32, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd0, 0x2d, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1b, 0x57, 0x1a, 0x57, 0xfa, 0x56, 0xfa, 0x52, 0xfa, 0x52, 
-	0xf9, 0x52, 0xd9, 0x4e, 0xd9, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 
-	0x97, 0x4a, 0x97, 0x4a, 0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x76, 0x42, 
-	0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x56, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 0x56, 0x3e, 
-	0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x42, 0x56, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x34, 0x36, 0x14, 0x36, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd0, 0x2d, 0xd0, 0x29, 0xd0, 0x29, 0xd0, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0x1a, 0x57, 0xfa, 0x56, 0xfa, 0x56, 0xfa, 0x52, 0xf9, 0x52, 
-	0xd9, 0x52, 0xd9, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4a, 0xb8, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 
-	0x97, 0x46, 0x96, 0x46, 0x76, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x56, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 
-	0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x35, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3e, 0x35, 0x3a, 0x35, 0x3a, 
-	0x34, 0x36, 0x14, 0x36, 0x13, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0x1a, 0x57, 0x1a, 0x57, 0xfa, 0x56, 0xfa, 0x56, 0xfa, 0x56, 0xfa, 0x52, 0xf9, 0x52, 0xf9, 0x52, 
-	0xd9, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x97, 0x46, 
-	0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x56, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 
-	0x35, 0x3a, 0x35, 0x3a, 0x35, 0x3a, 0x35, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x14, 0x36, 0x14, 0x36, 
-	0x14, 0x32, 0x13, 0x32, 0xf3, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd0, 0x29, 0xd0, 0x29, 0xb1, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xfa, 0x56, 0xfa, 0x56, 0xfa, 0x56, 0xfa, 0x52, 0xfa, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xd9, 0x52, 
-	0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x46, 0x96, 0x46, 
-	0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3a, 0x35, 0x3a, 
-	0x34, 0x3a, 0x34, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 0x14, 0x36, 
-	0x13, 0x36, 0x13, 0x36, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 
-	0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 
-	0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 0x13, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 
-	0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0xf4, 0x31, 0x13, 0x32, 0xf3, 0x2d, 0xf3, 0x31, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x29, 0xb0, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xf9, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xd9, 0x52, 0xd8, 0x4e, 
-	0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x46, 0x96, 0x46, 0x76, 0x42, 
-	0x76, 0x42, 0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3a, 0x35, 0x3a, 0x34, 0x3a, 0x34, 0x36, 
-	0x14, 0x36, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0x13, 0x32, 0xf3, 0x31, 0xf3, 0x31, 0xf3, 0x31, 
-	0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0xf2, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x31, 
-	0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0xf2, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd0, 0x2d, 0xd0, 0x2d, 0xd0, 0x29, 0xb0, 0x29, 0xb1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf9, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xf9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd8, 0x4e, 0xd8, 0x4e, 
-	0xb8, 0x4e, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x46, 0x96, 0x46, 0x76, 0x42, 0x76, 0x42, 
-	0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x14, 0x36, 0x14, 0x36, 
-	0x14, 0x32, 0x13, 0x32, 0xf3, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x29, 0xf2, 0x29, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 0xf2, 0x29, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xf2, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x29, 0xb0, 0x2d, 0xb1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd9, 0x52, 0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 0x76, 0x42, 0x55, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3a, 0x35, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x14, 0x36, 0x14, 0x32, 0x14, 0x32, 
-	0xf3, 0x31, 0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd2, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xf1, 0x29, 0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xf1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xb1, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x29, 0xb0, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4a, 
-	0x97, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x76, 0x46, 0x76, 0x42, 0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 
-	0x55, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x14, 0x32, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf3, 0x2d, 0xf3, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd1, 0x29, 
-	0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd2, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x25, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xd8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4a, 0x97, 0x4a, 
-	0x96, 0x4a, 0x96, 0x46, 0x76, 0x42, 0x76, 0x42, 0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x35, 0x3a, 
-	0x34, 0x3a, 0x34, 0x36, 0x14, 0x32, 0x14, 0x32, 0x14, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 
-	0xf2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x2d, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd0, 0x2d, 
-	0xd0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf2, 0x2d, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0xb8, 0x4e, 0xb8, 0x4e, 0xb8, 0x4e, 0xb7, 0x4e, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 
-	0x96, 0x46, 0x76, 0x42, 0x75, 0x42, 0x55, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x34, 0x3a, 0x34, 0x3a, 
-	0x34, 0x36, 0x14, 0x36, 0x14, 0x32, 0x13, 0x32, 0x13, 0x2e, 0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 
-	0xd2, 0x2d, 0xd2, 0x2d, 0xd2, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xb0, 0x2d, 0xd0, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd2, 0x31, 0xf2, 0x31, 0xf2, 0x31, 0xf3, 0x31, 0x13, 0x32, 0xf3, 0x31, 0x13, 0x32, 0x13, 0x32, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0x97, 0x4a, 0x96, 0x4a, 0x96, 0x46, 
-	0x76, 0x42, 0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 
-	0x34, 0x36, 0x14, 0x32, 0x13, 0x32, 0xf3, 0x2d, 0xf3, 0x2d, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xd2, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x29, 
-	0xd1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x31, 0xf2, 0x31, 
-	0xf2, 0x31, 0xf2, 0x31, 0x13, 0x32, 0x13, 0x36, 0x13, 0x36, 0x13, 0x36, 0x13, 0x36, 0x13, 0x36, 
-	0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0xb7, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x76, 0x42, 
-	0x75, 0x42, 0x55, 0x3e, 0x55, 0x3e, 0x55, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 
-	0x14, 0x32, 0x13, 0x32, 0x13, 0x2e, 0x13, 0x2e, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x29, 0xf1, 0x29, 0xd1, 0x29, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x31, 0xd1, 0x31, 0xf2, 0x31, 0xf2, 0x31, 
-	0xf2, 0x31, 0x13, 0x36, 0x13, 0x36, 0x13, 0x36, 0x13, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 
-	0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x96, 0x46, 0x76, 0x46, 0x75, 0x42, 
-	0x75, 0x3e, 0x55, 0x3e, 0x55, 0x3a, 0x54, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x32, 0x14, 0x32, 
-	0x13, 0x32, 0x13, 0x32, 0x13, 0x2e, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 
-	0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x31, 
-	0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf2, 0x31, 0xf2, 0x35, 
-	0x13, 0x36, 0x13, 0x36, 0x13, 0x3a, 0x33, 0x3a, 0x33, 0x3a, 0x33, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x96, 0x4a, 0x96, 0x4a, 0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x76, 0x42, 0x75, 0x42, 
-	0x55, 0x3e, 0x55, 0x3a, 0x55, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x32, 0x14, 0x32, 0x13, 0x32, 
-	0x13, 0x32, 0x13, 0x2e, 0x13, 0x2e, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf1, 0x2d, 0xd1, 0x2d, 0xd1, 0x2d, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 
-	0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xf1, 0x31, 0xf2, 0x31, 0xf2, 0x35, 0x12, 0x36, 
-	0x13, 0x36, 0x13, 0x3a, 0x33, 0x3a, 0x33, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 
-	0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x76, 0x46, 0x75, 0x42, 0x75, 0x42, 
-	0x55, 0x3e, 0x55, 0x3a, 0x34, 0x3a, 0x34, 0x36, 0x34, 0x32, 0x34, 0x32, 0x14, 0x32, 0x13, 0x32, 
-	0x13, 0x2e, 0x13, 0x2e, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 
-	0xf1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf2, 0x31, 0x12, 0x36, 0x12, 0x36, 
-	0x13, 0x36, 0x33, 0x3a, 0x33, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3e, 0x34, 0x3e, 0x34, 0x3e, 
-	0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x96, 0x46, 0x76, 0x42, 0x75, 0x42, 0x75, 0x3e, 
-	0x55, 0x3e, 0x55, 0x3a, 0x34, 0x36, 0x34, 0x36, 0x34, 0x32, 0x34, 0x32, 0x14, 0x32, 0x13, 0x2e, 
-	0x13, 0x2e, 0x13, 0x2e, 0xf3, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x2d, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xf1, 0x31, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 0xf2, 0x2d, 
-	0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x31, 0xf1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 
-	0xf1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xf1, 0x31, 0xf1, 0x31, 0xf2, 0x31, 0xf2, 0x35, 0x12, 0x36, 
-	0x13, 0x36, 0x33, 0x3a, 0x33, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3e, 0x34, 0x3e, 0x34, 0x3e
-	
-};
-const int edit_screen_1_size = sizeof(edit_screen_1);
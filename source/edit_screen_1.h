@@ -1,14 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-//---------------------------------------------------------------------------------
-#ifndef _edit_screen_1_h_
-#define _edit_screen_1_h_
-//---------------------------------------------------------------------------------
-extern const unsigned char edit_screen_1[];
-extern const int edit_screen_1_size;
-//---------------------------------------------------------------------------------
-#endif //_edit_screen_1_h_
-//---------------------------------------------------------------------------------
@@ -1,14 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-//---------------------------------------------------------------------------------
-#ifndef _font_kana_h_
-#define _font_kana_h_
-//---------------------------------------------------------------------------------
-extern const unsigned char font_kana[];
-extern const int font_kana_size;
-//---------------------------------------------------------------------------------
-#endif //_font_kana_h_
-//---------------------------------------------------------------------------------
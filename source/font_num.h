@@ -1,14 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-//---------------------------------------------------------------------------------
-#ifndef _font_num_h_
-#define _font_num_h_
-//---------------------------------------------------------------------------------
-extern const unsigned char font_num[];
-extern const int font_num_size;
-//---------------------------------------------------------------------------------
-#endif //_font_num_h_
-//---------------------------------------------------------------------------------
@@ -0,0 +1,193 @@
+#include "common.h"
+#include "font_num.h"
+#include "hexview.h"
+
+#define HEXVIEW_DATA_Y (HEXVIEW_Y + 16)
+#define HEXVIEW_ROW_H 10
+
+struct hexview_state hexview;
+
+//Half-size 8x8 copies of the 0-F glyphs in font_num, one bit per pixel
+static u8 hex_glyphs[16][8];
+static bool hex_glyphs_ready = false;
+
+void build_hex_glyphs()
+{
+	//Shrink each 16x16 glyph 2:1, a pixel is set if any of its 2x2 source block is
+	for(u32 n = 0; n < 16; n++)
+	{
+		for(u32 y = 0; y < 8; y++)
+		{
+			u8 bits = 0;
+
+			for(u32 x = 0; x < 8; x++)
+			{
+				for(u32 s = 0; s < 4; s++)
+				{
+					u32 pos = (((y * 2) + (s >> 1)) * FONT_NUM_WIDTH) + (n * 16) + (x * 2) + (s & 1);
+					u16 val = font_num[pos];
+
+					if(val != 0x7FFF) { bits |= (0x80 >> x); }
+				}
+			}
+
+			hex_glyphs[n][y] = bits;
+		}
+	}
+
+	hex_glyphs_ready = true;
+}
+
+void fill_rect(u32 sx, u32 sy, u32 w, u32 h, pixel color)
+{
+	for(u32 y = 0; y < h; y++)
+	{
+		u32 buffer_pos = ((sy + y) * 240) + sx;
+		for(u32 x = 0; x < w; x++) { plot(buffer_pos++, color); }
+	}
+}
+
+void draw_hex_digit(u8 digit, u32 sx, u32 sy)
+{
+	if(!hex_glyphs_ready) { build_hex_glyphs(); }
+
+	const u8* glyph = hex_glyphs[digit & 0xF];
+	u32 buffer_pos = (sy * 240) + sx;
+
+	for(u32 y = 0; y < 8; y++)
+	{
+		for(u32 x = 0; x < 8; x++) { plot(buffer_pos + x, (glyph[y] & (0x80 >> x)) ? PIXEL_BLACK : PIXEL_WHITE); }
+		buffer_pos += 240;
+	}
+}
+
+void draw_hex(u32 value, u8 digits, u32 sx, u32 sy)
+{
+	for(u32 d = 0; d < digits; d++)
+	{
+		draw_hex_digit((value >> ((digits - 1 - d) * 4)), sx + (d * 8), sy);
+	}
+}
+
+u16 hexview_total_rows()
+{
+	return (hexview.length + HEXVIEW_BYTES_PER_ROW - 1) / HEXVIEW_BYTES_PER_ROW;
+}
+
+void draw_hexview_row(u32 row)
+{
+	//Header: source tag and length
+	if(row == 0)
+	{
+		fill_rect(HEXVIEW_X, HEXVIEW_Y + 4, HEXVIEW_W, 8, PIXEL_WHITE);
+		draw_hex(hexview.tag, 2, HEXVIEW_X + 4, HEXVIEW_Y + 4);
+		draw_hex(hexview.length, 4, HEXVIEW_X + 28, HEXVIEW_Y + 4);
+		return;
+	}
+
+	u32 sy = HEXVIEW_DATA_Y + ((row - 1) * HEXVIEW_ROW_H);
+	u32 offset = (hexview.top + row - 1) * HEXVIEW_BYTES_PER_ROW;
+
+	fill_rect(HEXVIEW_X, sy, HEXVIEW_W, 8, PIXEL_WHITE);
+	if(offset >= hexview.length) { return; }
+
+	//Offset, then up to 8 bytes 20 pixels apart
+	draw_hex(offset, 2, HEXVIEW_X + 4, sy);
+
+	for(u32 x = 0; (x < HEXVIEW_BYTES_PER_ROW) && ((offset + x) < hexview.length); x++)
+	{
+		draw_hex(hexview.data[offset + x], 2, HEXVIEW_X + 28 + (x * 20), sy);
+	}
+}
+
+void hexview_open(u8 tag, const u8* data, u16 length)
+{
+	hexview.active = true;
+	hexview.tag = tag;
+	hexview.data = data;
+	hexview.length = length;
+	hexview.top = 0;
+	hexview.dirty = (1 << (HEXVIEW_ROWS + 1)) - 1;
+
+	fill_rect(HEXVIEW_X, HEXVIEW_Y, HEXVIEW_W, HEXVIEW_H, PIXEL_WHITE);
+}
+
+void move_rows(u32 dst_y, u32 src_y, u32 lines)
+{
+	//Copy panel lines within VRAM, in an order safe for overlapping ranges
+	if(dst_y < src_y)
+	{
+		for(u32 y = 0; y < lines; y++)
+		{
+			u32 dst = ((dst_y + y) * 240) + HEXVIEW_X;
+			u32 src = ((src_y + y) * 240) + HEXVIEW_X;
+			for(u32 x = 0; x < HEXVIEW_W; x++) { plot(dst + x, peek(src + x)); }
+		}
+	}
+
+	else
+	{
+		for(u32 y = lines; y > 0; y--)
+		{
+			u32 dst = ((dst_y + y - 1) * 240) + HEXVIEW_X;
+			u32 src = ((src_y + y - 1) * 240) + HEXVIEW_X;
+			for(u32 x = 0; x < HEXVIEW_W; x++) { plot(dst + x, peek(src + x)); }
+		}
+	}
+}
+
+void hexview_scroll(s8 rows)
+{
+	u16 total = hexview_total_rows();
+	u16 last = (total > HEXVIEW_ROWS) ? (total - HEXVIEW_ROWS) : 0;
+	s32 top = hexview.top + rows;
+
+	if(top < 0) { top = 0; }
+	if(top > last) { top = last; }
+	if(top == hexview.top) { return; }
+
+	rows = top - hexview.top;
+	hexview.top = top;
+
+	//Shift what is already on screen by a row and only draw the one that came into view
+	if((hexview.dirty == 0) && ((rows == 1) || (rows == -1)))
+	{
+		u32 lines = ((HEXVIEW_ROWS - 1) * HEXVIEW_ROW_H);
+
+		if(rows == 1)
+		{
+			move_rows(HEXVIEW_DATA_Y, HEXVIEW_DATA_Y + HEXVIEW_ROW_H, lines);
+			hexview.dirty = (1 << HEXVIEW_ROWS);
+		}
+
+		else
+		{
+			move_rows(HEXVIEW_DATA_Y + HEXVIEW_ROW_H, HEXVIEW_DATA_Y, lines);
+			hexview.dirty = (1 << 1);
+		}
+	}
+
+	else { hexview.dirty |= ((1 << (HEXVIEW_ROWS + 1)) - 2); }
+}
+
+void hexview_frame()
+{
+	//Draw a few pending rows per frame so the view never costs more than a slice of VBlank
+	for(u32 row = 0, drawn = 0; (row <= HEXVIEW_ROWS) && (drawn < HEXVIEW_ROWS_PER_FRAME); row++)
+	{
+		if(hexview.dirty & (1 << row))
+		{
+			draw_hexview_row(row);
+			hexview.dirty &= ~(1 << row);
+			drawn++;
+		}
+	}
+}
+
+void hexview_close(const u16* bg_src)
+{
+	hexview.active = false;
+
+	//Put back only the part of the background the panel covered
+	clear_rect(bg_src, HEXVIEW_X, HEXVIEW_Y, HEXVIEW_W, HEXVIEW_H);
+}
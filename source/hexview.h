@@ -0,0 +1,37 @@
+#ifndef GBA_HEXVIEW_H
+#define GBA_HEXVIEW_H
+
+#include <gba_types.h>
+
+//Panel drawn over the current screen
+#define HEXVIEW_X 16
+#define HEXVIEW_Y 16
+#define HEXVIEW_W 208
+#define HEXVIEW_H 128
+
+#define HEXVIEW_ROWS 11
+#define HEXVIEW_BYTES_PER_ROW 8
+#define HEXVIEW_ROWS_PER_FRAME 3
+
+struct hexview_state
+{
+	bool active;
+	u8 tag;
+	const u8* data;
+	u16 length;
+	u16 top;
+
+	//Bit 0 = header, bit n = data row n - 1
+	u16 dirty;
+};
+
+extern struct hexview_state hexview;
+
+void hexview_open(u8 tag, const u8* data, u16 length);
+void hexview_scroll(s8 rows);
+void hexview_frame();
+void hexview_close(const u16* bg_src);
+void draw_hex_digit(u8 digit, u32 sx, u32 sy);
+void draw_hex(u32 value, u8 digits, u32 sx, u32 sy);
+
+#endif /* GBA_HEXVIEW_H */
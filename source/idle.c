@@ -0,0 +1,103 @@
+#include <gba_interrupt.h>
+#include <gba_timers.h>
+
+#include "common.h"
+#include "idle.h"
+#include "timers.h"
+
+struct idle_state idle;
+
+void idle_reset()
+{
+	idle.count = 0;
+	idle.next = 0;
+	idle.entry_gap = 0;
+	idle.last_end = 0;
+	idle.cadence = 0;
+	idle.deadline = 0;
+	idle.skipped = 0;
+}
+
+void idle_register(idle_func run, u32 budget_cycles)
+{
+	if(idle.count == IDLE_JOBS) { return; }
+
+	idle.jobs[idle.count].run = run;
+	idle.jobs[idle.count].budget = IDLE_TICKS(budget_cycles);
+	idle.jobs[idle.count].runs = 0;
+	idle.count++;
+}
+
+void idle_command_start()
+{
+	//Time since the previous command's wait began, then time this one from here (1024 cycle ticks)
+	idle.entry_gap = TIMER_CNT_L(SI_TIMER_IDLE);
+	timer_start(SI_TIMER_IDLE, 0, TIMER_START | TIMER_IRQ | 3);
+}
+
+void idle_command_end()
+{
+	u16 end = TIMER_CNT_L(SI_TIMER_IDLE);
+	u16 period = idle.entry_gap + end - idle.last_end;
+
+	idle.last_end = end;
+
+	//Smooth the cadence, but never trust it to be longer than the last period seen
+	if(idle.cadence == 0) { idle.cadence = period; }
+	else { idle.cadence = ((idle.cadence * 3) + period) >> 2; }
+
+	if(period < idle.cadence) { idle.cadence = period; }
+}
+
+bool idle_yield()
+{
+	//Jobs stop at the first serial edge or once the predicted window is used up
+	return (REG_IF & IRQ_SERIAL) || (TIMER_CNT_L(SI_TIMER_IDLE) >= idle.deadline);
+}
+
+void idle_run()
+{
+	if((idle.count == 0) || (idle.cadence <= IDLE_GUARD)) { return; }
+
+	idle.deadline = idle.last_end + idle.cadence - IDLE_GUARD;
+
+	//Round robin until every job in a row has nothing left to do
+	for(u8 done = 0; done < idle.count; )
+	{
+		struct idle_job* job = &idle.jobs[idle.next];
+
+		//Stop at the first edge of the next command, which stats.late counts, or once the job would not fit before it
+		if(idle_yield() || ((TIMER_CNT_L(SI_TIMER_IDLE) + job->budget) > idle.deadline))
+		{
+			if(!(REG_IF & IRQ_SERIAL)) { idle.skipped++; }
+			return;
+		}
+
+		idle.next = (idle.next + 1) % idle.count;
+		job->runs++;
+
+		if(job->run()) { done = 0; }
+		else { done++; }
+	}
+}
+
+void idle_copy_start(struct idle_copy* copy, const void* src, vu8* dst, u16 length)
+{
+	copy->src = src;
+	copy->dst = dst;
+	copy->length = length;
+	copy->done = 0;
+}
+
+bool idle_copy_run(struct idle_copy* copy)
+{
+	while(copy->done < copy->length)
+	{
+		copy->dst[copy->done] = copy->src[copy->done];
+		copy->done++;
+
+		if(((copy->done % IDLE_COPY_BATCH) == 0) && idle_yield()) { return (copy->done < copy->length); }
+	}
+
+	return false;
+}
@@ -0,0 +1,75 @@
+#ifndef GBA_IDLE_H
+#define GBA_IDLE_H
+
+#include <gba_types.h>
+
+/*
+  Send mode scheduler. Times are SI_TIMER_IDLE ticks (1024 cycles), which
+  idle_command_start() restarts as the wait for each command begins. A
+  wait cut short by VBlank carries on without a restart, so the timer
+  still reaches the idle timeout that drops si_receive into Stop.
+  The command cadence is tracked from those readings, and background jobs
+  are run after a command only while they fit before the next one is due.
+  A command can still come early, so jobs also stop at its first edge:
+  idle_run() checks between jobs, and long jobs check idle_yield() after
+  every budget's worth of work. The early command's first bits are lost
+  either way: si_receive reports it as SI_LATE and stats.late counts it,
+  and the reply to the next one is not held up.
+*/
+
+#define IDLE_JOBS 4
+
+//Ticks kept free before the predicted next command (covers a full 0x60 frame)
+#define IDLE_GUARD 80
+
+#define IDLE_TICKS(cycles) (((cycles) + 1023) >> 10)
+
+//Bytes idle_copy_run() writes between idle_yield() checks, and what they cost at worst
+#define IDLE_COPY_BATCH 4
+#define IDLE_COPY_CYCLES 128
+
+//A job returns true while it has more to do. Long ones poll idle_yield() and return early when it says so
+typedef bool (*idle_func)();
+
+//Copy into byte-wide SRAM, spread over as many idle slots as it takes
+struct idle_copy
+{
+	const u8* src;
+	vu8* dst;
+	u16 length;
+	u16 done;
+};
+
+struct idle_job
+{
+	idle_func run;
+	u16 budget;
+	u32 runs;
+};
+
+struct idle_state
+{
+	struct idle_job jobs[IDLE_JOBS];
+	u8 count;
+	u8 next;
+
+	u16 entry_gap;
+	u16 last_end;
+	u16 cadence;
+	u16 deadline;
+
+	u32 skipped;
+};
+
+extern struct idle_state idle;
+
+void idle_reset();
+void idle_register(idle_func run, u32 budget_cycles);
+void idle_command_start();
+void idle_command_end();
+void idle_run();
+bool idle_yield();
+void idle_copy_start(struct idle_copy* copy, const void* src, vu8* dst, u16 length);
+bool idle_copy_run(struct idle_copy* copy);
+
+#endif /* GBA_IDLE_H */
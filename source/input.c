@@ -0,0 +1,43 @@
+#include "common.h"
+#include "input.h"
+
+struct input_state input;
+
+void update_input()
+{
+	//Latch KEYINPUT once per frame (keys are active low)
+	u16 keys = ~IO_H[152] & 0x3FF;
+
+	input.pressed = keys & ~input.held;
+	input.released = input.held & ~keys;
+	input.held = keys;
+	input.repeat = input.pressed;
+
+	//Restart the repeat delay on any new press of a repeating key
+	if(input.pressed & input.repeat_mask)
+	{
+		input.repeat_timer = input.repeat_delay;
+		input.repeat_count = 0;
+	}
+
+	//Fire held repeating keys again once the timer runs out
+	else if(input.held & input.repeat_mask)
+	{
+		if(input.repeat_timer) { input.repeat_timer--; }
+
+		if(input.repeat_timer == 0)
+		{
+			input.repeat |= (input.held & input.repeat_mask);
+			input.repeat_timer = input.repeat_rate;
+			if(input.repeat_count != 0xFFFF) { input.repeat_count++; }
+		}
+	}
+}
+
+void set_key_repeat(u16 mask, u8 delay, u8 rate)
+{
+	input.repeat_mask = mask;
+	input.repeat_delay = delay;
+	input.repeat_rate = rate;
+	input.repeat_timer = delay;
+}
@@ -0,0 +1,33 @@
+#ifndef GBA_INPUT_LATCH_H
+#define GBA_INPUT_LATCH_H
+
+#include <gba_types.h>
+#include <gba_input.h>
+
+//Default auto-repeat timing (in frames)
+#define KEY_REPEAT_DELAY 20
+#define KEY_REPEAT_RATE 4
+
+//Number of repeats before a held key steps counters 10x faster
+#define KEY_ACCEL_REPEATS 12
+
+struct input_state
+{
+	u16 held;
+	u16 pressed;
+	u16 released;
+	u16 repeat;
+
+	u16 repeat_mask;
+	u8 repeat_delay;
+	u8 repeat_rate;
+	u8 repeat_timer;
+	u16 repeat_count;
+};
+
+extern struct input_state input;
+
+void update_input();
+void set_key_repeat(u16 mask, u8 delay, u8 rate);
+
+#endif /* GBA_INPUT_LATCH_H */
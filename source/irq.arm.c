@@ -0,0 +1,205 @@
+#include <stddef.h>
+#include <gba_interrupt.h>
+#include <gba_timers.h>
+
+#include "bios.h"
+#include "common.h"
+#include "irq.h"
+#include "timers.h"
+
+//Sources in priority order, Joybus capture and its timers first
+static const u16 irq_priority[IRQ_SOURCES] =
+{
+	IRQ_SERIAL,
+	IRQ_TIMER0,
+	IRQ_TIMER1,
+	IRQ_TIMER2,
+	IRQ_KEYPAD,
+	IRQ_TIMER3,
+	IRQ_VCOUNT,
+	IRQ_HBLANK,
+	IRQ_VBLANK,
+	IRQ_DMA0,
+	IRQ_DMA1,
+	IRQ_DMA2,
+	IRQ_DMA3,
+	IRQ_GAMEPAK
+};
+
+IWRAM_DATA struct irq_slot irq_table[IRQ_SOURCES];
+volatile u32 frame_count = 0;
+
+void vblank_handler()
+{
+	frame_count++;
+}
+
+/*
+  Calls a handler with IRQs re-enabled in System mode, so it runs on the
+  user stack. REG_IE is narrowed to r1 (the sources allowed to preempt) for
+  the duration and restored, along with SPSR, before returning to IRQ mode.
+*/
+void IWRAM_CODE __attribute__((naked)) irq_nest_call(irq_handler handler, u16 allowed)
+{
+	asm volatile(
+		"mov   r2, #0x04000000 \n"
+		"add   r2, r2, #0x200 \n"
+		"ldrh  r3, [r2] \n"
+		"mrs   r12, spsr \n"
+		"stmfd sp!, {r3, r12, lr} \n"
+		"strh  r1, [r2] \n"
+
+		"mrs   r3, cpsr \n"
+		"bic   r3, r3, #0xDF \n"
+		"orr   r3, r3, #0x1F \n"
+		"msr   cpsr_c, r3 \n"
+
+		"stmfd sp!, {lr} \n"
+		"mov   lr, pc \n"
+		"bx    r0 \n"
+		"ldmfd sp!, {lr} \n"
+
+		"mrs   r3, cpsr \n"
+		"bic   r3, r3, #0xDF \n"
+		"orr   r3, r3, #0x92 \n"
+		"msr   cpsr_c, r3 \n"
+
+		"ldmfd sp!, {r3, r12, lr} \n"
+		"mov   r2, #0x04000000 \n"
+		"add   r2, r2, #0x200 \n"
+		"strh  r3, [r2] \n"
+		"msr   spsr_fsxc, r12 \n"
+		"bx    lr \n"
+	);
+}
+
+void IWRAM_CODE irq_dispatch()
+{
+	u16 pending = REG_IE & REG_IF;
+	u16 higher = 0;
+
+	for(u32 x = 0; (x < IRQ_SOURCES) && pending; x++)
+	{
+		struct irq_slot* slot = &irq_table[x];
+
+		if(pending & slot->mask)
+		{
+			//Acknowledge, and flag the source for BIOS IntrWait calls
+			REG_IF = slot->mask;
+			BIOS_IF |= slot->mask;
+			pending &= ~slot->mask;
+
+			if(slot->handler)
+			{
+				u16 start = TIMER_CNT_L(PROFILE_TIMER);
+
+				if(slot->nested) { irq_nest_call(slot->handler, higher & REG_IE); }
+				else { slot->handler(); }
+
+				u16 cycles = TIMER_CNT_L(PROFILE_TIMER) - start;
+
+				slot->count++;
+				slot->cycles += cycles;
+				if(cycles > slot->worst) { slot->worst = cycles; }
+			}
+		}
+
+		higher |= slot->mask;
+	}
+}
+
+void irq_init()
+{
+	REG_IME = 0;
+
+	for(u32 x = 0; x < IRQ_SOURCES; x++)
+	{
+		irq_table[x].mask = irq_priority[x];
+		irq_table[x].nested = false;
+		irq_table[x].handler = NULL;
+		irq_table[x].count = 0;
+		irq_table[x].cycles = 0;
+		irq_table[x].worst = 0;
+	}
+
+	//PROFILE_TIMER free-runs at the CPU clock for handler cycle accounting
+	timer_reserve(PROFILE_TIMER, TIMER_OWNER_PROFILER);
+	timer_start(PROFILE_TIMER, 0, TIMER_START);
+
+	IRQ_VECTOR = (u32)irq_dispatch;
+
+	//VBlank drives the frame counter and the state machine tick
+	IO_H[2] |= 0x8;
+	irq_set(IRQ_VBLANK, vblank_handler, false);
+
+	REG_IF = 0xFFFF;
+	REG_IME = 1;
+}
+
+void irq_set(u16 mask, irq_handler handler, bool nested)
+{
+	for(u32 x = 0; x < IRQ_SOURCES; x++)
+	{
+		if(irq_table[x].mask == mask)
+		{
+			irq_table[x].handler = handler;
+			irq_table[x].nested = nested;
+			REG_IE |= mask;
+			return;
+		}
+	}
+}
+
+void irq_profile(struct irq_profile* out, u32 max)
+{
+	//Sources with a handler in priority order, unused entries are zeroed
+	u32 n = 0;
+	u16 ime = REG_IME;
+
+	REG_IME = 0;
+
+	for(u32 x = 0; (x < IRQ_SOURCES) && (n < max); x++)
+	{
+		const struct irq_slot* slot = &irq_table[x];
+		if(!slot->handler) { continue; }
+
+		out[n].mask = slot->mask;
+		out[n].worst = slot->worst;
+		out[n].count = slot->count;
+		out[n].cycles = slot->cycles;
+		n++;
+	}
+
+	REG_IME = ime;
+
+	for(; n < max; n++)
+	{
+		out[n].mask = 0;
+		out[n].worst = 0;
+		out[n].count = 0;
+		out[n].cycles = 0;
+	}
+}
+
+u16 irq_suspend()
+{
+	//Hand the interrupt lines to a polled path (Joybus), dispatcher stays installed
+	u16 ie = REG_IE;
+
+	REG_IME = 0;
+	REG_IE = 0;
+
+	return ie;
+}
+
+void irq_resume(u16 ie)
+{
+	REG_IF = 0xFFFF;
+	REG_IE = ie;
+	REG_IME = 1;
+}
+
+void wait_vblank_irq()
+{
+	VBlankIntrWait();
+}
@@ -0,0 +1,59 @@
+#ifndef GBA_IRQ_H
+#define GBA_IRQ_H
+
+#include <gba_types.h>
+
+#define IRQ_VECTOR (*(vu32*)0x03007FFC)
+#define BIOS_IF    (*(vu16*)0x03007FF8)
+
+//Number of interrupt sources in REG_IE/REG_IF
+#define IRQ_SOURCES 14
+
+/*
+  Sources are serviced in a fixed priority order, SERIAL first, then the
+  timers used by the Joybus path. A handler registered as nested runs with
+  IRQs re-enabled, but only sources above it in that order may preempt it.
+
+  Joybus bit capture itself never runs through the dispatcher. Send mode
+  calls irq_suspend() and polls SERIAL/TIMER/KEYPAD through CustomHalt
+  with IME off, so no handler can add jitter to a command or response.
+  VBlank may wake that wait until a command begins, which is how the send
+  screen hands each frame back to the state machine; the session counts
+  those frames in frame_count itself.
+  Everything else (VBlank, keypad, UI timers) is dispatched between sessions.
+*/
+
+typedef void (*irq_handler)();
+
+struct irq_slot
+{
+	u16 mask;
+	bool nested;
+	irq_handler handler;
+
+	//Cycle accounting (PROFILE_TIMER ticks, includes any nested handlers)
+	u32 count;
+	u32 cycles;
+	u16 worst;
+};
+
+//Accounting of one source with a handler, as copied out by irq_profile()
+struct irq_profile
+{
+	u16 mask;
+	u16 worst;
+	u32 count;
+	u32 cycles;
+};
+
+extern struct irq_slot irq_table[IRQ_SOURCES];
+extern volatile u32 frame_count;
+
+void irq_init();
+void irq_set(u16 mask, irq_handler handler, bool nested);
+void irq_profile(struct irq_profile* out, u32 max);
+u16 irq_suspend();
+void irq_resume(u16 ie);
+void wait_vblank_irq();
+
+#endif /* GBA_IRQ_H */
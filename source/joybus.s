@@ -0,0 +1,282 @@
+@ Joybus engine, the timing critical half of si.arm.c.
+@
+@ Everything here runs from IWRAM in ARM state, where every instruction has
+@ a fixed cost independent of the compiler: data processing 1 cycle,
+@ ldr/ldrh/ldrb 3, str/strh/strb 2 (IO and IWRAM have no wait states),
+@ taken branch 3, untaken 1. Comments give [cycle] at the start of each
+@ instruction relative to the marked reference point.
+
+#include "si.h"
+#include "timers.h"
+
+	.equ	IO_TIMERS,	0x04000100
+	.equ	IO_IRQ,		0x04000200
+
+	@ Offsets from IO_TIMERS
+	.equ	TM_BIT_L,	(SI_TIMER_BIT * 4)
+	.equ	TM_BIT_H,	(SI_TIMER_BIT * 4) + 2
+	.equ	TM_PROFILE_L,	(PROFILE_TIMER * 4)
+	.equ	KEYCNT,		0x32
+	.equ	RCNT,		0x34
+
+	@ Offsets from IO_IRQ
+	.equ	IE,		0x00
+	.equ	IF,		0x02
+
+	.equ	TIMER_START,	0x80
+	.equ	TIMER_IRQ,	0x40
+	.equ	IRQ_VBLANK,	0x0001
+	.equ	IRQ_SERIAL,	0x0080
+	.equ	IRQ_KEYPAD,	0x1000
+
+	.equ	GPIO_SI,	0x04
+	.equ	GPIO_SO,	0x08
+	.equ	GPIO_SO_IO,	0x80
+
+	@ BIOS Halt/Stop entry taking the mode in r2, see CustomHalt in bios.h
+	.equ	BIOS_CUSTOM_HALT, 0x1AC
+
+.macro	DELAY cycles
+	.rept	\cycles
+	nop
+	.endr
+.endm
+
+	.section .iwram, "ax", %progbits
+	.syntax unified
+	.arm
+	.align	2
+
+@ void SISetResponse(const void *buf, unsigned bits)
+@ void SISetResponse8(uint8_t *buf, unsigned bits)
+@
+@ Sends bits (at least 1) MSB first, then the stop bit.
+@ In:  r0 = buffer, r1 = bit count
+@ Loop registers:
+@   r0  next byte to load        r4  bits left in the current byte, with a marker bit below them
+@   r1  bits left to send        r5  level for the middle of the bit
+@   r2  IO_TIMERS                r6  byte loaded ahead
+@   r3  line low                 r12 line high
+@
+@ A 4us bit is 67 cycles: low for 18, the bit's level for 36, high for 13.
+@ The next byte is loaded on every bit and only taken on the 8th, so each
+@ bit costs the same no matter where it falls in the byte.
+
+	.global	SISetResponse
+	.global	SISetResponse8
+	.type	SISetResponse, %function
+	.type	SISetResponse8, %function
+SISetResponse:
+SISetResponse8:
+	push	{r4-r6}
+
+	ldr	r2, =IO_TIMERS
+	ldrh	r3, [r2, #TM_PROFILE_L]
+	ldr	r12, =si_timing
+	strh	r3, [r12, #SI_TIMING_TX_START]
+
+	mov	r3, #GPIO_SO_IO
+	mov	r12, #(GPIO_SO_IO | GPIO_SO)
+
+	ldrb	r4, [r0], #1
+	mov	r4, r4, lsl #24
+	orr	r4, r4, #0x00800000
+
+1:	strb	r3, [r2, #RCNT]			@ 2  [0]   every bit starts low
+	movs	r4, r4, lsl #1			@ 1  [2]   C = bit to send
+	movcs	r5, r12				@ 1  [3]   1: high after 1us
+	movcc	r5, r3				@ 1  [4]   0: low for 3us
+	DELAY	13				@ 13 [5]
+	strb	r5, [r2, #RCNT]			@ 2  [18]
+	DELAY	34				@ 34 [20]
+	strb	r12, [r2, #RCNT]		@ 2  [54]  every bit ends high
+	ldrb	r6, [r0]			@ 3  [56]
+	cmp	r4, #0x80000000			@ 1  [59]  only the marker left
+	addeq	r0, r0, #1			@ 1  [60]
+	moveq	r4, r6, lsl #24			@ 1  [61]
+	orreq	r4, r4, #0x00800000		@ 1  [62]
+	subs	r1, r1, #1			@ 1  [63]
+	bne	1b				@ 3  [64]
+
+	@ Stop bit, low for 1us then released
+	DELAY	2				@ 2  [65]
+	strb	r3, [r2, #RCNT]			@ 2  [0]
+	DELAY	16				@ 16 [2]
+	strb	r12, [r2, #RCNT]		@ 2  [18]
+
+	pop	{r4-r6}
+	bx	lr
+
+	.size	SISetResponse, . - SISetResponse
+	.size	SISetResponse8, . - SISetResponse8
+
+@ int si_receive(void *buf, unsigned bits)
+@
+@ Captures one command, ending on the bit timeout, on bits (at least 1)
+@ being reached, or on B. With IRQ_VBLANK in IE, the start of VBlank also
+@ ends the wait as long as no bit has arrived; the first bit takes it out
+@ of IE again so it can never delay the wake for a later one.
+@ In:  r0 = buffer (unused with SI_CAPTURE_OVERSAMPLE, levels go to si_raw)
+@      r1 = bit limit
+@ Out: r0 = bits captured, SI_ABORT if B was pressed, SI_VBLANK on VBlank,
+@      SI_LATE if a bit was already pending on entry (captured to the end, not counted)
+@      si_rx = calibration sum, bit timeout, PROFILE_TIMER at the last bit
+@      and IRQ_SERIAL if a bit was pending on entry
+@ Loop registers:
+@   r0  buffer write pointer     r6  bit timeout in cycles
+@   r1  bit limit                r7  calibration sum
+@   r2  halt mode, scratch       r8  PROFILE_TIMER at the last bit
+@   r3  IF at the last wake      r9  IO_TIMERS
+@   r4  bits captured            r10 bit timer at the last wake
+@   r5  byte being assembled     r11 IO_IRQ
+@       (si_raw in SI_CAPTURE_OVERSAMPLE builds)
+@   r12, lr scratch, both clobbered by the BIOS halt
+
+	.global	si_receive
+	.type	si_receive, %function
+si_receive:
+	push	{r4-r11, lr}
+
+	ldr	r9, =IO_TIMERS
+	ldr	r11, =IO_IRQ
+	mov	r4, #0
+	mov	r5, #0
+	mov	r6, #SI_BIT_TIMEOUT_MAX
+	mov	r7, #0
+	mov	r8, #0
+#ifdef SI_CAPTURE_OVERSAMPLE
+	ldr	r5, =si_raw
+#endif
+
+	@ Stop the bit timer, arm the uncalibrated timeout and drop stale requests.
+	@ SI_TIMER_IDLE keeps running, the caller restarts it once per command
+	mov	r2, #0
+	strh	r2, [r9, #TM_BIT_H]
+	rsb	r2, r6, #0
+	strh	r2, [r9, #TM_BIT_L]
+	ldrh	r3, [r11, #IF]
+	strh	r3, [r11, #IF]
+
+	@ A bit pending here came before the wait did, so the command's first bits are gone
+	and	r2, r3, #IRQ_SERIAL
+	ldr	r12, =si_rx
+	strh	r2, [r12, #SI_RX_LATE]
+
+	@ B raises the keypad IRQ, which wakes the halt like any bit would
+	mov	r2, #0x4000
+	orr	r2, r2, #0x0002
+	strh	r2, [r9, #KEYCNT]
+
+1:	@ Drop to STOP once the idle timer has expired
+	tst	r3, #TIMER_IRQ_MASK(SI_TIMER_IDLE)
+	movne	r2, #0x80
+	moveq	r2, #0x00
+	mov	lr, pc
+	mov	pc, #BIOS_CUSTOM_HALT
+
+	@ Woken, [0] is the first instruction after the BIOS returns
+	ldrh	r10, [r9, #TM_BIT_L]		@ 3  [0]
+	mov	r2, #0				@ 1  [3]
+	strh	r2, [r9, #TM_BIT_H]		@ 2  [4]
+	ldrh	r3, [r11, #IF]			@ 3  [6]
+	strh	r3, [r11, #IF]			@ 2  [9]
+	mov	r2, #(TIMER_START | TIMER_IRQ)	@ 1  [11]
+	strh	r2, [r9, #TM_BIT_H]		@ 2  [12]
+	tst	r3, #IRQ_SERIAL			@ 1  [14]
+	beq	3f				@ 1  [15]
+
+#ifdef SI_CAPTURE_OVERSAMPLE
+	@ Five reads 3 cycles apart, packed once they are all in
+	ldrh	r2, [r9, #RCNT]			@ 3  [16]
+	ldrh	r12, [r9, #RCNT]		@ 3  [19]
+	ldrh	lr, [r9, #RCNT]			@ 3  [22]
+	ldrh	r8, [r9, #RCNT]			@ 3  [25]
+	ldrh	r0, [r9, #RCNT]			@ 3  [28]
+	and	r2, r2, #GPIO_SI
+	and	r12, r12, #GPIO_SI
+	orr	r2, r2, r12, lsl #1
+	and	lr, lr, #GPIO_SI
+	orr	r2, r2, lr, lsl #2
+	and	r8, r8, #GPIO_SI
+	orr	r2, r2, r8, lsl #3
+	and	r0, r0, #GPIO_SI
+	orr	r2, r2, r0, lsl #4
+	mov	r2, r2, lsr #2			@ GPIO_SI is bit 2
+	strb	r2, [r5, r4]
+	add	r4, r4, #1
+	ldrh	r8, [r9, #TM_PROFILE_L]
+#else
+	@ Three reads OR'd, a single high read counts as a 1
+	ldrh	r2, [r9, #RCNT]			@ 3  [16]
+	ldrh	r12, [r9, #RCNT]		@ 3  [19]
+	orr	r2, r2, r12			@ 1  [22]
+	ldrh	r12, [r9, #RCNT]		@ 3  [23]
+	orr	r2, r2, r12			@ 1  [26]
+	ldrh	r8, [r9, #TM_PROFILE_L]		@ 3  [27]
+	tst	r2, #GPIO_SI
+	mov	r5, r5, lsl #1
+	orrne	r5, r5, #1
+	add	r4, r4, #1
+	tst	r4, #7
+	strbeq	r5, [r0], #1
+#endif
+
+	@ Every restart happens the same wake latency after an edge, so restart to restart is one bit period
+	cmp	r4, #SI_CALIBRATE_FIRST
+	bls	6f
+	cmp	r4, #SI_CALIBRATE_LAST
+	bhi	2f
+	add	r10, r10, r6
+	mov	r10, r10, lsl #16
+	add	r7, r7, r10, lsr #16
+	bne	2f
+	mov	r6, r7, lsr #2
+	add	r6, r6, #SI_BIT_JITTER
+	rsb	r2, r6, #0
+	strh	r2, [r9, #TM_BIT_L]
+
+2:	cmp	r4, r1
+	blo	1b
+	b	4f
+
+3:	@ No bit: the command is over, B was pressed, or VBlank began before the command
+	tst	r3, #TIMER_IRQ_MASK(SI_TIMER_BIT)
+	bne	4f
+	tst	r3, #IRQ_KEYPAD
+	mvnne	r0, #0				@ SI_ABORT
+	bne	5f
+	tst	r3, #IRQ_VBLANK
+	beq	2b
+	cmp	r4, #0
+	bne	2b
+	mvn	r0, #1				@ SI_VBLANK
+
+5:	mov	r2, #0
+	strh	r2, [r9, #KEYCNT]
+	pop	{r4-r11, lr}
+	bx	lr
+
+6:	@ The first bit is in, VBlank no longer ends the wait. Bit 1 skips calibration, so this costs about what bit 5 does
+	ldrh	r2, [r11, #IE]
+	bic	r2, r2, #IRQ_VBLANK
+	strh	r2, [r11, #IE]
+	b	2b
+
+4:	mov	r2, #0
+	strh	r2, [r9, #KEYCNT]
+
+	ldr	r2, =si_rx
+	strh	r7, [r2, #SI_RX_SUM]
+	strh	r6, [r2, #SI_RX_TIMEOUT]
+	strh	r8, [r2, #SI_RX_EDGE]
+
+	mov	r0, r4
+	ldrh	r3, [r2, #SI_RX_LATE]
+	cmp	r3, #0
+	mvnne	r0, #2				@ SI_LATE
+	pop	{r4-r11, lr}
+	bx	lr
+
+	.size	si_receive, . - si_receive
+
+	.ltorg
@@ -1,5 +1,4 @@
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <gba_dma.h>
 #include <gba_input.h>
@@ -9,15 +8,19 @@
 
 #include "bios.h"
 #include "common.h"
-
-#include "main_screen.h"
-#include "send_screen.h"
-#include "edit_screen_1.h"
-#include "edit_screen_2.h"
-#include "edit_screen_3.h"
-#include "edit_screen_4.h"
+#include "hexview.h"
+#include "idle.h"
+#include "input.h"
+#include "irq.h"
+#include "si.h"
+#include "stats.h"
+#include "timers.h"
+#include "state.h"
+#include "telemetry.h"
+#include "trace.h"
+
+#include "backgrounds.h"
 #include "highlight.h"
-#include "font_kana.h"
 #include "font_num.h"
 #include "cursor.h"
 
@@ -25,10 +28,28 @@
 #define ROM_GPIODATA *((int16_t *)0x080000C4)
 #define ROM_GPIODIR  *((int16_t *)0x080000C6)
 #define ROM_GPIOCNT  *((int16_t *)0x080000C8)
-#define SAVE_DATA    *((uint8_t *)0x0E000000)
+
+//Frames the main menu can be left alone before it sleeps in Stop (2 minutes)
+#define MAIN_SLEEP_FRAMES (60 * 60 * 2)
+
+//Tag of the timing block in the debug view
+#define PROFILE_TAG 0x50
+
+//IRQ sources with a handler shown in the timing block
+#define PROFILE_IRQS 2
+
+//Only the line, its timers, B and (until a command begins) VBlank may wake si_receive
+#define SESSION_IRQS (IRQ_SERIAL | TIMER_IRQ_MASK(SI_TIMER_IDLE) | TIMER_IRQ_MASK(SI_TIMER_COUNT) | TIMER_IRQ_MASK(SI_TIMER_BIT) | IRQ_KEYPAD | IRQ_VBLANK)
 
 //#define ANALOG
 
+enum {
+	STATE_MAIN,
+	STATE_EDIT,
+	STATE_SEND,
+	STATES
+};
+
 enum {
 	CMD_ID = 0x00,
 	CMD_STATUS = 0x40,
@@ -36,7 +57,8 @@ enum {
 	CMD_RESET = 0xFF
 };
 
-static struct {
+//Constant ID reply, encoded once and kept in IWRAM so it goes out without any setup
+static IWRAM_DATA struct {
 	uint8_t type[2];
 
 	struct {
@@ -45,7 +67,18 @@ static struct {
 		uint8_t origin : 1;
 		uint8_t        : 2;
 	} status;
-} id;
+} id = { { 0x08, 0x02 }, { 0 } };
+
+typedef void (*command_func)(int length);
+
+//Joybus opcode handler, bits is the exact frame length including the stop bit (0 = any length)
+struct command
+{
+	u8 opcode;
+	u16 bits;
+	u8 stat;
+	command_func handle;
+};
 
 struct
 {
@@ -54,6 +87,29 @@ struct
 	u32 y;
 } screen_cursor;
 
+//Send session, open from the first send frame until B, with IRQs suspended throughout
+static struct
+{
+	bool open;
+
+	//The wait for the next command has begun, VBlank only paused it
+	bool waiting;
+
+	//IRQs to restore once the session ends
+	u16 ie;
+
+	//VCOUNT at the last check for the start of VBlank
+	u8 line;
+} session;
+
+//Copy of the timing counters, taken when the debug view opens it so it holds still while scrolling
+static struct
+{
+	struct screen_profile screen;
+	struct irq_profile irq[PROFILE_IRQS];
+	struct state_timing states[STATES];
+} profile;
+
 struct
 {
 	u8 state;
@@ -61,36 +117,107 @@ struct
 	u32 y;
 } highlight_cursor;
 
-u8 program_state = 0;
+struct
+{
+	u8 page;
+	u8 page_x;
+	u8 page_y;
+	bool update;
+	bool update_all;
+	u32 last_x;
+	u32 last_y;
+	u32 drawn_value[6];
+} edit;
+
+struct edit_field
+{
+	u8 offset;
+	u8 bytes;
+	u8 digits;
+};
+
 u8 data_state = 0;
+u32 main_idle_frames = 0;
 u8 page_limit[4][6];
 int poll_length = 0;
 
+//Counters on edit pages 1-3, stored big-endian in reply_buffer
+const struct edit_field counter_fields[3][6] =
+{
+	{ { 12, 3, 6 }, { 15, 3, 6 }, { 21, 2, 5 }, { 23, 3, 6 }, { 26, 3, 6 }, { 29, 3, 6 } },
+	{ { 32, 3, 6 }, { 35, 3, 6 }, { 38, 3, 6 }, { 41, 3, 6 }, { 44, 3, 6 }, { 47, 3, 6 } },
+	{ { 50, 3, 6 }, { 53, 3, 6 }, { 56, 3, 6 }, { 59, 3, 6 }, { 62, 3, 6 }, { 65, 3, 6 } }
+};
+
+//Pages 1-3 are stored as the rectangles where they differ from page 0, page_map holds the expanded page being shown
+const struct screen_delta page_bg[4] =
+{
+	{ edit_screen_1, NULL, NULL, 0 },
+	{ EDIT_SCREEN_2_BASE, edit_screen_2_rects, edit_screen_2_patch, EDIT_SCREEN_2_RECTS },
+	{ EDIT_SCREEN_3_BASE, edit_screen_3_rects, edit_screen_3_patch, EDIT_SCREEN_3_RECTS },
+	{ EDIT_SCREEN_4_BASE, edit_screen_4_rects, edit_screen_4_patch, EDIT_SCREEN_4_RECTS }
+};
+
+u16 page_map[SCREEN_TILES_W * SCREEN_TILES_H];
+
 static uint8_t buffer[128];
 static uint8_t last_cmd_data[128];
 static uint8_t reply_buffer[80];
 static uint8_t status_buffer[8];
 static uint8_t poll_buffer[80];
 
-void SISetResponse(const void *buf, unsigned bits);
-void SISetResponse8(uint8_t *buf, unsigned bits);
-int SIGetCommand(void *buf, unsigned bits);
+void main_enter();
+void main_frame();
+void edit_enter();
+void edit_frame();
+void send_enter();
+void send_frame();
+void debug_view_frame();
+void open_profile_view();
+
+void command_init();
+void command_id(int length);
+void command_data(int length);
+void command_status(int length);
+
+void reset_edit_page();
+bool draw_page_job(u32 step);
+bool redraw_main_job(u32 step);
+
+u32 read_field(const struct edit_field* field);
+void write_field(const struct edit_field* field, u32 value);
+u32 counter_step();
+u32 step_counter(u32 value, u32 step, bool up, u32 limit);
+
+//Slot 0 catches every opcode without a handler, kept in IWRAM with the dispatch loop
+IWRAM_DATA struct command commands[] =
+{
+	{ 0x00, 0, STATS_OP_UNKNOWN, NULL },
+	{ CMD_ID, 9, STATS_OP_ID, command_id },
+	{ CMD_RESET, 9, STATS_OP_RESET, command_id },
+	{ CMD_STATUS, 0, STATS_OP_STATUS, command_status },
+	{ CMD_DATA, 0, STATS_OP_DATA, command_data }
+};
 
-void main_screen_idle();
-void send_data_idle();
-void edit_data_idle();
-void show_data_idle();
+//Opcode to commands[] slot, filled in by command_init()
+IWRAM_DATA u8 command_slot[256];
 
-int main()
+//Screens, indexed by program_state
+const struct state screen_states[] =
 {
-	for(u8 x = 0; x < 80; x++)
-	{
-		reply_buffer[x] = 0;
-		poll_buffer[x] = 0;
-	}
+	{ main_enter, main_frame, NULL, 68 },
+	{ edit_enter, edit_frame, NULL, 68 },
+	{ send_enter, send_frame, NULL, 0, true }
+};
 
-	//Do some initial setup
+int main()
+{
+	//Do some initial setup, the buffers are already zeroed by crt0
 	setup();
+	irq_init();
+	stats_load();
+	command_init();
+	si_capture_init();
 
 	//Page up edit page cursor limits
 	page_limit[0][0] = 5;
@@ -122,1223 +249,725 @@ int main()
 	page_limit[3][5] = 5;
 
 
-	screen_cursor.state = 0;
-	screen_cursor.x = 90;
-	screen_cursor.y = 75;
+	//D-Pad scrolls at a steady rate while held
+	set_key_repeat(KEY_UP | KEY_DOWN | KEY_LEFT | KEY_RIGHT, KEY_REPEAT_DELAY, KEY_REPEAT_RATE);
 
 	//Grab input, change some graphics and data in response, and grab and send JoyBus data
-	while(true)
+	run_states(screen_states, STATE_MAIN);
+}
+
+void command_init()
+{
+	for(u32 x = 0; x < 256; x++) { command_slot[x] = 0; }
+	for(u8 x = 1; x < (sizeof(commands) / sizeof(commands[0])); x++) { command_slot[commands[x].opcode] = x; }
+}
+
+void IWRAM_CODE command_id(int length)
+{
+	SISetResponse(&id, sizeof(id) * 8);
+	telemetry.ids++;
+	stats.responses++;
+}
+
+void IWRAM_CODE command_data(int length)
+{
+	bool ping_pattern = true;
+
+	//Check for Ping Pattern
+	for(u8 x = 1; x < 7; x++)
 	{
-		switch(program_state)
-		{
-			case 0: main_screen_idle(); break;
-			case 1: edit_data_idle(); break;
-			case 2: send_data_idle(); break;
-			case 3: show_data_idle(); break;
-			case 4: show_poll_idle(); break;
-		}
+		if(buffer[x] != 0xFF) { ping_pattern = false; }
+	}
+
+	if(buffer[0x4E] != 0x06) { ping_pattern = false; }
+	if(buffer[0x4F] != 0x5A) { ping_pattern = false; }
+
+	//Return current data when detecting the ping pattern
+	if(ping_pattern)
+	{
+		SISetResponse8(reply_buffer, (sizeof(reply_buffer) * 8));
+		for(u8 x = 0; x < 128; x++) { last_cmd_data[x] = buffer[x]; }
+		telemetry.pings++;
+		stats.pings++;
+		stats.responses++;
+	}
+
+	//Update data when ping pattern is not detected
+	//Also return updated data
+	else
+	{
+		for(u8 x = 1; x < 0x0C; x++) { reply_buffer[x] = buffer[x]; }
+		SISetResponse8(reply_buffer, (sizeof(reply_buffer) * 8));
+		telemetry.writes++;
+		stats.writes++;
+		stats.responses++;
 	}
 }
 
-void IWRAM_CODE wait_for_signal()
+void IWRAM_CODE command_status(int length)
 {
-	bool waiting = true;
+	poll_length = length;
+	for(u8 x = 0; x < poll_length; x++) { poll_buffer[x] = buffer[x]; }
+	telemetry.statuses++;
+}
 
-	REG_IE = IRQ_SERIAL | IRQ_TIMER2 | IRQ_TIMER1 | IRQ_TIMER0 | IRQ_KEYPAD;
+void IWRAM_CODE session_begin()
+{
+	//Joybus capture is polled, keep every other IRQ handler out of the way
+	session.ie = irq_suspend();
+
+	//The Joybus timers are fixed, anything still holding them is a bug
+	timer_cascade(SI_TIMER_BIT, TIMER_OWNER_JOYBUS);
+	timer_reserve(SI_TIMER_IDLE, TIMER_OWNER_JOYBUS);
+
+	REG_IE = SESSION_IRQS;
 	REG_IF = REG_IF;
 
 	REG_RCNT = R_GPIO | 0x100 | GPIO_SO_IO | GPIO_SO;
 
-	REG_TM0CNT_L = -67;
-	REG_TM1CNT_H = TIMER_START | TIMER_IRQ | TIMER_COUNT;
-	REG_TM0CNT_H = TIMER_START;
+	TIMER_CNT_L(SI_TIMER_BIT) = -SI_BIT_TIMEOUT_MAX;
+	TIMER_CNT_H(SI_TIMER_COUNT) = TIMER_START | TIMER_IRQ | TIMER_COUNT;
+	TIMER_CNT_H(SI_TIMER_BIT) = TIMER_START;
 
 	SoundBias(0);
 	Halt();
 
-	while(waiting)
+	telemetry_reset();
+	si_timing_reset();
+	stats.sessions++;
+
+	//Background work only runs in the idle time between commands
+	idle_reset();
+	idle_register(telemetry_draw_job, TELEMETRY_DRAW_CYCLES);
+	idle_register(stats_save_job, IDLE_COPY_CYCLES);
+#ifdef TRACE
+	idle_register(trace_save_job, IDLE_COPY_CYCLES);
+#endif
+
+	session.open = true;
+	session.waiting = false;
+	session.line = IO_H[3];
+}
+
+void IWRAM_CODE session_end()
+{
+	//The idle jobs only keep SRAM roughly current, finish with a full copy
+	stats_save();
+	TRACE_SAVE();
+
+	timer_release(SI_TIMER_BIT, TIMER_OWNER_JOYBUS);
+	timer_release(SI_TIMER_COUNT, TIMER_OWNER_JOYBUS);
+	timer_release(SI_TIMER_IDLE, TIMER_OWNER_JOYBUS);
+
+	irq_resume(session.ie);
+	session.open = false;
+}
+
+bool IWRAM_CODE vblank_passed()
+{
+	//Whether the line counter has run past the start of VBlank since the last check, checks are less than a frame apart
+	u8 line = IO_H[3];
+	u8 to_vblank = ((160 + 227 - session.line) % 228) + 1;
+	u8 elapsed = (line + 228 - session.line) % 228;
+
+	session.line = line;
+	return (elapsed >= to_vblank);
+}
+
+bool IWRAM_CODE session_frame()
+{
+	//Serve commands until VBlank starts, or return false once B ends the session
+	while(true)
 	{
-		int length = SIGetCommand(buffer, sizeof(buffer) * 8 + 1);
+		//A command and its reply can run into VBlank, where the wake is masked, so the line counter is checked too
+		if(vblank_passed()) { break; }
 
-		if(length == -1) { waiting = false; }
-		else if (length < 9) { continue; }
+		//A wait cut short by VBlank goes on where it was, without restarting the idle timer
+		if(!session.waiting)
+		{
+			idle_command_start();
+			session.waiting = true;
+		}
 
-		bool ping_pattern = true;
+		REG_IE = SESSION_IRQS;
+		int length = SIGetCommand(buffer, sizeof(buffer) * 8 + 1);
 
-		switch(buffer[0])
+		if(length == SI_VBLANK)
 		{
-			case CMD_RESET:
-			case CMD_ID:
-				if(length == 9)
-				{
-					id.type[0] = 0x08;
-					id.type[1] = 0x02;
-					SISetResponse(&id, sizeof(id) * 8);
-				}
+			session.line = IO_H[3];
+			break;
+		}
 
-				break;
+		session.waiting = false;
+		idle_command_end();
 
-			case CMD_DATA:
-				//Check for Ping Pattern
-				for(u8 x = 1; x < 7; x++)
-				{
-					if(buffer[x] != 0xFF) { ping_pattern = false; }
-				}
+		//Keypad abort, the buffer holds nothing new
+		if(length == SI_ABORT)
+		{
+			stats.aborts++;
+			return false;
+		}
 
-				if(buffer[0x4E] != 0x06) { ping_pattern = false; }
-				if(buffer[0x4F] != 0x5A) { ping_pattern = false; }
+		//Missing its first bits, the rest would decode as some other command
+		if(length == SI_LATE)
+		{
+			stats.late++;
+			continue;
+		}
 
-				//Return current data when detecting the ping pattern
-				if(ping_pattern)
-				{
-					SISetResponse8(reply_buffer, (sizeof(reply_buffer) * 8));
-					for(u8 x = 0; x < 128; x++) { last_cmd_data[x] = buffer[x]; }
-				}
+		stats.frames++;
+		stats.lengths[((length >> STATS_LENGTH_SHIFT) < STATS_LENGTH_BINS) ? (length >> STATS_LENGTH_SHIFT) : (STATS_LENGTH_BINS - 1)]++;
+		if((u32)length > stats.max_bits) { stats.max_bits = length; }
 
-				//Update data when ping pattern is not detected
-				//Also return updated data
-				else
-				{
-					for(u8 x = 1; x < 0x0C; x++) { reply_buffer[x] = buffer[x]; }
-					SISetResponse8(reply_buffer, (sizeof(reply_buffer) * 8));
-				}
-					
-				break;
+		if(length < 9)
+		{
+			stats.short_frames++;
+			continue;
+		}
 
-			case CMD_STATUS:
-				poll_length = length;
-				for(u8 x = 0; x < poll_length; x++) { poll_buffer[x] = buffer[x]; }
-				break;
+		u32 responses = stats.responses;
+		const struct command* command = &commands[command_slot[buffer[0]]];
 
-			default:
-				break;
+		stats.opcodes[command->stat]++;
 
+		//Frames of the wrong length for their opcode are counted but never answered
+		if(command->bits && (length != command->bits)) { stats.length_mismatch++; }
+		else if(command->handle)
+		{
+			TRACE_BEGIN(TRACE_SI_RESPONSE, buffer[0]);
+			command->handle(length);
+			TRACE_END(TRACE_SI_RESPONSE, stats.responses - responses);
 		}
-	}
 
-	REG_IE = 0;
-	program_state = 0;
+		if(stats.responses != responses) { stats_latency(); }
+
+		//Any edge from here on is the next command's, si_receive reports it late if it comes before the wait
+		REG_IF = IRQ_SERIAL;
 
-	fade_out(4);
+		telemetry.last_cmd = buffer[0];
+		telemetry_gap();
 
+		idle_run();
+	}
+
+	//The VBlank IRQ is off for the whole session, so the frame is counted here
+	frame_count++;
+	telemetry_frame();
+	return true;
+}
+
+void main_enter()
+{
 	screen_cursor.state = 0;
 	screen_cursor.x = 90;
 	screen_cursor.y = 75;
+	main_idle_frames = 0;
+
+	video_compose(MAIN_SCREEN_PALETTE);
+	draw_screen(main_screen);
+	draw_bitmap_cc(cursor, CURSOR_SIZE, screen_cursor.x, screen_cursor.y, CURSOR_WIDTH, 0x7FFF);
+
+	//Enable BG2
+	video_present();
+}
 
-	wait_frames(1);
-	draw_bitmap(main_screen, main_screen_size, 0, 0, 240);
-	
-	wait_frames(1);
-	draw_bitmap_cc(cursor, cursor_size, screen_cursor.x, screen_cursor.y, 16, 0x7FFF);
+bool redraw_main_job(u32 step)
+{
+	//Redraw the background on one frame and the cursor on the next
+	if(step == 0)
+	{
+		video_compose(MAIN_SCREEN_PALETTE);
+		draw_screen(main_screen);
+		return false;
+	}
 
-	fade_in(4);
+	draw_bitmap_cc(cursor, CURSOR_SIZE, screen_cursor.x, screen_cursor.y, CURSOR_WIDTH, 0x7FFF);
+	video_present();
+	return true;
 }
 
-void main_screen_idle()
+void main_frame()
 {
+	//Sleep once nothing has been touched for a while, the wake key is swallowed
+	if(input.held) { main_idle_frames = 0; }
+	else if(++main_idle_frames >= MAIN_SLEEP_FRAMES)
+	{
+		sleep_until_key();
+		main_idle_frames = 0;
+		return;
+	}
+
+	//The debug view sits on top of the menu and takes all input while open
+	if(hexview.active)
+	{
+		debug_view_frame();
+		return;
+	}
+
 	//Move cursor up
-	if(((IO_H[152] & 0x40) == 0) && (screen_cursor.state > 0))
+	if((input.repeat & KEY_UP) && (screen_cursor.state > 0))
 	{
 		screen_cursor.state--;
 		screen_cursor.y -= 28;
-
-		wait_frames(1);
-		draw_bitmap(main_screen, main_screen_size, 0, 0, 240);
-	
-		wait_frames(1);
-		draw_bitmap_cc(cursor, cursor_size, screen_cursor.x, screen_cursor.y, 16, 0x7FFF);
+		schedule_job(redraw_main_job);
 	}
 
 	//Move cursor down
-	else if(((IO_H[152] & 0x80) == 0) && (screen_cursor.state < 1))
+	else if((input.repeat & KEY_DOWN) && (screen_cursor.state < 1))
 	{
 		screen_cursor.state++;
 		screen_cursor.y += 28;
-
-		wait_frames(1);
-		draw_bitmap(main_screen, main_screen_size, 0, 0, 240);
-	
-		wait_frames(1);
-		draw_bitmap_cc(cursor, cursor_size, screen_cursor.x, screen_cursor.y, 16, 0x7FFF);
+		schedule_job(redraw_main_job);
 	}
 
 	//Edit data when pressing A
-	else if(((IO_H[152] & 0x01) == 0) && (screen_cursor.state == 0))
+	else if((input.pressed & KEY_A) && (screen_cursor.state == 0))
 	{
-		program_state = 1;
+		change_state(STATE_EDIT, true);
 	}
 
 	//Send data when pressing A
-	else if(((IO_H[152] & 0x01) == 0) && (screen_cursor.state == 1))
+	else if((input.pressed & KEY_A) && (screen_cursor.state == 1))
 	{
-		program_state = 2;
+		change_state(STATE_SEND, true);
 	}
 
 	//Show last 0x40 data sent to GBA when pressing L
-	else if((IO_H[152] & 0x200) == 0)
+	else if(input.pressed & KEY_L)
 	{
-		consoleDemoInit();
-		printf("0x40 data sent to GBA:\n");
-		printf("Length = %d\n", poll_length);
-
-		for(u8 x = 0, y = 0; x < poll_length; x++)
-		{
-			printf("%02x ", poll_buffer[x]);
-			y++;
-
-			if(y == 8)
-			{
-				y = 0;
-				printf("\n");
-			}
-		}
-
-		program_state = 4;
+		hexview_open(CMD_STATUS, poll_buffer, poll_length);
 	}
 
 	//Show last CMD_DATA sent to GBA when pressing R
-	else if((IO_H[152] & 0x100) == 0)
+	else if(input.pressed & KEY_R)
 	{
-		consoleDemoInit();
-		printf("CMD_DATA sent to GBA:\n\n");
-
-		for(u8 x = 0, y = 0; x < 128; x++)
-		{
-			printf("%02x ", last_cmd_data[x]);
-			y++;
-
-			if(y == 8)
-			{
-				y = 0;
-				printf("\n");
-			}
-		}
+		hexview_open(CMD_DATA, last_cmd_data, sizeof(last_cmd_data));
+	}
 
-		program_state = 3;
+	//Show Joybus statistics when pressing Select
+	else if(input.pressed & KEY_SELECT)
+	{
+		hexview_open(STATS_TAG, (const u8*)&stats, sizeof(stats));
 	}
 
-	wait_frames(1);
+	//Show timing counters when pressing Start
+	else if(input.pressed & KEY_START)
+	{
+		open_profile_view();
+	}
 }
 
-void edit_data_idle()
+void open_profile_view()
 {
-	highlight_cursor.x = 128;
-	highlight_cursor.y = 18;
-	highlight_cursor.state = 0;
+	profile.screen = screen_profile;
+	irq_profile(profile.irq, PROFILE_IRQS);
+	for(u32 x = 0; x < STATES; x++) { profile.states[x] = state_timing[x]; }
 
-	u8 index = 0;
-	u8 page_x = 0;
-	u8 page_y = 0;
-	u8 page = 0;
+	hexview_open(PROFILE_TAG, (const u8*)&profile, sizeof(profile));
+}
 
-	//Draw edit data screen (Page 0)
-	fade_out(4);
+void debug_view_frame()
+{
+	//Close and restore the menu when pressing B
+	if(input.pressed & KEY_B)
+	{
+		hexview_close(main_screen);
+		draw_bitmap_cc(cursor, CURSOR_SIZE, screen_cursor.x, screen_cursor.y, CURSOR_WIDTH, 0x7FFF);
+		return;
+	}
 
-	wait_frames(1);
-	draw_bitmap(edit_screen_1, edit_screen_1_size, 0, 0, 240);
+	//Switch between the last 0x40 and CMD_DATA buffers with L/R, statistics with Select
+	else if(input.pressed & KEY_L) { hexview_open(CMD_STATUS, poll_buffer, poll_length); }
+	else if(input.pressed & KEY_R) { hexview_open(CMD_DATA, last_cmd_data, sizeof(last_cmd_data)); }
+	else if(input.pressed & KEY_SELECT) { hexview_open(STATS_TAG, (const u8*)&stats, sizeof(stats)); }
 
-	wait_frames(1);
-	draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
+	//Clear the statistics with Start while they are shown
+	else if((input.pressed & KEY_START) && (hexview.tag == STATS_TAG))
+	{
+		stats_clear();
+		stats_save();
+		hexview_open(STATS_TAG, (const u8*)&stats, sizeof(stats));
+	}
 
-	fade_in(4);
+	//Otherwise Start shows the timing counters, or takes a fresh copy of them
+	else if(input.pressed & KEY_START) { open_profile_view(); }
 
-	bool waiting = true;
-	bool update = true;
-	bool update_all = true;
+	//Scroll with Up/Down
+	else if(input.repeat & KEY_UP) { hexview_scroll(-1); }
+	else if(input.repeat & KEY_DOWN) { hexview_scroll(1); }
 
-	u32 last_x = 0;
-	u32 last_y = 0;
+	hexview_frame();
+}
 
-	u32 temp24 = 0;
+void reset_edit_page()
+{
+	edit.update = true;
+	edit.update_all = true;
 
-	while(waiting)
-	{
-		//Exit when pressing B
-		if((IO_H[152] & 0x02) == 0) { waiting = false; }
+	highlight_cursor.x = 128;
+	highlight_cursor.y = 18;
+	edit.page_x = 0;
+	edit.page_y = 0;
+	edit.last_x = 0;
+	edit.last_y = 0;
+}
 
-		//Increase page when pressing R
-		else if((IO_H[152] & 0x100) == 0)
-		{
-			page++;
-			if(page > 4) { page = 0; }
+bool draw_page_job(u32 step)
+{
+	//Pages share most of their tiles, so only the labels and whatever was drawn over the old page are redrawn
+	//In Mode 4 this is the hidden frame, the draw pass in edit_frame on the next frame adds the values and presents it
+	video_compose(EDIT_SCREEN_1_PALETTE);
+	build_screen(page_map, &page_bg[edit.page]);
+	draw_screen_changes(page_map);
+	return true;
+}
 
-			update = true;
-			update_all = true;
+void edit_enter()
+{
+	highlight_cursor.state = 0;
+	edit.page = 0;
+	reset_edit_page();
 
-			highlight_cursor.x = 128;
-			highlight_cursor.y = 18;
-			page_x = 0;
-			page_y = 0;
-			last_x = 0;
-			last_y = 0;
+	//Draw edit data screen (Page 0)
+	video_compose(EDIT_SCREEN_1_PALETTE);
+	build_screen(page_map, &page_bg[0]);
+	draw_screen(page_map);
+}
 
-			wait_frames(1);
-			
-			switch(page)
-			{
-				case 0: draw_bitmap(edit_screen_1, edit_screen_1_size, 0, 0, 240); break;
-				case 1: draw_bitmap(edit_screen_2, edit_screen_2_size, 0, 0, 240); break;
-				case 2: draw_bitmap(edit_screen_3, edit_screen_3_size, 0, 0, 240); break;
-				case 3: draw_bitmap(edit_screen_4, edit_screen_4_size, 0, 0, 240); break;
-			}
+void edit_frame()
+{
+	//Exit when pressing B
+	if(input.pressed & KEY_B) { change_state(STATE_MAIN, true); }
 
-			wait_frames(1);
-			draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
-		}
+	//Increase page when pressing R
+	else if(input.pressed & KEY_R)
+	{
+		edit.page++;
+		if(edit.page > 3) { edit.page = 0; }
 
-		//Decrease page when pressing L
-		else if((IO_H[152] & 0x200) == 0)
-		{
-			page--;
-			if(page > 4) { page = 3; }
+		reset_edit_page();
+		schedule_job(draw_page_job);
+	}
 
-			update = true;
-			update_all = true;
+	//Decrease page when pressing L
+	else if(input.pressed & KEY_L)
+	{
+		edit.page--;
+		if(edit.page > 3) { edit.page = 3; }
 
-			highlight_cursor.x = 128;
-			highlight_cursor.y = 18;
-			page_x = 0;
-			page_y = 0;
-			last_x = 0;
-			last_y = 0;
-			wait_frames(1);
-			
-			switch(page)
-			{
-				case 0: draw_bitmap(edit_screen_1, edit_screen_1_size, 0, 0, 240); break;
-				case 1: draw_bitmap(edit_screen_2, edit_screen_2_size, 0, 0, 240); break;
-				case 2: draw_bitmap(edit_screen_3, edit_screen_3_size, 0, 0, 240); break;
-				case 3: draw_bitmap(edit_screen_4, edit_screen_4_size, 0, 0, 240); break;
-			}
+		reset_edit_page();
+		schedule_job(draw_page_job);
+	}
 
-			wait_frames(1);
-			draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
-		}
+	//Change data value when pressing UP or DOWN
+	else if(input.repeat & (KEY_UP | KEY_DOWN))
+	{
+		edit.update = true;
 
-		//Change data value when pressing UP or DOWN
-		else if(((IO_H[152] & 0x40) == 0) || ((IO_H[152] & 0x80) == 0))
+		//Page 0
+		if(edit.page == 0)
 		{
-			update = true;
-
-			//Page 0
-			if(page == 0)
+			switch(edit.page_y)
 			{
-				switch(page_y)
-				{
-					//Name
-					case 0:
-						if((IO_H[152] & 0x40) == 0) { reply_buffer[page_x + 1]++; }
-						else { reply_buffer[page_x + 1]--; }
-						break;
+				//Name
+				case 0:
+					//Only characters the font has a glyph for
+					reply_buffer[edit.page_x + 1] = kana_step(reply_buffer[edit.page_x + 1], (input.repeat & KEY_UP) ? 1 : -1);
+					break;
 
-					//Age
-					case 1:
-						if((IO_H[152] & 0x40) == 0) { reply_buffer[0x07]++; }
-						else { reply_buffer[0x07]--; }
-						break;
+				//Age
+				case 1:
+					if(input.repeat & KEY_UP) { reply_buffer[0x07]++; }
+					else { reply_buffer[0x07]--; }
+					break;
 
-					//Height
-					case 2:
-						if((IO_H[152] & 0x40) == 0) { reply_buffer[0x08]++; }
-						else { reply_buffer[0x08]--; }
-						break;
+				//Height
+				case 2:
+					if(input.repeat & KEY_UP) { reply_buffer[0x08]++; }
+					else { reply_buffer[0x08]--; }
+					break;
 
-					//Weight
-					case 3:
-						if((IO_H[152] & 0x40) == 0) { reply_buffer[0x09]++; }
-						else { reply_buffer[0x09]--; }
-						break;
+				//Weight
+				case 3:
+					if(input.repeat & KEY_UP) { reply_buffer[0x09]++; }
+					else { reply_buffer[0x09]--; }
+					break;
 
-					//Sex
-					case 4:
-						if((IO_H[152] & 0x40) == 0) { reply_buffer[0x0A]++; }
-						else { reply_buffer[0x0A]--; }
-						if(reply_buffer[0x0A] > 2) { reply_buffer[0x0A] = 0; }
-						break;
+				//Sex
+				case 4:
+					if(input.repeat & KEY_UP) { reply_buffer[0x0A]++; }
+					else { reply_buffer[0x0A]--; }
+					if(reply_buffer[0x0A] > 2) { reply_buffer[0x0A] = 0; }
+					break;
 
-					//Step Size
-					case 5:
-						if((IO_H[152] & 0x40) == 0) { reply_buffer[0x0B]++; }
-						else { reply_buffer[0x0B]--; }
-						break;
-						
-				}
+				//Step Size
+				case 5:
+					if(input.repeat & KEY_UP) { reply_buffer[0x0B]++; }
+					else { reply_buffer[0x0B]--; }
+					break;
+					
 			}
+		}
 
-			//Page 1
-			else if(page == 1)
-			{
-				switch(page_y)
-				{
-					//Total Steps
-					case 0:
-						index = 12;
-						break;
-
-					//Total Meters
-					case 1:
-						index = 15;
-						break;
-
-					//Total Days
-					case 2:
-						temp24 = ((reply_buffer[21] << 8) | (reply_buffer[22]));
-
-						if((IO_H[152] & 0x40) == 0) { temp24 += 5; }
-						else { temp24 -= 5; }
-
-						reply_buffer[21] = (temp24 >> 8);
-						reply_buffer[22] = temp24;
+		//Pages 1-3 (counters)
+		else
+		{
+			const struct edit_field* field = &counter_fields[edit.page - 1][edit.page_y];
+			u32 limit = (field->bytes == 3) ? 999995 : 65535;
 
-						break;
+			write_field(field, step_counter(read_field(field), counter_step(), (input.repeat & KEY_UP), limit));
+		}
+	}
 
-					//Steps Today
-					case 3:
-						index = 23;
-						break;
+	//Change edit position of current item when pressing LEFT or RIGHT
+	else if(input.repeat & (KEY_RIGHT | KEY_LEFT))
+	{
+		edit.update = true;
 
-					//Kcal Burned Today
-					case 4:
-						index = 26;
-						break;
+		if(input.repeat & KEY_RIGHT)
+		{
+			edit.page_x++;
+			highlight_cursor.x += 18;
+		}
+			
+		else
+		{
+			edit.page_x--;
+			highlight_cursor.x -= 18;
+		}
 
-					//Steps Yesterday
-					case 5:
-						index = 29;
-						break;
-				}
+		if(edit.page_x == 0xFF)
+		{
+			edit.page_x = 0;
+			highlight_cursor.x = 128;
+		}
 
-				if(page_y != 2)
-				{
-					temp24 = ((reply_buffer[index] << 16) | (reply_buffer[index + 1] << 8) | (reply_buffer[index + 2]));
+		else if(edit.page_x > page_limit[edit.page][edit.page_y])
+		{
+			edit.page_x = page_limit[edit.page][edit.page_y];
+			highlight_cursor.x = 128 + (18 * page_limit[edit.page][edit.page_y]);
+		}
+	}
 
-					if((IO_H[152] & 0x40) == 0) { temp24 += 5; }
-					else { temp24 -= 5; }
+	//Cycle through edit items when pressing A
+	else if(input.pressed & KEY_A)
+	{
+		edit.update = true;
 
-					if(temp24 == 1000000) { temp24 = 0; }
-					else if(temp24 > 999995) { temp24 = 999995; }
+		//Page 0, 1
+		if((edit.page == 0) || (edit.page == 1) || (edit.page == 2) || (edit.page == 3))
+		{
+			edit.page_y++;
+			edit.page_x = 0;
 
-					reply_buffer[index] = (temp24 >> 16);
-					reply_buffer[index + 1] = (temp24 >> 8);
-					reply_buffer[index + 2] = temp24;
-				}
-			}
+			highlight_cursor.y += 19;
+			highlight_cursor.x = 128;
 
-			//Page 2
-			else if(page == 2)
+			if(edit.page_y == 6)
 			{
-				switch(page_y)
-				{
-					//Steps 2 Days Ago
-					case 0:
-						index = 32;
-						break;
+				edit.page_y = 0;
+				highlight_cursor.y = 18;
+			}
+		}
+	}
 
-					//Steps 3 Days Ago
-					case 1:
-						index = 35;
-						break;
+	//Draw Pages, after draw_page_job has put a new page down so it does not paint over the values
+	if(edit.update && !jobs_pending())
+	{
+		u8 update_id = (edit.page_y * 6) + edit.page_x;
 
-					//Steps 4 Days Ago
-					case 2:
-						index = 38;
-						break;
+		switch(edit.page)
+		{
+			//PAGE 0
+			case 0:
+				//Clear highlight data and draw new one
+				clear_highlight(edit_screen_1, edit.last_x, edit.last_y);
+				draw_bitmap_cc(highlight, HIGHLIGHT_SIZE, highlight_cursor.x, highlight_cursor.y, HIGHLIGHT_WIDTH, 0x7FFF);
+
+				//Update all entries when switching pages
+				if(edit.update_all)
+				{
+					edit.update_all = false;
 
-					//Steps 5 Days Ago
-					case 3:
-						index = 41;
-						break;
+					draw_kana(reply_buffer[1], 129, 19);
+					draw_kana(reply_buffer[2], 147, 19);
+					draw_kana(reply_buffer[3], 165, 19);
+					draw_kana(reply_buffer[4], 183, 19);
+					draw_kana(reply_buffer[5], 201, 19);
+					draw_kana(reply_buffer[6], 219, 19);
 
-					//Steps 6 Days Ago
-					case 4:
-						index = 44;
-						break;
+					draw_font_cc(font_num, (reply_buffer[7] / 100), 129, 38, 0x7FFF);
+					draw_font_cc(font_num, ((reply_buffer[7] / 10) % 10), 147, 38, 0x7FFF);
+					draw_font_cc(font_num, (reply_buffer[7] % 10), 165, 38, 0x7FFF);
 
-					//Steps 7 Days Ago
-					case 5:
-						index = 47;
-						break;
-				}
+					draw_font_cc(font_num, (reply_buffer[8] / 100), 129, 57, 0x7FFF);
+					draw_font_cc(font_num, ((reply_buffer[8] / 10) % 10), 147, 57, 0x7FFF);
+					draw_font_cc(font_num, (reply_buffer[8] % 10), 165, 57, 0x7FFF);
 
-				temp24 = ((reply_buffer[index] << 16) | (reply_buffer[index + 1] << 8) | (reply_buffer[index + 2]));
+					draw_font_cc(font_num, (reply_buffer[9] / 100), 129, 76, 0x7FFF);
+					draw_font_cc(font_num, ((reply_buffer[9] / 10) % 10), 147, 76, 0x7FFF);
+					draw_font_cc(font_num, (reply_buffer[9] % 10), 165, 76, 0x7FFF);
 
-				if((IO_H[152] & 0x40) == 0) { temp24 += 5; }
-				else { temp24 -= 5; }
+					if(!reply_buffer[10]) { draw_kana(0, 129, 95); }
+					else if(reply_buffer[10] == 1) { draw_kana(0xCD, 129, 95); } 
+					else { draw_kana(0xC6, 129, 95); }
 
-				if(temp24 == 1000000) { temp24 = 0; }
-				else if(temp24 > 999995) { temp24 = 999995; }
+					draw_font_cc(font_num, (reply_buffer[11] / 100), 129, 114, 0x7FFF);
+					draw_font_cc(font_num, ((reply_buffer[11] / 10) % 10), 147, 114, 0x7FFF);
+					draw_font_cc(font_num, (reply_buffer[11] % 10), 165, 114, 0x7FFF);
 
-				reply_buffer[index] = (temp24 >> 16);
-				reply_buffer[index + 1] = (temp24 >> 8);
-				reply_buffer[index + 2] = temp24;
-			}
+					break;
+				}
 
-			//Page 3
-			else if(page == 3)
-			{
-				switch(page_y)
+				//Update specific entries
+				switch(update_id)
 				{
-					//Kcal Burned 1 Day Ago
-					case 0:
-						index = 50;
-						break;
-
-					//Kcal Burned 2 Days Ago
-					case 1:
-						index = 53;
+					case 0: clear_char(edit_screen_1, 129, 19); draw_kana(reply_buffer[1], 129, 19); break;
+					case 1: clear_char(edit_screen_1, 147, 19); draw_kana(reply_buffer[2], 147, 19); break;
+					case 2: clear_char(edit_screen_1, 165, 19); draw_kana(reply_buffer[3], 165, 19); break;
+					case 3: clear_char(edit_screen_1, 183, 19); draw_kana(reply_buffer[4], 183, 19); break;
+					case 4: clear_char(edit_screen_1, 201, 19); draw_kana(reply_buffer[5], 201, 19); break;
+					case 5: clear_char(edit_screen_1, 219, 19); draw_kana(reply_buffer[6], 219, 19); break;
+
+					case 6:
+					case 7:
+					case 8:
+						clear_char(edit_screen_1, 129, 38); draw_font_cc(font_num, (reply_buffer[7] / 100), 129, 38, 0x7FFF);
+						clear_char(edit_screen_1, 147, 38); draw_font_cc(font_num, ((reply_buffer[7] / 10) % 10), 147, 38, 0x7FFF);
+						clear_char(edit_screen_1, 165, 38); draw_font_cc(font_num, (reply_buffer[7] % 10), 165, 38, 0x7FFF);
 						break;
 
-					//Kcal Burned 3 Days Ago
-					case 2:
-						index = 56;
+					case 12:
+					case 13:
+					case 14:
+						clear_char(edit_screen_1, 129, 57); draw_font_cc(font_num, (reply_buffer[8] / 100), 129, 57, 0x7FFF);
+						clear_char(edit_screen_1, 147, 57); draw_font_cc(font_num, ((reply_buffer[8] / 10) % 10), 147, 57, 0x7FFF);
+						clear_char(edit_screen_1, 165, 57); draw_font_cc(font_num, (reply_buffer[8] % 10), 165, 57, 0x7FFF);
 						break;
 
-					//Kcal Burned 4 Days Ago
-					case 3:
-						index = 59;
+					case 18:
+					case 19:
+					case 20:
+						clear_char(edit_screen_1, 129, 76); draw_font_cc(font_num, (reply_buffer[9] / 100), 129, 76, 0x7FFF);
+						clear_char(edit_screen_1, 147, 76); draw_font_cc(font_num, ((reply_buffer[9] / 10) % 10), 147, 76, 0x7FFF);
+						clear_char(edit_screen_1, 165, 76); draw_font_cc(font_num, (reply_buffer[9] % 10), 165, 76, 0x7FFF);
 						break;
 
-					//Kcal Burned 5 Days Ago
-					case 4:
-						index = 62;
+					case 24:
+						clear_char(edit_screen_1, 129, 95);
+						if(!reply_buffer[10]) { draw_kana(0, 129, 95); }
+						else if(reply_buffer[10] == 1) { draw_kana(0xCD, 129, 95); } 
+						else { draw_kana(0xC6, 129, 95); }
 						break;
 
-					//Kcal Burned 6 Days Ago
-					case 5:
-						index = 65;
+					case 30:
+					case 31:
+					case 32:
+						clear_char(edit_screen_1, 129, 114); draw_font_cc(font_num, (reply_buffer[11] / 100), 129, 114, 0x7FFF);
+						clear_char(edit_screen_1, 147, 114); draw_font_cc(font_num, ((reply_buffer[11] / 10) % 10), 147, 114, 0x7FFF);
+						clear_char(edit_screen_1, 165, 114); draw_font_cc(font_num, (reply_buffer[11] % 10), 165, 114, 0x7FFF);
 						break;
 				}
 
-				temp24 = ((reply_buffer[index] << 16) | (reply_buffer[index + 1] << 8) | (reply_buffer[index + 2]));
-
-				if((IO_H[152] & 0x40) == 0) { temp24 += 5; }
-				else { temp24 -= 5; }
-
-				if(temp24 == 1000000) { temp24 = 0; }
-				else if(temp24 > 999995) { temp24 = 999995; }
-
-				reply_buffer[index] = (temp24 >> 16);
-				reply_buffer[index + 1] = (temp24 >> 8);
-				reply_buffer[index + 2] = temp24;
-			}
-		}
-
-		//Change edit position of current item when pressing LEFT or RIGHT
-		else if(((IO_H[152] & 0x10) == 0) || ((IO_H[152] & 0x20) == 0))
-		{
-			update = true;
-
-			if((IO_H[152] & 0x10) == 0)
-			{
-				page_x++;
-				highlight_cursor.x += 18;
-			}
-				
-			else
-			{
-				page_x--;
-				highlight_cursor.x -= 18;
-			}
-
-			if(page_x == 0xFF)
-			{
-				page_x = 0;
-				highlight_cursor.x = 128;
-			}
-
-			else if(page_x > page_limit[page][page_y])
-			{
-				page_x = page_limit[page][page_y];
-				highlight_cursor.x = 128 + (18 * page_limit[page][page_y]);
-			}
-
-			wait_frames(30);
-		}
-
-		//Cycle through edit items when pressing A
-		else if((IO_H[152] & 0x01) == 0)
-		{
-			update = true;
-
-			//Page 0, 1
-			if((page == 0) || (page == 1) || (page == 2) || (page == 3))
-			{
-				page_y++;
-				page_x = 0;
+				break;
 
-				highlight_cursor.y += 19;
-				highlight_cursor.x = 128;
+			//PAGES 1-3
+			default:
+				//Clear highlight data and draw new one
+				clear_highlight(page_map, edit.last_x, edit.last_y);
+				draw_bitmap_cc(highlight, HIGHLIGHT_SIZE, highlight_cursor.x, highlight_cursor.y, HIGHLIGHT_WIDTH, 0x7FFF);
 
-				if(page_y == 6)
+				//Only redraw the digits of counters that changed since the last frame
+				for(u8 y = 0; y < 6; y++)
 				{
-					page_y = 0;
-					highlight_cursor.y = 18;
-				}
-			}
-
-			wait_frames(20);
-		}
-
-		//Draw Pages
-		if(update)
-		{
-			u8 update_id = (page_y * 6) + page_x;
-
-			switch(page)
-			{
-				//PAGE 0
-				case 0:
-					//Clear highlight data and draw new one
-					wait_frames(4);
-					clear_highlight(edit_screen_1, last_x, last_y);
-					draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
-
-					//Update all entries when switching pages
-					if(update_all)
-					{
-						update_all = false;
-
-						draw_font_cc(font_kana, reply_buffer[1], 129, 19, 0x7FFF);
-						draw_font_cc(font_kana, reply_buffer[2], 147, 19, 0x7FFF);
-						draw_font_cc(font_kana, reply_buffer[3], 165, 19, 0x7FFF);
-						draw_font_cc(font_kana, reply_buffer[4], 183, 19, 0x7FFF);
-						draw_font_cc(font_kana, reply_buffer[5], 201, 19, 0x7FFF);
-						draw_font_cc(font_kana, reply_buffer[6], 219, 19, 0x7FFF);
-
-						draw_font_cc(font_num, (reply_buffer[7] / 100), 129, 38, 0x7FFF);
-						draw_font_cc(font_num, ((reply_buffer[7] / 10) % 10), 147, 38, 0x7FFF);
-						draw_font_cc(font_num, (reply_buffer[7] % 10), 165, 38, 0x7FFF);
-
-						draw_font_cc(font_num, (reply_buffer[8] / 100), 129, 57, 0x7FFF);
-						draw_font_cc(font_num, ((reply_buffer[8] / 10) % 10), 147, 57, 0x7FFF);
-						draw_font_cc(font_num, (reply_buffer[8] % 10), 165, 57, 0x7FFF);
+					const struct edit_field* field = &counter_fields[edit.page - 1][y];
+					u32 value = read_field(field);
 
-						draw_font_cc(font_num, (reply_buffer[9] / 100), 129, 76, 0x7FFF);
-						draw_font_cc(font_num, ((reply_buffer[9] / 10) % 10), 147, 76, 0x7FFF);
-						draw_font_cc(font_num, (reply_buffer[9] % 10), 165, 76, 0x7FFF);
-
-						if(!reply_buffer[10]) { draw_font_cc(font_kana, 0, 129, 95, 0x7FFF); }
-						else if(reply_buffer[10] == 1) { draw_font_cc(font_kana, 0xCD, 129, 95, 0x7FFF); } 
-						else { draw_font_cc(font_kana, 0xC6, 129, 95, 0x7FFF); }
-
-						draw_font_cc(font_num, (reply_buffer[11] / 100), 129, 114, 0x7FFF);
-						draw_font_cc(font_num, ((reply_buffer[11] / 10) % 10), 147, 114, 0x7FFF);
-						draw_font_cc(font_num, (reply_buffer[11] % 10), 165, 114, 0x7FFF);
-
-						break;
-					}
-
-					//Update specific entries
-					switch(update_id)
+					if(edit.update_all || (value != edit.drawn_value[y]))
 					{
-						case 0: clear_char(edit_screen_1, 129, 19); draw_font_cc(font_kana, reply_buffer[1], 129, 19, 0x7FFF); break;
-						case 1: clear_char(edit_screen_1, 147, 19); draw_font_cc(font_kana, reply_buffer[2], 147, 19, 0x7FFF); break;
-						case 2: clear_char(edit_screen_1, 165, 19); draw_font_cc(font_kana, reply_buffer[3], 165, 19, 0x7FFF); break;
-						case 3: clear_char(edit_screen_1, 183, 19); draw_font_cc(font_kana, reply_buffer[4], 183, 19, 0x7FFF); break;
-						case 4: clear_char(edit_screen_1, 201, 19); draw_font_cc(font_kana, reply_buffer[5], 201, 19, 0x7FFF); break;
-						case 5: clear_char(edit_screen_1, 219, 19); draw_font_cc(font_kana, reply_buffer[6], 219, 19, 0x7FFF); break;
-
-						case 6:
-						case 7:
-						case 8:
-							clear_char(edit_screen_1, 129, 38); draw_font_cc(font_num, (reply_buffer[7] / 100), 129, 38, 0x7FFF);
-							clear_char(edit_screen_1, 147, 38); draw_font_cc(font_num, ((reply_buffer[7] / 10) % 10), 147, 38, 0x7FFF);
-							clear_char(edit_screen_1, 165, 38); draw_font_cc(font_num, (reply_buffer[7] % 10), 165, 38, 0x7FFF);
-							break;
-
-						case 12:
-						case 13:
-						case 14:
-							clear_char(edit_screen_1, 129, 57); draw_font_cc(font_num, (reply_buffer[8] / 100), 129, 57, 0x7FFF);
-							clear_char(edit_screen_1, 147, 57); draw_font_cc(font_num, ((reply_buffer[8] / 10) % 10), 147, 57, 0x7FFF);
-							clear_char(edit_screen_1, 165, 57); draw_font_cc(font_num, (reply_buffer[8] % 10), 165, 57, 0x7FFF);
-							break;
-
-						case 18:
-						case 19:
-						case 20:
-							clear_char(edit_screen_1, 129, 76); draw_font_cc(font_num, (reply_buffer[9] / 100), 129, 76, 0x7FFF);
-							clear_char(edit_screen_1, 147, 76); draw_font_cc(font_num, ((reply_buffer[9] / 10) % 10), 147, 76, 0x7FFF);
-							clear_char(edit_screen_1, 165, 76); draw_font_cc(font_num, (reply_buffer[9] % 10), 165, 76, 0x7FFF);
-							break;
-
-						case 24:
-							clear_char(edit_screen_1, 129, 95);
-							if(!reply_buffer[10]) { draw_font_cc(font_kana, 0, 129, 95, 0x7FFF); }
-							else if(reply_buffer[10] == 1) { draw_font_cc(font_kana, 0xCD, 129, 95, 0x7FFF); } 
-							else { draw_font_cc(font_kana, 0xC6, 129, 95, 0x7FFF); }
-							break;
-
-						case 30:
-						case 31:
-						case 32:
-							clear_char(edit_screen_1, 129, 114); draw_font_cc(font_num, (reply_buffer[11] / 100), 129, 114, 0x7FFF);
-							clear_char(edit_screen_1, 147, 114); draw_font_cc(font_num, ((reply_buffer[11] / 10) % 10), 147, 114, 0x7FFF);
-							clear_char(edit_screen_1, 165, 114); draw_font_cc(font_num, (reply_buffer[11] % 10), 165, 114, 0x7FFF);
-							break;
+						draw_number(page_map, value, edit.drawn_value[y], field->digits, 129, 19 + (y * 19), edit.update_all);
+						edit.drawn_value[y] = value;
 					}
+				}
 
-					break;
-
-				//PAGE 1
-				case 1:
-					//Clear highlight data and draw new one
-					wait_frames(1);
-					clear_highlight(edit_screen_2, last_x, last_y);
-					draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
-
-					//Update all entries when switching pages
-					if(update_all)
-					{
-						update_all = false;
-
-						temp24 = ((reply_buffer[12] << 16) | (reply_buffer[13] << 8) | (reply_buffer[14]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 19, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 19, 0x7FFF);
-
-						temp24 = ((reply_buffer[15] << 16) | (reply_buffer[16] << 8) | (reply_buffer[17]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 38, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 38, 0x7FFF);
-
-						temp24 = ((reply_buffer[21] << 8) | (reply_buffer[22]));
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 129, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 147, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 165, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 183, 57, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 201, 57, 0x7FFF);
-
-						temp24 = ((reply_buffer[23] << 16) | (reply_buffer[24] << 8) | (reply_buffer[25]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 76, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 76, 0x7FFF);
-
-						temp24 = ((reply_buffer[26] << 16) | (reply_buffer[27] << 8) | (reply_buffer[28]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 95, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 95, 0x7FFF);
-
-						temp24 = ((reply_buffer[29] << 16) | (reply_buffer[30] << 8) | (reply_buffer[31]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 114, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 114, 0x7FFF);
-
-						break;
-					}
-
-					//Update specific entries
-					switch(update_id)
-					{
-						case 0:
-						case 1:
-						case 2:
-						case 3:
-						case 4:
-						case 5:
-							temp24 = ((reply_buffer[12] << 16) | (reply_buffer[13] << 8) | (reply_buffer[14]));
-							clear_char(edit_screen_2, 129, 19); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 19, 0x7FFF);
-							clear_char(edit_screen_2, 147, 19); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 19, 0x7FFF);
-							clear_char(edit_screen_2, 165, 19); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 19, 0x7FFF);
-							clear_char(edit_screen_2, 183, 19); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 19, 0x7FFF);
-							clear_char(edit_screen_2, 201, 19); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 19, 0x7FFF);
-							clear_char(edit_screen_2, 219, 19); draw_font_cc(font_num, (temp24 % 10), 219, 19, 0x7FFF);
-
-							break;
-
-						case 6:
-						case 7:
-						case 8:
-						case 9:
-						case 10:
-						case 11:
-							temp24 = ((reply_buffer[15] << 16) | (reply_buffer[16] << 8) | (reply_buffer[17]));
-							clear_char(edit_screen_2, 129, 38); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 38, 0x7FFF);
-							clear_char(edit_screen_2, 147, 38); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 38, 0x7FFF);
-							clear_char(edit_screen_2, 165, 38); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 38, 0x7FFF);
-							clear_char(edit_screen_2, 183, 38); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 38, 0x7FFF);
-							clear_char(edit_screen_2, 201, 38); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 38, 0x7FFF);
-							clear_char(edit_screen_2, 219, 38); draw_font_cc(font_num, (temp24 % 10), 219, 38, 0x7FFF);
-
-							break;
-
-						case 12:
-						case 13:
-						case 14:
-						case 15:
-						case 16:
-							temp24 = ((reply_buffer[21] << 8) | (reply_buffer[22]));
-							clear_char(edit_screen_2, 129, 57); draw_font_cc(font_num, ((temp24 / 10000) % 10), 129, 57, 0x7FFF);
-							clear_char(edit_screen_2, 147, 57); draw_font_cc(font_num, ((temp24 / 1000) % 10), 147, 57, 0x7FFF);
-							clear_char(edit_screen_2, 165, 57); draw_font_cc(font_num, ((temp24 / 100) % 10), 165, 57, 0x7FFF);
-							clear_char(edit_screen_2, 183, 57); draw_font_cc(font_num, ((temp24 / 10) % 10), 183, 57, 0x7FFF);
-							clear_char(edit_screen_2, 201, 57); draw_font_cc(font_num, (temp24 % 10), 201, 57, 0x7FFF);
-
-							break;
-
-						case 18:
-						case 19:
-						case 20:
-						case 21:
-						case 22:
-						case 23:
-							temp24 = ((reply_buffer[23] << 16) | (reply_buffer[24] << 8) | (reply_buffer[25]));
-							clear_char(edit_screen_2, 129, 76); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 76, 0x7FFF);
-							clear_char(edit_screen_2, 147, 76); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 76, 0x7FFF);
-							clear_char(edit_screen_2, 165, 76); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 76, 0x7FFF);
-							clear_char(edit_screen_2, 183, 76); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 76, 0x7FFF);
-							clear_char(edit_screen_2, 201, 76); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 76, 0x7FFF);
-							clear_char(edit_screen_2, 219, 76); draw_font_cc(font_num, (temp24 % 10), 219, 76, 0x7FFF);
-
-							break;
-
-						case 24:
-						case 25:
-						case 26:
-						case 27:
-						case 28:
-						case 29:
-							temp24 = ((reply_buffer[26] << 16) | (reply_buffer[27] << 8) | (reply_buffer[28]));
-							clear_char(edit_screen_2, 129, 95); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 95, 0x7FFF);
-							clear_char(edit_screen_2, 147, 95); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 95, 0x7FFF);
-							clear_char(edit_screen_2, 165, 95); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 95, 0x7FFF);
-							clear_char(edit_screen_2, 183, 95); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 95, 0x7FFF);
-							clear_char(edit_screen_2, 201, 95); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 95, 0x7FFF);
-							clear_char(edit_screen_2, 219, 95); draw_font_cc(font_num, (temp24 % 10), 219, 95, 0x7FFF);
-
-							break;
-
-						case 30:
-						case 31:
-						case 32:
-						case 33:
-						case 34:
-						case 35:
-							temp24 = ((reply_buffer[29] << 16) | (reply_buffer[30] << 8) | (reply_buffer[31]));
-							clear_char(edit_screen_2, 129, 114); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 114, 0x7FFF);
-							clear_char(edit_screen_2, 147, 114); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 114, 0x7FFF);
-							clear_char(edit_screen_2, 165, 114); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 114, 0x7FFF);
-							clear_char(edit_screen_2, 183, 114); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 114, 0x7FFF);
-							clear_char(edit_screen_2, 201, 114); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 114, 0x7FFF);
-							clear_char(edit_screen_2, 219, 114); draw_font_cc(font_num, (temp24 % 10), 219, 114, 0x7FFF);
-
-							break;
-					}
-
-					break;
-
-				//PAGE 2
-				case 2:
-					//Clear highlight data and draw new one
-					wait_frames(1);
-					clear_highlight(edit_screen_3, last_x, last_y);
-					draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
-
-					//Update all entries when switching pages
-					if(update_all)
-					{
-						update_all = false;
-
-						temp24 = ((reply_buffer[32] << 16) | (reply_buffer[33] << 8) | (reply_buffer[34]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 19, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 19, 0x7FFF);
-
-						temp24 = ((reply_buffer[35] << 16) | (reply_buffer[36] << 8) | (reply_buffer[37]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 38, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 38, 0x7FFF);
-
-						temp24 = ((reply_buffer[38] << 16) | (reply_buffer[39] << 8) | (reply_buffer[40]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 57, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 57, 0x7FFF);
-
-						temp24 = ((reply_buffer[41] << 16) | (reply_buffer[42] << 8) | (reply_buffer[43]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 76, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 76, 0x7FFF);
-
-						temp24 = ((reply_buffer[44] << 16) | (reply_buffer[45] << 8) | (reply_buffer[46]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 95, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 95, 0x7FFF);
-
-						temp24 = ((reply_buffer[47] << 16) | (reply_buffer[48] << 8) | (reply_buffer[49]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 114, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 114, 0x7FFF);
-
-						break;
-					}
-
-					//Update specific entries
-					switch(update_id)
-					{
-						case 0:
-						case 1:
-						case 2:
-						case 3:
-						case 4:
-						case 5:
-							temp24 = ((reply_buffer[32] << 16) | (reply_buffer[33] << 8) | (reply_buffer[34]));
-							clear_char(edit_screen_3, 129, 19); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 19, 0x7FFF);
-							clear_char(edit_screen_3, 147, 19); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 19, 0x7FFF);
-							clear_char(edit_screen_3, 165, 19); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 19, 0x7FFF);
-							clear_char(edit_screen_3, 183, 19); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 19, 0x7FFF);
-							clear_char(edit_screen_3, 201, 19); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 19, 0x7FFF);
-							clear_char(edit_screen_3, 219, 19); draw_font_cc(font_num, (temp24 % 10), 219, 19, 0x7FFF);
-
-							break;
-
-						case 6:
-						case 7:
-						case 8:
-						case 9:
-						case 10:
-						case 11:
-							temp24 = ((reply_buffer[35] << 16) | (reply_buffer[36] << 8) | (reply_buffer[37]));
-							clear_char(edit_screen_3, 129, 38); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 38, 0x7FFF);
-							clear_char(edit_screen_3, 147, 38); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 38, 0x7FFF);
-							clear_char(edit_screen_3, 165, 38); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 38, 0x7FFF);
-							clear_char(edit_screen_3, 183, 38); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 38, 0x7FFF);
-							clear_char(edit_screen_3, 201, 38); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 38, 0x7FFF);
-							clear_char(edit_screen_3, 219, 38); draw_font_cc(font_num, (temp24 % 10), 219, 38, 0x7FFF);
-
-							break;
-
-						case 12:
-						case 13:
-						case 14:
-						case 15:
-						case 16:
-							temp24 = ((reply_buffer[38] << 16) | (reply_buffer[39] << 8) | (reply_buffer[40]));
-							clear_char(edit_screen_3, 129, 57); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 57, 0x7FFF);
-							clear_char(edit_screen_3, 147, 57); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 57, 0x7FFF);
-							clear_char(edit_screen_3, 165, 57); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 57, 0x7FFF);
-							clear_char(edit_screen_3, 183, 57); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 57, 0x7FFF);
-							clear_char(edit_screen_3, 201, 57); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 57, 0x7FFF);
-							clear_char(edit_screen_3, 219, 57); draw_font_cc(font_num, (temp24 % 10), 219, 57, 0x7FFF);
-
-							break;
-
-						case 18:
-						case 19:
-						case 20:
-						case 21:
-						case 22:
-						case 23:
-							temp24 = ((reply_buffer[41] << 16) | (reply_buffer[42] << 8) | (reply_buffer[43]));
-							clear_char(edit_screen_3, 129, 76); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 76, 0x7FFF);
-							clear_char(edit_screen_3, 147, 76); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 76, 0x7FFF);
-							clear_char(edit_screen_3, 165, 76); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 76, 0x7FFF);
-							clear_char(edit_screen_3, 183, 76); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 76, 0x7FFF);
-							clear_char(edit_screen_3, 201, 76); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 76, 0x7FFF);
-							clear_char(edit_screen_3, 219, 76); draw_font_cc(font_num, (temp24 % 10), 219, 76, 0x7FFF);
-
-							break;
-
-						case 24:
-						case 25:
-						case 26:
-						case 27:
-						case 28:
-						case 29:
-							temp24 = ((reply_buffer[44] << 16) | (reply_buffer[45] << 8) | (reply_buffer[46]));
-							clear_char(edit_screen_3, 129, 95); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 95, 0x7FFF);
-							clear_char(edit_screen_3, 147, 95); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 95, 0x7FFF);
-							clear_char(edit_screen_3, 165, 95); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 95, 0x7FFF);
-							clear_char(edit_screen_3, 183, 95); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 95, 0x7FFF);
-							clear_char(edit_screen_3, 201, 95); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 95, 0x7FFF);
-							clear_char(edit_screen_3, 219, 95); draw_font_cc(font_num, (temp24 % 10), 219, 95, 0x7FFF);
-
-							break;
-
-						case 30:
-						case 31:
-						case 32:
-						case 33:
-						case 34:
-						case 35:
-							temp24 = ((reply_buffer[47] << 16) | (reply_buffer[48] << 8) | (reply_buffer[49]));
-							clear_char(edit_screen_3, 129, 114); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 114, 0x7FFF);
-							clear_char(edit_screen_3, 147, 114); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 114, 0x7FFF);
-							clear_char(edit_screen_3, 165, 114); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 114, 0x7FFF);
-							clear_char(edit_screen_3, 183, 114); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 114, 0x7FFF);
-							clear_char(edit_screen_3, 201, 114); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 114, 0x7FFF);
-							clear_char(edit_screen_3, 219, 114); draw_font_cc(font_num, (temp24 % 10), 219, 114, 0x7FFF);
-
-							break;
-					}
-
-					break;
-
-				//PAGE 3
-				case 3:
-					//Clear highlight data and draw new one
-					wait_frames(1);
-					clear_highlight(edit_screen_4, last_x, last_y);
-					draw_bitmap_cc(highlight, highlight_size, highlight_cursor.x, highlight_cursor.y, 18, 0x7FFF);
-
-					//Update all entries when switching pages
-					if(update_all)
-					{
-						update_all = false;
-
-						temp24 = ((reply_buffer[50] << 16) | (reply_buffer[51] << 8) | (reply_buffer[52]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 19, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 19, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 19, 0x7FFF);
-
-						temp24 = ((reply_buffer[53] << 16) | (reply_buffer[54] << 8) | (reply_buffer[55]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 38, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 38, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 38, 0x7FFF);
-
-						temp24 = ((reply_buffer[56] << 16) | (reply_buffer[57] << 8) | (reply_buffer[58]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 57, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 57, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 57, 0x7FFF);
-
-						temp24 = ((reply_buffer[59] << 16) | (reply_buffer[60] << 8) | (reply_buffer[61]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 76, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 76, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 76, 0x7FFF);
-
-						temp24 = ((reply_buffer[62] << 16) | (reply_buffer[63] << 8) | (reply_buffer[64]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 95, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 95, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 95, 0x7FFF);
-
-						temp24 = ((reply_buffer[65] << 16) | (reply_buffer[67] << 8) | (reply_buffer[68]));
-						draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 114, 0x7FFF);
-						draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 114, 0x7FFF);
-						draw_font_cc(font_num, (temp24 % 10), 219, 114, 0x7FFF);
-
-						break;
-					}
-
-					//Update specific entries
-					switch(update_id)
-					{
-						case 0:
-						case 1:
-						case 2:
-						case 3:
-						case 4:
-						case 5:
-							temp24 = ((reply_buffer[50] << 16) | (reply_buffer[51] << 8) | (reply_buffer[52]));
-							clear_char(edit_screen_4, 129, 19); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 19, 0x7FFF);
-							clear_char(edit_screen_4, 147, 19); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 19, 0x7FFF);
-							clear_char(edit_screen_4, 165, 19); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 19, 0x7FFF);
-							clear_char(edit_screen_4, 183, 19); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 19, 0x7FFF);
-							clear_char(edit_screen_4, 201, 19); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 19, 0x7FFF);
-							clear_char(edit_screen_4, 219, 19); draw_font_cc(font_num, (temp24 % 10), 219, 19, 0x7FFF);
-
-							break;
-
-						case 6:
-						case 7:
-						case 8:
-						case 9:
-						case 10:
-						case 11:
-							temp24 = ((reply_buffer[53] << 16) | (reply_buffer[54] << 8) | (reply_buffer[55]));
-							clear_char(edit_screen_4, 129, 38); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 38, 0x7FFF);
-							clear_char(edit_screen_4, 147, 38); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 38, 0x7FFF);
-							clear_char(edit_screen_4, 165, 38); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 38, 0x7FFF);
-							clear_char(edit_screen_4, 183, 38); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 38, 0x7FFF);
-							clear_char(edit_screen_4, 201, 38); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 38, 0x7FFF);
-							clear_char(edit_screen_4, 219, 38); draw_font_cc(font_num, (temp24 % 10), 219, 38, 0x7FFF);
-
-							break;
-
-						case 12:
-						case 13:
-						case 14:
-						case 15:
-						case 16:
-							temp24 = ((reply_buffer[56] << 16) | (reply_buffer[57] << 8) | (reply_buffer[58]));
-							clear_char(edit_screen_4, 129, 57); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 57, 0x7FFF);
-							clear_char(edit_screen_4, 147, 57); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 57, 0x7FFF);
-							clear_char(edit_screen_4, 165, 57); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 57, 0x7FFF);
-							clear_char(edit_screen_4, 183, 57); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 57, 0x7FFF);
-							clear_char(edit_screen_4, 201, 57); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 57, 0x7FFF);
-							clear_char(edit_screen_4, 219, 57); draw_font_cc(font_num, (temp24 % 10), 219, 57, 0x7FFF);
-
-							break;
-
-						case 18:
-						case 19:
-						case 20:
-						case 21:
-						case 22:
-						case 23:
-							temp24 = ((reply_buffer[59] << 16) | (reply_buffer[60] << 8) | (reply_buffer[61]));
-							clear_char(edit_screen_4, 129, 76); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 76, 0x7FFF);
-							clear_char(edit_screen_4, 147, 76); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 76, 0x7FFF);
-							clear_char(edit_screen_4, 165, 76); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 76, 0x7FFF);
-							clear_char(edit_screen_4, 183, 76); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 76, 0x7FFF);
-							clear_char(edit_screen_4, 201, 76); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 76, 0x7FFF);
-							clear_char(edit_screen_4, 219, 76); draw_font_cc(font_num, (temp24 % 10), 219, 76, 0x7FFF);
-
-							break;
-
-						case 24:
-						case 25:
-						case 26:
-						case 27:
-						case 28:
-						case 29:
-							temp24 = ((reply_buffer[62] << 16) | (reply_buffer[63] << 8) | (reply_buffer[64]));
-							clear_char(edit_screen_4, 129, 95); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 95, 0x7FFF);
-							clear_char(edit_screen_4, 147, 95); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 95, 0x7FFF);
-							clear_char(edit_screen_4, 165, 95); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 95, 0x7FFF);
-							clear_char(edit_screen_4, 183, 95); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 95, 0x7FFF);
-							clear_char(edit_screen_4, 201, 95); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 95, 0x7FFF);
-							clear_char(edit_screen_4, 219, 95); draw_font_cc(font_num, (temp24 % 10), 219, 95, 0x7FFF);
-
-							break;
-
-						case 30:
-						case 31:
-						case 32:
-						case 33:
-						case 34:
-						case 35:
-							temp24 = ((reply_buffer[65] << 16) | (reply_buffer[66] << 8) | (reply_buffer[67]));
-							clear_char(edit_screen_4, 129, 114); draw_font_cc(font_num, ((temp24 / 100000) % 10), 129, 114, 0x7FFF);
-							clear_char(edit_screen_4, 147, 114); draw_font_cc(font_num, ((temp24 / 10000) % 10), 147, 114, 0x7FFF);
-							clear_char(edit_screen_4, 165, 114); draw_font_cc(font_num, ((temp24 / 1000) % 10), 165, 114, 0x7FFF);
-							clear_char(edit_screen_4, 183, 114); draw_font_cc(font_num, ((temp24 / 100) % 10), 183, 114, 0x7FFF);
-							clear_char(edit_screen_4, 201, 114); draw_font_cc(font_num, ((temp24 / 10) % 10), 201, 114, 0x7FFF);
-							clear_char(edit_screen_4, 219, 114); draw_font_cc(font_num, (temp24 % 10), 219, 114, 0x7FFF);
-
-							break;
-					}
-
-					break;
-			}
-
-			update = false;
+				edit.update_all = false;
+				break;
 		}
 
-		last_x = highlight_cursor.x;
-		last_y = highlight_cursor.y;
-	}
+		edit.update = false;
 
-	program_state = 0;
+		//Show the page once its values are in, a page from draw_page_job stays hidden until then in Mode 4
+		video_present();
+	}
 
-	fade_out(4);
+	edit.last_x = highlight_cursor.x;
+	edit.last_y = highlight_cursor.y;
+}
 
-	screen_cursor.state = 0;
-	screen_cursor.x = 90;
-	screen_cursor.y = 75;
+u32 read_field(const struct edit_field* field)
+{
+	u32 value = 0;
 
-	wait_frames(1);
-	draw_bitmap(main_screen, main_screen_size, 0, 0, 240);
-	
-	wait_frames(1);
-	draw_bitmap_cc(cursor, cursor_size, screen_cursor.x, screen_cursor.y, 16, 0x7FFF);
+	for(u8 x = 0; x < field->bytes; x++) { value = (value << 8) | reply_buffer[field->offset + x]; }
 
-	fade_in(4);
+	return value;
 }
 
-void send_data_idle()
+void write_field(const struct edit_field* field, u32 value)
 {
-	//Draw send data screen
-	fade_out(4);
+	for(u8 x = field->bytes; x > 0; x--)
+	{
+		reply_buffer[field->offset + x - 1] = value;
+		value >>= 8;
+	}
+}
 
-	wait_frames(1);
-	draw_bitmap(send_screen, send_screen_size, 0, 0, 240);
+u32 counter_step()
+{
+	//Start at 5, then multiply by 10 every KEY_ACCEL_REPEATS repeats of a held key
+	u32 step = 5;
 
-	fade_in(4);
+	for(u32 x = (input.repeat_count / KEY_ACCEL_REPEATS); (x > 0) && (step < 100000); x--) { step *= 10; }
 
-	//Wait for JoyBus commands and process them
-	wait_for_signal();
+	return step;
 }
 
-void show_data_idle()
+u32 step_counter(u32 value, u32 step, bool up, u32 limit)
 {
-	//Return to main screen when pressing L
-	if((IO_H[152] & 0x200) == 0)
+	//Wrap around when already at either end, otherwise clamp to the range
+	if(up)
 	{
-		setup();
-
-		screen_cursor.state = 0;
-		screen_cursor.x = 90;
-		screen_cursor.y = 75;
+		if(value >= limit) { return 0; }
+		value += step;
+		if(value > limit) { value = limit; }
+	}
 
-		program_state = 0;
+	else
+	{
+		if(value == 0) { return limit; }
+		value = (value > step) ? (value - step) : 0;
 	}
 
-	wait_frames(1);
+	return value;
 }
 
-void show_poll_idle()
+void send_enter()
 {
-	//Return to main screen when pressing R
-	if((IO_H[152] & 0x100) == 0)
-	{
-		setup();
+	//Draw send data screen
+	video_compose(SEND_SCREEN_PALETTE);
+	draw_screen(send_screen);
+	video_present();
+}
 
-		screen_cursor.state = 0;
-		screen_cursor.x = 90;
-		screen_cursor.y = 75;
+void send_frame()
+{
+	//The session stays open from frame to frame, each call serves JoyBus commands until the next VBlank
+	if(!session.open) { session_begin(); }
 
-		program_state = 0;
+	//B ends it and returns to the main menu
+	if(!session_frame())
+	{
+		session_end();
+		change_state(STATE_MAIN, true);
 	}
-
-	wait_frames(1);
 }
@@ -1,4809 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-const unsigned char main_screen[] = {
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xbb, 0x77, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x57, 0x6b, 0xdc, 0x7b, 0xfe, 0x7b, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7b, 0xfd, 0x7f, 0x99, 0x73, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xbb, 0x77, 0xfd, 0x7f, 
-	0xfe, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0x78, 0x6f, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x79, 0x73, 
-	0xdd, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7b, 0xdd, 0x7b, 0x57, 0x6f, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x57, 0x6b, 0xdc, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7b, 
-	0xdd, 0x7b, 0x56, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x90, 0x52, 0xaa, 0x35, 0xc5, 0x18, 0x83, 0x10, 0x27, 0x25, 0xcc, 0x3d, 
-	0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x6f, 0x4e, 0x89, 0x31, 
-	0xc4, 0x18, 0xc4, 0x18, 0x69, 0x2d, 0x6f, 0x4e, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xbb, 0x77, 0xfe, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 
-	0x56, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x67, 0xaa, 0x35, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x68, 0x2d, 0xa4, 0x14, 0x00, 0x00, 
-	0x00, 0x00, 0x4e, 0x4a, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 
-	0x27, 0x25, 0x48, 0x29, 0x20, 0x04, 0x00, 0x00, 0x69, 0x2d, 0x14, 0x67, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x99, 0x73, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xbc, 0x77, 0x9b, 0x73, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0x56, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x4e, 0x4a, 0x00, 0x00, 0xa3, 0x14, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x70, 0x52, 
-	0x27, 0x25, 0x0d, 0x42, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0xc4, 0x18, 0xd2, 0x5a, 
-	0x35, 0x6b, 0x34, 0x6b, 0xf3, 0x62, 0x27, 0x29, 0x00, 0x00, 0x2e, 0x46, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x57, 0x6f, 0xdc, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x59, 0x6b, 0x00, 0x00, 0x42, 0x08, 0xf6, 0x5e, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0x57, 0x6f, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0xc4, 0x18, 0x00, 0x00, 0x4e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x2e, 0x46, 0x27, 0x25, 0x83, 0x10, 
-	0x48, 0x29, 0x70, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0xf2, 0x5e, 
-	0x0d, 0x42, 0xa4, 0x14, 0x27, 0x29, 0xb1, 0x5a, 0x14, 0x67, 0xcb, 0x39, 0xa4, 0x14, 0x69, 0x2d, 
-	0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x48, 0x29, 0x62, 0x0c, 0x27, 0x25, 
-	0x4f, 0x4a, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x67, 0xa3, 0x14, 0x00, 0x00, 0x4f, 0x4e, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5a, 0x68, 0x2d, 0x6f, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x56, 0x0d, 0x42, 0xc5, 0x18, 0xc5, 0x18, 
-	0x2e, 0x46, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x48, 0x29, 0x62, 0x0c, 
-	0x27, 0x25, 0x4f, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x55, 0x6b, 0xbb, 0x77, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x5a, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x73, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7b, 0xdd, 0x7b, 0x77, 0x6f, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0xaa, 0x35, 0x6f, 0x4e, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xaa, 0x35, 
-	0xaa, 0x35, 0x27, 0x25, 0x00, 0x00, 0xc5, 0x1c, 0xec, 0x3d, 0xaa, 0x35, 0x06, 0x21, 0x00, 0x00, 
-	0x48, 0x29, 0x34, 0x6b, 0x34, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0x69, 0x2d, 0x70, 0x52, 0xab, 0x39, 
-	0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x62, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x48, 0x29, 0xcb, 0x39, 0x0d, 0x42, 0x21, 0x08, 
-	0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0x69, 0x2d, 0x70, 0x52, 
-	0xab, 0x39, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x99, 0x73, 
-	0xdd, 0x7f, 0xfe, 0x7f, 0xfe, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x5a, 0x6b, 0x00, 0x00, 0xc6, 0x18, 0xfe, 0x7f, 0xfe, 0x7f, 0xbc, 0x77, 0xbd, 0x77, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0x7a, 0x6f, 0x8b, 0x31, 0x17, 0x63, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7b, 0xfe, 0x7f, 0x99, 0x73, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x5a, 
-	0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x4e, 0x4a, 0x2e, 0x46, 0x13, 0x63, 0x35, 0x6b, 
-	0x6f, 0x4e, 0x00, 0x00, 0xcb, 0x39, 0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xcb, 0x39, 
-	0x35, 0x6b, 0xf3, 0x62, 0x00, 0x00, 0x00, 0x00, 0xec, 0x3d, 0x34, 0x6b, 0xf3, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x13, 0x63, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xf3, 0x62, 0x35, 0x6b, 0x34, 0x67, 
-	0xc4, 0x18, 0x83, 0x10, 0x34, 0x67, 0xb1, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 
-	0x35, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 
-	0x00, 0x00, 0x48, 0x29, 0x34, 0x6b, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xf3, 0x62, 0x35, 0x6b, 
-	0x34, 0x67, 0xc4, 0x18, 0x83, 0x10, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x57, 0x6f, 0xdc, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0xfe, 0x7f, 0xde, 0x7b, 
-	0x59, 0x6b, 0x00, 0x00, 0x08, 0x21, 0xb5, 0x56, 0xce, 0x39, 0x00, 0x00, 0x59, 0x6b, 0xfe, 0x7f, 
-	0xdd, 0x7b, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0xbc, 0x77, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xde, 0x7f, 0xfe, 0x7f, 0x9a, 0x73, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x5a, 
-	0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x6f, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x90, 0x52, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x90, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0xc4, 0x18, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x83, 0x10, 
-	0x00, 0x00, 0xf2, 0x5e, 0xd1, 0x5a, 0x00, 0x00, 0x20, 0x04, 0x4f, 0x4a, 0x4f, 0x4a, 0x4f, 0x4a, 
-	0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0xb1, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5a, 
-	0x00, 0x00, 0x20, 0x04, 0x34, 0x67, 0xd1, 0x5a, 0x00, 0x00, 0x20, 0x04, 0x4f, 0x4a, 0x4f, 0x4a, 
-	0x4f, 0x4a, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x55, 0x6b, 0xbb, 0x77, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x51, 0x4a, 0x21, 0x04, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x67, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xde, 0x7b, 0x17, 0x63, 0x84, 0x10, 0x00, 0x00, 0x4a, 0x29, 0x7b, 0x6f, 0xfe, 0x7f, 
-	0xde, 0x7f, 0xfe, 0x7f, 0xbb, 0x77, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 0xd2, 0x5e, 0xcb, 0x3d, 0xcb, 0x39, 
-	0x07, 0x25, 0x00, 0x00, 0x6f, 0x4e, 0x34, 0x6b, 0xb1, 0x56, 0x69, 0x31, 0xa4, 0x14, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0xb1, 0x56, 0x00, 0x00, 0x21, 0x08, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 
-	0x48, 0x29, 0x48, 0x29, 0xd1, 0x5a, 0xf2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x62, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x34, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 
-	0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0xf3, 0x5e, 
-	0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0xb1, 0x56, 0x00, 0x00, 0x21, 0x08, 0x48, 0x29, 0x48, 0x29, 
-	0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x99, 0x73, 0xfd, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xf6, 0x5e, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x94, 0x52, 0x38, 0x67, 0xbc, 0x77, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x7a, 0x6f, 0xe7, 0x1c, 0x21, 0x04, 0x18, 0x63, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xdc, 0x7b, 0x55, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0xc5, 0x18, 0x00, 0x00, 0x2e, 0x4a, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xec, 0x41, 0x00, 0x00, 0x6f, 0x4e, 0xd2, 0x5a, 0x00, 0x00, 0x83, 0x10, 0x90, 0x52, 0xf2, 0x5e, 
-	0x4f, 0x4a, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x34, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0xd1, 0x5a, 0x00, 0x00, 0x41, 0x08, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xc5, 0x1c, 0x00, 0x00, 0x4e, 0x4a, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xf3, 0x62, 0x69, 0x2d, 0x6f, 0x4e, 0x34, 0x6b, 0x35, 0x6b, 
-	0x21, 0x04, 0x00, 0x00, 0xf2, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0xec, 0x41, 
-	0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x91, 0x56, 0x34, 0x6b, 0x34, 0x6b, 0xd2, 0x5a, 
-	0x00, 0x00, 0x21, 0x08, 0x34, 0x67, 0xb1, 0x5a, 0x00, 0x00, 0x41, 0x08, 0x34, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x77, 0x6f, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0xbd, 0x77, 
-	0x7a, 0x6f, 0x00, 0x00, 0x10, 0x42, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x7a, 0x6f, 0x18, 0x63, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xdd, 0x7f, 0x56, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x4e, 0x4a, 0x00, 0x00, 0x83, 0x10, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xd2, 0x5a, 
-	0x27, 0x29, 0x00, 0x00, 0x6f, 0x4e, 0x6f, 0x4e, 0x00, 0x00, 0x69, 0x31, 0x35, 0x6b, 0x35, 0x6b, 
-	0xec, 0x3d, 0x00, 0x00, 0x48, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x34, 0x67, 
-	0xe6, 0x1c, 0x68, 0x2d, 0x34, 0x67, 0x35, 0x6b, 0x4f, 0x4e, 0x00, 0x00, 0xa4, 0x14, 0xd1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x69, 0x2d, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0x6f, 0x4e, 0x35, 0x6b, 0x14, 0x67, 0xe5, 0x1c, 0x00, 0x00, 0xec, 0x41, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xec, 0x3d, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 
-	0x00, 0x00, 0x68, 0x2d, 0x35, 0x6b, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x34, 0x67, 0xe6, 0x1c, 0x68, 0x2d, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x56, 0x6b, 0xbb, 0x77, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x9b, 0x73, 0x00, 0x00, 0x31, 0x46, 0xfe, 0x7f, 0xfe, 0x7f, 0xbc, 0x77, 0x7a, 0x6f, 0x39, 0x67, 
-	0x5a, 0x6b, 0x9c, 0x73, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x78, 0x6f, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x67, 0xab, 0x35, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x69, 0x2d, 0xc5, 0x18, 0x00, 0x00, 
-	0x00, 0x00, 0x89, 0x31, 0x13, 0x63, 0xb1, 0x56, 0x00, 0x00, 0x20, 0x04, 0x0d, 0x46, 0xab, 0x35, 
-	0xaa, 0x35, 0x20, 0x04, 0x62, 0x0c, 0x6f, 0x4e, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0x06, 0x21, 0x4e, 0x4a, 0xaa, 0x35, 
-	0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xcb, 0x39, 0x00, 0x00, 0x00, 0x00, 
-	0x06, 0x21, 0x48, 0x29, 0x41, 0x08, 0x00, 0x00, 0x48, 0x29, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 
-	0x0d, 0x46, 0x00, 0x00, 0x62, 0x0c, 0xcb, 0x3d, 0x27, 0x25, 0xab, 0x35, 0x00, 0x00, 0xec, 0x41, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x07, 0x25, 0xec, 0x3d, 0x0d, 0x46, 0x41, 0x08, 
-	0x00, 0x00, 0x90, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0x06, 0x21, 0x4e, 0x4a, 
-	0xaa, 0x35, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x99, 0x73, 
-	0xfd, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x9b, 0x73, 0x00, 0x00, 0xee, 0x3d, 0x94, 0x52, 0x6b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xcd, 0x39, 0x7b, 0x6f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x67, 0x90, 0x52, 0x8a, 0x35, 0xc4, 0x18, 0x83, 0x10, 0x27, 0x25, 0xec, 0x3d, 
-	0xb1, 0x56, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x4a, 0xe6, 0x1c, 0xc4, 0x18, 0x0c, 0x42, 
-	0x14, 0x67, 0x4e, 0x4a, 0x06, 0x21, 0x48, 0x29, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x34, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x27, 0x29, 0x83, 0x10, 0x48, 0x29, 
-	0x6f, 0x4e, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x52, 0xaa, 0x35, 
-	0xc4, 0x18, 0xa3, 0x14, 0x68, 0x2d, 0x4f, 0x4a, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x14, 0x67, 0xec, 0x3d, 0xc5, 0x18, 0x27, 0x25, 0x90, 0x52, 0x90, 0x52, 0x00, 0x00, 0xec, 0x3d, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xb1, 0x5a, 0xec, 0x41, 0xa4, 0x14, 0xe6, 0x1c, 
-	0x4f, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x27, 0x29, 0x83, 0x10, 
-	0x27, 0x29, 0x6f, 0x4e, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x77, 0x6f, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x5a, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x2d, 0x31, 0x46, 0x72, 0x4e, 
-	0x10, 0x42, 0xa5, 0x14, 0x00, 0x00, 0xc5, 0x18, 0x9b, 0x73, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x56, 0x6b, 0xbb, 0x77, 0xfe, 0x7f, 0xde, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0xb5, 0x56, 
-	0x21, 0x04, 0x00, 0x00, 0xc5, 0x18, 0xb5, 0x56, 0x9b, 0x73, 0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xbc, 0x77, 0xcd, 0x39, 0x00, 0x00, 0x31, 0x46, 0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x9a, 0x73, 0xfe, 0x7f, 0xfe, 0x7b, 0xfe, 0x7b, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0x30, 0x46, 0x00, 0x00, 
-	0x63, 0x0c, 0x00, 0x00, 0x8c, 0x31, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0x39, 0x67, 0x00, 0x00, 0x63, 0x0c, 0xdd, 0x7b, 0xde, 0x7b, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x78, 0x6f, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x51, 0x4a, 0x00, 0x00, 0x4a, 0x29, 
-	0x59, 0x6b, 0x00, 0x00, 0x29, 0x25, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0x5a, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x77, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x75, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x56, 0x6b, 0xdc, 0x7b, 0xde, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x7a, 0x6f, 0x00, 0x00, 0x84, 0x10, 0x9b, 0x73, 
-	0xbc, 0x77, 0x00, 0x00, 0x84, 0x10, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xd6, 0x5a, 0x00, 0x00, 0x21, 0x04, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x46, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x9a, 0x77, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xf7, 0x5e, 0x00, 0x00, 0xad, 0x35, 0xfe, 0x7f, 
-	0xbc, 0x77, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xbc, 0x77, 0x29, 0x25, 0x00, 0x00, 0x51, 0x4a, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0x13, 0x1d, 0x15, 0x63, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 
-	0x78, 0x6f, 0xdd, 0x7b, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x9b, 0x73, 0x63, 0x0c, 0x00, 0x00, 0x73, 0x4e, 
-	0xf7, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x77, 0xfe, 0x7f, 0xdd, 0x7b, 0x5a, 0x6b, 0x5a, 0x6b, 
-	0xf6, 0x5e, 0x49, 0x29, 0x00, 0x00, 0x29, 0x25, 0xbc, 0x77, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x46, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x56, 0x6b, 0xdc, 0x7b, 0xfe, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x38, 0x67, 0x84, 0x10, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0xdd, 0x7b, 0xfe, 0x7f, 0xde, 0x7b, 0x30, 0x46, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xce, 0x39, 0xbc, 0x77, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x83, 0x10, 0x89, 0x31, 0xb1, 0x56, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xf5, 0x5e, 0xf4, 0x18, 0xd5, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xbb, 0x77, 0xfe, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x9b, 0x73, 0x31, 0x46, 
-	0x83, 0x10, 0x29, 0x25, 0x59, 0x6b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xbd, 0x77, 0x8b, 0x31, 
-	0x31, 0x46, 0x38, 0x67, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x27, 0x25, 
-	0x89, 0x31, 0x89, 0x31, 0xe6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x90, 0x52, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 
-	0xec, 0x41, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x20, 0x04, 0x70, 0x52, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 
-	0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x2e, 0x46, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x20, 0x04, 0x70, 0x52, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0x75, 0x29, 0xf5, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x79, 0x73, 0xfd, 0x7b, 0xfe, 0x7b, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0x06, 0x21, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x55, 0x46, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x57, 0x6f, 0xdc, 0x7b, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x6f, 0x4e, 0x48, 0x29, 0x62, 0x0c, 0x27, 0x25, 0x4f, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x0c, 0x42, 0xa4, 0x14, 0xe6, 0x1c, 0x4e, 0x4a, 0x4e, 0x4a, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x89, 0x31, 0x83, 0x10, 0xc4, 0x18, 
-	0xaa, 0x35, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0xf2, 0x5e, 
-	0x0d, 0x42, 0xa4, 0x14, 0x27, 0x29, 0xb1, 0x5a, 0x14, 0x67, 0xcb, 0x39, 0xa4, 0x14, 0x69, 0x2d, 
-	0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x48, 0x29, 0x62, 0x0c, 0x27, 0x25, 
-	0x4f, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x34, 0x67, 0x34, 0x6b, 0x6f, 0x4e, 0x48, 0x29, 0x62, 0x0c, 0x27, 0x25, 0x4f, 0x4a, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0xd2, 0x5e, 0xaa, 0x35, 0xe5, 0x1c, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 
-	0x00, 0x00, 0xf2, 0x5e, 0x0d, 0x42, 0xa4, 0x14, 0x27, 0x29, 0xb1, 0x5a, 0x14, 0x67, 0xcb, 0x39, 
-	0xa4, 0x14, 0x69, 0x2d, 0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x2e, 0x46, 0x27, 0x25, 0x83, 0x10, 0x48, 0x29, 
-	0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x34, 0x67, 0x35, 0x6b, 0xb1, 0x56, 0x89, 0x31, 0x83, 0x10, 0xc4, 0x18, 0xaa, 0x35, 0xd2, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0xd2, 0x5e, 0xaa, 0x35, 0xe5, 0x1c, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb5, 0x56, 0x15, 0x1d, 0x75, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x55, 0x6b, 0xbb, 0x77, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 
-	0x2e, 0x46, 0x00, 0x00, 0x69, 0x2d, 0x70, 0x52, 0xab, 0x39, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 
-	0x34, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0xe5, 0x1c, 0x2e, 0x46, 0xaa, 0x35, 0x06, 0x21, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x83, 0x10, 0x0d, 0x46, 0xec, 0x41, 
-	0x20, 0x04, 0x20, 0x04, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xaa, 0x35, 
-	0x8a, 0x35, 0x27, 0x25, 0x00, 0x00, 0xc5, 0x1c, 0xec, 0x3d, 0xaa, 0x35, 0x06, 0x21, 0x00, 0x00, 
-	0x48, 0x29, 0x34, 0x6b, 0x34, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0x69, 0x2d, 0x70, 0x52, 0xab, 0x39, 
-	0x00, 0x00, 0x2e, 0x4a, 0x34, 0x6b, 0x90, 0x52, 0x48, 0x29, 0x00, 0x00, 0xcb, 0x39, 0x6f, 0x4e, 
-	0x34, 0x67, 0x2e, 0x46, 0x00, 0x00, 0x69, 0x2d, 0x70, 0x52, 0xab, 0x39, 0x00, 0x00, 0x2e, 0x4a, 
-	0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xaa, 0x35, 0xa4, 0x14, 0x27, 0x25, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xaa, 0x35, 0x8a, 0x35, 0x27, 0x25, 0x00, 0x00, 0xc5, 0x1c, 0xec, 0x3d, 0xaa, 0x35, 
-	0x06, 0x21, 0x00, 0x00, 0x48, 0x29, 0x34, 0x6b, 0x34, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 
-	0x34, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0xaa, 0x35, 0x6f, 0x4e, 0xe6, 0x1c, 
-	0x00, 0x00, 0x90, 0x52, 0x35, 0x6b, 0x90, 0x56, 0x48, 0x29, 0x00, 0x00, 0xcb, 0x39, 0x6f, 0x4e, 
-	0x34, 0x67, 0x6f, 0x4e, 0x00, 0x00, 0x83, 0x10, 0x0d, 0x46, 0xec, 0x41, 0x20, 0x04, 0x20, 0x04, 
-	0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xaa, 0x35, 0xa4, 0x14, 0x27, 0x25, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x21, 0x75, 0x00, 0xb5, 0x10, 0x15, 0x63, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0x99, 0x73, 0xdd, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xec, 0x3d, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x14, 0x67, 
-	0x62, 0x0c, 0x00, 0x00, 0xf3, 0x62, 0x34, 0x6b, 0x34, 0x67, 0xc4, 0x18, 0x83, 0x10, 0x34, 0x67, 
-	0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x48, 0x29, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x34, 0x67, 0xa4, 0x14, 0x00, 0x00, 0x91, 0x56, 0x35, 0x6b, 0x34, 0x6b, 
-	0x4e, 0x4a, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xcb, 0x39, 
-	0x34, 0x6b, 0xf3, 0x62, 0x00, 0x00, 0x00, 0x00, 0xec, 0x3d, 0x35, 0x6b, 0xf3, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x13, 0x63, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xf3, 0x62, 0x35, 0x6b, 0x34, 0x67, 
-	0xc4, 0x18, 0x83, 0x10, 0x34, 0x67, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xf3, 0x62, 0x34, 0x6b, 0x34, 0x67, 0xc4, 0x18, 0x83, 0x10, 
-	0x34, 0x67, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0xf3, 0x62, 0x00, 0x00, 0x00, 0x00, 0xec, 0x3d, 0x35, 0x6b, 
-	0xf3, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 0x35, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 
-	0x35, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x34, 0x67, 0x4e, 0x4a, 0x2e, 0x46, 0x13, 0x63, 0x35, 0x6b, 0x6f, 0x4e, 
-	0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0x34, 0x67, 0xa4, 0x14, 0x00, 0x00, 0xb1, 0x56, 0x34, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 
-	0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0x73, 0x00, 0x75, 0x00, 0x74, 0x00, 0xd5, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x77, 0x6f, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x7a, 0x6f, 0xdd, 0x7b, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x48, 0x29, 
-	0x8a, 0x35, 0x8a, 0x35, 0x06, 0x21, 0x00, 0x00, 0x20, 0x04, 0xb1, 0x5a, 0x35, 0x6b, 0xd1, 0x5a, 
-	0x00, 0x00, 0x20, 0x04, 0x4f, 0x4a, 0x4f, 0x4a, 0x4f, 0x4a, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 
-	0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x2d, 0x46, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x90, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0xc4, 0x18, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x83, 0x10, 
-	0x00, 0x00, 0xf2, 0x5e, 0xd1, 0x5a, 0x00, 0x00, 0x20, 0x04, 0x4f, 0x4a, 0x4f, 0x4a, 0x4f, 0x4a, 
-	0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0xd1, 0x5a, 0x00, 0x00, 0x20, 0x04, 0x4f, 0x4a, 0x4f, 0x4a, 0x4f, 0x4a, 0x06, 0x21, 0x00, 0x00, 
-	0xd2, 0x5a, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 
-	0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0x90, 0x52, 0x34, 0x6b, 0x35, 0x6b, 0xc4, 0x18, 0x00, 0x00, 0x91, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x83, 0x10, 0x00, 0x00, 0xf2, 0x5e, 0x35, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x52, 
-	0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0xd2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x14, 0x67, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x16, 0x63, 0x36, 0x42, 0x16, 0x63, 0x35, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x56, 0x6b, 0xbb, 0x77, 0xde, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xde, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xde, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xdd, 0x7b, 0x30, 0x46, 0x00, 0x00, 0x72, 0x4e, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xa4, 0x14, 0xaa, 0x35, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 
-	0x00, 0x00, 0x21, 0x08, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0xd2, 0x5a, 
-	0xb1, 0x5a, 0x00, 0x00, 0x83, 0x10, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0xa4, 0x14, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xf3, 0x62, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0xb1, 0x56, 0x00, 0x00, 0x21, 0x08, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 
-	0x48, 0x29, 0x48, 0x29, 0xd2, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0xb1, 0x56, 0x00, 0x00, 0x21, 0x08, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 
-	0xd1, 0x5a, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0xc5, 0x18, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xb1, 0x56, 0x69, 0x31, 0xa4, 0x14, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0xb1, 0x56, 0x00, 0x00, 0xa4, 0x14, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0x00, 0x00, 
-	0x00, 0x00, 0x13, 0x63, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x75, 0x4e, 0x75, 0x29, 0x55, 0x4a, 0x35, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x99, 0x73, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x38, 0x67, 0x9b, 0x73, 0xfe, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xb4, 0x56, 0x00, 0x00, 0x00, 0x00, 
-	0xf7, 0x5e, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 
-	0x00, 0x00, 0x41, 0x08, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x0d, 0x46, 0x00, 0x00, 
-	0xec, 0x41, 0x34, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0xb1, 0x5a, 0x00, 0x00, 0x41, 0x08, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 
-	0xd1, 0x5a, 0x00, 0x00, 0x41, 0x08, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x34, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x34, 0x6b, 
-	0x34, 0x6b, 0xc5, 0x18, 0x00, 0x00, 0xd2, 0x5e, 0x34, 0x6b, 0x21, 0x04, 0x00, 0x00, 0xd2, 0x5e, 
-	0x35, 0x6b, 0x34, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0xec, 0x41, 0x34, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0xd2, 0x5a, 0x00, 0x00, 0x83, 0x10, 0x90, 0x56, 0xf2, 0x5e, 0x4e, 0x4a, 
-	0x00, 0x00, 0x69, 0x2d, 0x34, 0x6b, 0x34, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x34, 0x6b, 
-	0xd2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x14, 0x67, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0xf5, 0x3d, 0x55, 0x29, 0xf5, 0x3d, 0xd5, 0x5a, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x77, 0x6f, 0xdd, 0x7b, 0xde, 0x7f, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x93, 0x52, 0x00, 0x00, 0x4a, 0x29, 0xbc, 0x77, 
-	0xfe, 0x7f, 0x9b, 0x73, 0x93, 0x52, 0x93, 0x52, 0x93, 0x52, 0x73, 0x4e, 0x42, 0x08, 0x00, 0x00, 
-	0xa5, 0x14, 0xd5, 0x5a, 0xb5, 0x56, 0xb4, 0x56, 0x94, 0x52, 0xd5, 0x5a, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 
-	0x62, 0x0c, 0x00, 0x00, 0xd2, 0x5e, 0x34, 0x6b, 0x34, 0x67, 0xe5, 0x1c, 0x68, 0x2d, 0x34, 0x67, 
-	0x14, 0x67, 0x41, 0x08, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x27, 0x25, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x34, 0x67, 0xa4, 0x14, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 
-	0x2e, 0x46, 0x00, 0x00, 0x89, 0x31, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x34, 0x6b, 0x34, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x34, 0x67, 
-	0xe6, 0x1c, 0x68, 0x2d, 0x34, 0x67, 0x34, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x6f, 0x4e, 0x35, 0x6b, 
-	0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xd2, 0x5e, 0x34, 0x6b, 0x34, 0x67, 0xe6, 0x1c, 0x68, 0x2d, 
-	0x34, 0x67, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0xc5, 0x18, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0x6f, 0x4e, 
-	0x35, 0x6b, 0x14, 0x67, 0xe5, 0x1c, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x6f, 0x4e, 0x00, 0x00, 0x69, 0x31, 0x35, 0x6b, 0x35, 0x6b, 0xec, 0x3d, 
-	0x00, 0x00, 0x48, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x6f, 0x4e, 0x35, 0x6b, 
-	0x34, 0x67, 0xa4, 0x14, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x46, 0x00, 0x00, 
-	0x89, 0x31, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd5, 0x5a, 0xb5, 0x31, 0xb5, 0x56, 0x35, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x56, 0x6b, 0xbc, 0x7b, 
-	0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x5a, 0x6b, 0x84, 0x10, 0x00, 0x00, 0xcd, 0x39, 
-	0xdd, 0x7b, 0x59, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x35, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x2e, 0x46, 0x00, 0x00, 0x06, 0x21, 0x4e, 0x4a, 0xaa, 0x35, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 
-	0x35, 0x6b, 0xec, 0x3d, 0x00, 0x00, 0xe5, 0x1c, 0x2e, 0x46, 0x8a, 0x31, 0x27, 0x25, 0x00, 0x00, 
-	0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0xa4, 0x14, 0x2d, 0x46, 0xec, 0x3d, 
-	0x00, 0x00, 0x62, 0x0c, 0xd2, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x34, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0x34, 0x6b, 0x2d, 0x46, 0x00, 0x00, 0x06, 0x21, 0x4e, 0x4a, 0xaa, 0x35, 
-	0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0x07, 0x25, 0x2e, 0x4a, 
-	0x14, 0x67, 0x2e, 0x46, 0x00, 0x00, 0x06, 0x21, 0x4e, 0x4a, 0xaa, 0x35, 0x00, 0x00, 0x2e, 0x4a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 
-	0x8a, 0x31, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x34, 0x67, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0xc5, 0x18, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x0d, 0x46, 0x00, 0x00, 0x62, 0x0c, 
-	0xcb, 0x3d, 0x27, 0x25, 0xab, 0x35, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x34, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0xb1, 0x56, 0x00, 0x00, 0x20, 0x04, 0x0d, 0x46, 0xab, 0x35, 0xaa, 0x35, 
-	0x20, 0x04, 0x62, 0x0c, 0x6f, 0x4e, 0x34, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0x07, 0x25, 0x2e, 0x4a, 
-	0x14, 0x67, 0x6f, 0x4e, 0x00, 0x00, 0xa4, 0x14, 0x2d, 0x46, 0xec, 0x3d, 0x00, 0x00, 0x62, 0x0c, 
-	0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf5, 0x62, 0x54, 0x29, 0xf5, 0x18, 0x54, 0x25, 0xd5, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x9a, 0x73, 0xde, 0x7f, 0xfe, 0x7b, 0xfe, 0x7b, 0xfe, 0x7f, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 
-	0xb4, 0x56, 0x59, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 
-	0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x94, 0x52, 0x00, 0x00, 0xac, 0x35, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x4f, 0x4e, 0x27, 0x29, 0x83, 0x10, 0x27, 0x29, 0x6f, 0x4e, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x14, 0x63, 0xcb, 0x3d, 0x83, 0x10, 0x06, 0x21, 0x4f, 0x4a, 0x6f, 0x4e, 0x00, 0x00, 
-	0xec, 0x3d, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x91, 0x56, 0x69, 0x31, 0x83, 0x10, 0xc4, 0x18, 
-	0xcb, 0x39, 0xd2, 0x5e, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x34, 0x6b, 0x34, 0x6b, 0xc5, 0x18, 
-	0x00, 0x00, 0xd2, 0x5e, 0x34, 0x6b, 0x34, 0x67, 0x6f, 0x4e, 0x27, 0x29, 0x83, 0x10, 0x27, 0x29, 
-	0x6f, 0x4e, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0x69, 0x2d, 0x62, 0x0c, 0x27, 0x25, 
-	0x14, 0x63, 0x34, 0x6b, 0x4f, 0x4e, 0x27, 0x29, 0x83, 0x10, 0x48, 0x29, 0x6f, 0x4e, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x34, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0xc5, 0x18, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x14, 0x67, 0xec, 0x3d, 0xc5, 0x18, 
-	0x27, 0x25, 0x90, 0x52, 0x90, 0x52, 0x00, 0x00, 0xec, 0x3d, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x2e, 0x4a, 0xe6, 0x1c, 0xc4, 0x18, 0x0c, 0x42, 0x14, 0x67, 
-	0x4e, 0x4a, 0x06, 0x21, 0x48, 0x29, 0x35, 0x6b, 0xf3, 0x62, 0x68, 0x2d, 0x62, 0x0c, 0x27, 0x25, 
-	0x14, 0x63, 0x35, 0x6b, 0x90, 0x56, 0x69, 0x31, 0x83, 0x10, 0xc4, 0x18, 0xcb, 0x39, 0xd2, 0x5e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf6, 0x62, 0xd5, 0x39, 0xf6, 0x5e, 0x35, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x78, 0x6f, 0xdd, 0x7b, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xb5, 0x56, 0xf6, 0x5e, 
-	0xdd, 0x7b, 0x59, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x10, 0x42, 0x10, 0x42, 0x10, 0x42, 
-	0x10, 0x42, 0x10, 0x42, 0x10, 0x42, 0x8b, 0x31, 0x00, 0x00, 0xac, 0x35, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x67, 0x15, 0x63, 0xf4, 0x18, 0x95, 0x08, 0xd4, 0x10, 0xd5, 0x5a, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x56, 0x6b, 0x38, 0x67, 0x59, 0x6b, 0x5a, 0x6b, 0x5a, 0x6b, 0x5a, 0x6b, 
-	0x7a, 0x6f, 0x59, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x35, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x16, 0x63, 0x16, 0x3e, 0xf6, 0x62, 0x35, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xab, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xa5, 0x14, 0x5a, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x5e, 0xbc, 0x77, 0xbc, 0x77, 0xbc, 0x77, 
-	0x9b, 0x73, 0x9b, 0x73, 0x7a, 0x6f, 0xd5, 0x5a, 0xac, 0x35, 0xef, 0x3d, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0x54, 0x25, 0x55, 0x00, 0x14, 0x1d, 0xf5, 0x5e, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x2e, 0x46, 0x71, 0x4e, 0x30, 0x46, 0x00, 0x00, 
-	0xa5, 0x14, 0x59, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0xf5, 0x5e, 0x15, 0x3e, 0xd6, 0x5e, 0x15, 0x63, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 
-	0xa5, 0x14, 0x59, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x52, 0x00, 0x00, 0x00, 0x00, 
-	0x72, 0x4e, 0x00, 0x00, 0x4a, 0x29, 0xd5, 0x5a, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xd5, 0x39, 0xb5, 0x0c, 0x94, 0x31, 0x15, 0x63, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0xa4, 0x14, 0x38, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x5e, 0x00, 0x00, 0x00, 0x00, 
-	0xd5, 0x5a, 0x00, 0x00, 0x8c, 0x31, 0x39, 0x67, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x67, 0x15, 0x63, 0x95, 0x52, 0xd5, 0x35, 0x95, 0x52, 0x15, 0x63, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0x83, 0x10, 0xb3, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x25, 0x00, 0x00, 0x00, 0x00, 
-	0x08, 0x21, 0x00, 0x00, 0x84, 0x10, 0x4a, 0x29, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x67, 0x35, 0x67, 0x35, 0x46, 0x15, 0x21, 0x15, 0x42, 0x15, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0x83, 0x10, 0x0c, 0x42, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 
-	0xe7, 0x1c, 0x00, 0x00, 0x83, 0x10, 0x28, 0x25, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0x35, 0x46, 0x95, 0x2d, 0x35, 0x46, 0xf5, 0x5e, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0x21, 0x04, 0x83, 0x10, 0x21, 0x08, 0xa4, 0x14, 0x00, 0x00, 0xf7, 0x5e, 0x00, 0x00, 0x00, 0x00, 
-	0xd5, 0x5a, 0x00, 0x00, 0x8c, 0x31, 0x39, 0x67, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x95, 0x52, 0x75, 0x2d, 0x75, 0x4e, 0x35, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x8a, 0x35, 0x21, 0x08, 0x00, 0x00, 0xb3, 0x56, 0x00, 0x00, 0x00, 0x00, 
-	0xb4, 0x56, 0x00, 0x00, 0xc5, 0x18, 0x39, 0x67, 0x00, 0x00, 0x63, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0xb5, 0x35, 0x35, 0x21, 0xb5, 0x35, 0xd5, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4f, 0x4e, 0x00, 0x00, 
-	0x00, 0x00, 0x20, 0x04, 0x90, 0x56, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x46, 0x00, 0x00, 0x00, 0x00, 
-	0x30, 0x46, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0x28, 0x25, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x55, 0x46, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x90, 0x56, 0x48, 0x29, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x62, 0x0c, 0xec, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x42, 0xcb, 0x3d, 0xcc, 0x3d, 
-	0xd4, 0x5a, 0xf7, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x52, 0xdd, 0x7b, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x15, 0x63, 0x75, 0x2d, 0x15, 0x1d, 0x75, 0x2d, 0xd5, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x48, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1c, 0x70, 0x52, 
-	0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x14, 0x83, 0x10, 
-	0x62, 0x0c, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x18, 0xfe, 0x7f, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x16, 0x67, 0xd4, 0x14, 0x75, 0x00, 0x75, 0x04, 0x15, 0x5f, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x56, 0x00, 0x00, 0xec, 0x3d, 0x14, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x90, 0x56, 0x48, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x63, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x55, 0x4a, 0x55, 0x00, 0xf5, 0x3d, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0x90, 0x52, 0x4e, 0x4a, 0x0d, 0x46, 0x0d, 0x42, 
-	0x0d, 0x42, 0x0d, 0x42, 0x0d, 0x42, 0x0e, 0x42, 0x71, 0x4e, 0x73, 0x4e, 0x9b, 0x73, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x42, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x9a, 0x73, 0xfe, 0x7f, 0xfe, 0x7f, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x14, 0x63, 0x71, 0x4e, 0x91, 0x2d, 0x50, 0x4e, 0x14, 0x63, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x78, 0x6f, 0xdd, 0x7b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0xd3, 0x5a, 0x09, 0x21, 0xc8, 0x14, 0xaa, 0x10, 0xc8, 0x14, 0xe9, 0x1c, 0xb2, 0x52, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x56, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x14, 0x67, 0x2a, 0x25, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xe9, 0x1c, 
-	0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb5, 0x52, 
-	0xd4, 0x39, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 
-	0xb3, 0x35, 0x75, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x16, 0x42, 
-	0x75, 0x00, 0x56, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 
-	0x56, 0x00, 0xb5, 0x35, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0x48, 0x2d, 0x48, 0x2d, 0x48, 0x2d, 0x48, 0x2d, 
-	0x48, 0x2d, 0x48, 0x2d, 0x48, 0x2d, 0x0d, 0x42, 0x35, 0x6b, 0xf2, 0x5e, 0x69, 0x2d, 0xaa, 0x35, 
-	0x90, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x16, 0x42, 
-	0x76, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 
-	0x75, 0x00, 0xb5, 0x35, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x35, 0x35, 0x6b, 0xb1, 0x5a, 0x00, 0x00, 0x00, 0x00, 
-	0x90, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x16, 0x42, 
-	0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 
-	0x56, 0x00, 0xb5, 0x35, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4a, 0xb1, 0x56, 
-	0xb1, 0x56, 0x27, 0x29, 0x00, 0x00, 0xaa, 0x35, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x00, 0x00, 
-	0x2e, 0x4a, 0x90, 0x52, 0x90, 0x52, 0x90, 0x52, 0x90, 0x52, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0x16, 0x42, 
-	0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 
-	0x75, 0x00, 0xb5, 0x35, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x69, 0x31, 0x00, 0x00, 0xaa, 0x35, 0x35, 0x6b, 0xec, 0x41, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf4, 0x62, 0x2a, 0x25, 0xad, 0x10, 
-	0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 0x90, 0x0c, 
-	0x90, 0x0c, 0xae, 0x10, 0xe8, 0x18, 0xd3, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x69, 0x31, 0x00, 0x00, 0xaa, 0x35, 0xd2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 
-	0xcb, 0x39, 0xab, 0x35, 0x00, 0x00, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x8b, 0x2d, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x4a, 0x25, 0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x39, 0x2e, 0x46, 
-	0x2e, 0x46, 0xe6, 0x1c, 0x00, 0x00, 0xab, 0x35, 0x4f, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x35, 
-	0x34, 0x6b, 0x70, 0x52, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0xcd, 0x39, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x8b, 0x31, 0x14, 0x67, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x2e, 0x4a, 0x83, 0x10, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xee, 0x3d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xac, 0x35, 0x14, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x0d, 0x46, 0x0d, 0x46, 0xcb, 0x39, 0x00, 0x00, 
-	0x00, 0x00, 0xcb, 0x39, 0x48, 0x29, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x1c, 0xab, 0x35, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xc5, 0x18, 0x13, 0x63, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x67, 0xee, 0x3d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xac, 0x35, 0x14, 0x67, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0x00, 0x00, 0xd2, 0x5e, 0xf3, 0x5e, 0x68, 0x2d, 0x83, 0x10, 0xd2, 0x5a, 0xf3, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x14, 0x63, 0xad, 0x35, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x6b, 0x2d, 
-	0xf4, 0x62, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0xcb, 0x39, 0xec, 0x3d, 0x89, 0x31, 0x00, 0x00, 
-	0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x14, 0x67, 0xd2, 0x5a, 0x14, 0x63, 0x89, 0x31, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 
-	0x6b, 0x29, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0x2a, 0x21, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 0x00, 0x00, 
-	0x00, 0x00, 0xab, 0x39, 0xec, 0x3d, 0xab, 0x39, 0xd2, 0x5a, 0x06, 0x21, 0x00, 0x00, 0x00, 0x00, 
-	0x07, 0x25, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x14, 0x91, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x71, 0x4e, 0xe9, 0x1c, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0x4f, 0x4a, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x31, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 
-	0xd2, 0x5e, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x41, 0x14, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xac, 0x35, 0xc8, 0x14, 0xa8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x6b, 0x2d, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x35, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0xf4, 0x5e, 0x0e, 0x42, 0xc8, 0x18, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xcd, 0x39, 0xf3, 0x5e, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x35, 0x00, 0x00, 
-	0x00, 0x00, 0xec, 0x3d, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x18, 
-	0xc5, 0x18, 0xc5, 0x18, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1c, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0xd2, 0x5a, 0xee, 0x3d, 0xc8, 0x18, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xcd, 0x35, 
-	0xb2, 0x56, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x35, 0x00, 0x00, 
-	0x00, 0x00, 0xd2, 0x5e, 0x13, 0x63, 0xec, 0x3d, 0x2e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0xcc, 0x3d, 0xab, 0x39, 0xf2, 0x5e, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x0e, 0x42, 0x2f, 0x46, 0xb2, 0x5a, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x63, 0xb2, 0x56, 0x2f, 0x42, 0x4a, 0x25, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0x29, 0x21, 0x0e, 0x42, 0xb1, 0x56, 0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x67, 0xd3, 0x5a, 0x50, 0x4a, 0xed, 0x39, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x35, 0x00, 0x00, 
-	0x00, 0x00, 0x4e, 0x4a, 0x0d, 0x42, 0x2e, 0x46, 0xb1, 0x56, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 
-	0x35, 0x6b, 0x34, 0x6b, 0x06, 0x21, 0x00, 0x00, 0x4e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x14, 0x63, 0x4a, 0x25, 0xc8, 0x14, 0xc8, 0x14, 
-	0x8c, 0x2d, 0xee, 0x3d, 0x4f, 0x46, 0x71, 0x4e, 0x91, 0x52, 0x91, 0x52, 0x91, 0x52, 0x91, 0x52, 
-	0x70, 0x4e, 0x2f, 0x46, 0xee, 0x3d, 0x6b, 0x29, 0xc7, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xa7, 0x14, 0x4a, 0x29, 0xcd, 0x39, 0x2f, 0x46, 
-	0x70, 0x4e, 0x91, 0x52, 0x91, 0x52, 0x91, 0x52, 0x91, 0x52, 0x71, 0x4e, 0x4f, 0x4a, 0x0e, 0x42, 
-	0x8c, 0x31, 0xe8, 0x18, 0xc8, 0x14, 0x09, 0x1d, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x35, 0xb1, 0x56, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x56, 
-	0xd2, 0x5a, 0xd2, 0x5a, 0xe5, 0x1c, 0x00, 0x00, 0x4e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xf3, 0x5e, 0x09, 0x1d, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x18, 0xb2, 0x56, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xc4, 0x18, 0xec, 0x3d, 0xb1, 0x5a, 0xb1, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd3, 0x5a, 0x09, 0x1d, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x18, 0xb2, 0x56, 0x35, 0x6b, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0xcb, 0x39, 
-	0xb1, 0x56, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0x00, 0x00, 0x27, 0x25, 
-	0x27, 0x25, 0x27, 0x25, 0x21, 0x08, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 
-	0x4a, 0x29, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0x29, 0x21, 0xd2, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x83, 0x10, 0x2d, 0x46, 0x13, 0x63, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x89, 0x31, 0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x14, 0x63, 0x0e, 0x42, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xed, 0x39, 
-	0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0x2f, 0x46, 0x4b, 0x29, 0xc8, 0x14, 0xa7, 0x10, 0xa8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xa8, 0x14, 0xa8, 0x14, 0xa8, 0x14, 0xa9, 0x10, 0xa9, 0x10, 0xa9, 0x14, 0xa9, 0x10, 0xa9, 0x10, 
-	0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xab, 0x10, 0xab, 0x10, 0xaa, 0x10, 0xaa, 0x10, 
-	0xaa, 0x10, 0xa9, 0x10, 0xa9, 0x10, 0xa9, 0x10, 0xa9, 0x10, 0xa9, 0x10, 0xa9, 0x14, 0xa8, 0x14, 
-	0xa8, 0x14, 0xa8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xa8, 0x14, 0xa7, 0x10, 0xa7, 0x14, 0x4a, 0x25, 0x0e, 0x3e, 0xd3, 0x5a, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x67, 0x14, 0x63, 0xf3, 0x5e, 
-	0xf3, 0x5e, 0xd3, 0x5e, 0xd2, 0x5a, 0xd2, 0x5a, 0xd2, 0x5a, 0xd2, 0x5a, 0xb2, 0x5a, 0xd2, 0x5a, 
-	0xb2, 0x5a, 0xd2, 0x5a, 0xd2, 0x5a, 0xd3, 0x5a, 0x52, 0x25, 0x34, 0x21, 0xb4, 0x31, 0xb5, 0x31, 
-	0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb6, 0x31, 
-	0xb6, 0x31, 0xb6, 0x31, 0xb6, 0x31, 0xb6, 0x31, 0x36, 0x21, 0x96, 0x31, 0xb6, 0x31, 0xb6, 0x31, 
-	0xb6, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x35, 0xb5, 0x35, 0xb5, 0x35, 
-	0xb4, 0x31, 0xb4, 0x31, 0xb5, 0x31, 0x54, 0x25, 0xf2, 0x18, 0xd3, 0x5a, 0xd2, 0x5a, 0xd2, 0x5a, 
-	0xd2, 0x5a, 0xb2, 0x5a, 0xd2, 0x5a, 0xd2, 0x5a, 0xb2, 0x5a, 0xd2, 0x5a, 0xd2, 0x5a, 0xd3, 0x5a, 
-	0xd3, 0x5e, 0xf3, 0x5e, 0x14, 0x63, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x83, 0x10, 0x48, 0x29, 0x2d, 0x46, 0x13, 0x63, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x15, 0x3e, 0x59, 0x4a, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xda, 0x5a, 0xbe, 0x77, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdb, 0x5a, 0xb5, 0x31, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 
-	0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x31, 0x2e, 0x46, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x4e, 0x4a, 0x0d, 0x42, 0xf3, 0x5e, 0x35, 0x6b, 0x13, 0x63, 0x20, 0x04, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x48, 0x29, 0x8a, 0x35, 0x69, 0x2d, 0x62, 0x0c, 0x00, 0x00, 0xa3, 0x14, 0xb1, 0x5a, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x20, 0x04, 0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x95, 0x52, 0x16, 0x1d, 0x7a, 0x4e, 0x7a, 0x4a, 
-	0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 
-	0x7a, 0x4a, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0xb7, 0x35, 0x59, 0x46, 0x7a, 0x4e, 0x7a, 0x4e, 
-	0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 0x7a, 0x4e, 
-	0x7a, 0x4a, 0x7a, 0x4a, 0x7a, 0x4a, 0x77, 0x29, 0x55, 0x46, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xcb, 0x39, 0x00, 0x00, 0xc4, 0x18, 0x13, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x70, 0x52, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xf5, 0x5e, 0x90, 0x0c, 0x10, 0x1d, 0x30, 0x1d, 
-	0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 
-	0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 
-	0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 
-	0x10, 0x1d, 0x30, 0x1d, 0x30, 0x1d, 0xb0, 0x0c, 0xb4, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 
-	0xec, 0x41, 0xa4, 0x14, 0xe5, 0x1c, 0x4e, 0x4a, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xc5, 0x18, 0x00, 0x00, 0x4f, 0x4a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x2e, 0x46, 0x27, 0x25, 0x83, 0x10, 0x48, 0x29, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 
-	0x34, 0x67, 0x2e, 0x46, 0x27, 0x25, 0x83, 0x10, 0x48, 0x29, 0x70, 0x52, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xc7, 0x14, 0xa5, 0x31, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xe7, 0x18, 0xd2, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xf3, 0x62, 0xf3, 0x5e, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x0d, 0x42, 
-	0x00, 0x00, 0xe5, 0x1c, 0x2e, 0x46, 0xaa, 0x35, 0x06, 0x21, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x90, 0x56, 0x48, 0x29, 0x00, 0x00, 0xcb, 0x39, 
-	0x6f, 0x4e, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0xaa, 0x35, 
-	0x34, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0xaa, 0x35, 0x6f, 0x4e, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x52, 0x35, 0x6b, 0x90, 0x52, 0x48, 0x29, 0x00, 0x00, 0xcb, 0x39, 0x6f, 0x4e, 0x34, 0x67, 
-	0xcb, 0x39, 0x00, 0x00, 0xaa, 0x35, 0x6f, 0x4e, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x52, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xc7, 0x14, 0xa5, 0x31, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xe7, 0x18, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x83, 0x10, 0x00, 0x00, 0x48, 0x29, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x5e, 0x35, 0x6b, 0x14, 0x67, 0x62, 0x0c, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x48, 0x29, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xab, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x48, 0x29, 
-	0x34, 0x6b, 0x34, 0x67, 0x4e, 0x4a, 0x2e, 0x46, 0x13, 0x63, 0x35, 0x6b, 0x4f, 0x4e, 0x00, 0x00, 
-	0xcb, 0x39, 0x35, 0x6b, 0x34, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x34, 0x6b, 0x34, 0x67, 
-	0x4e, 0x4a, 0x2e, 0x46, 0x13, 0x63, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xc7, 0x14, 0xa5, 0x31, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xe7, 0x18, 0xb2, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x0d, 0x46, 0x00, 0x00, 0x41, 0x08, 0x14, 0x67, 0x34, 0x6b, 
-	0x35, 0x6b, 0x13, 0x63, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 
-	0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x31, 0x8a, 0x31, 0xf3, 0x5e, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x2d, 0x46, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4f, 0x4a, 0x00, 0x00, 0x69, 0x2d, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x52, 0x00, 0x00, 
-	0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xc7, 0x14, 0xa5, 0x31, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xe7, 0x18, 0xd2, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x62, 0x0c, 0x00, 0x00, 0x6f, 0x4e, 0xb1, 0x56, 
-	0xec, 0x3d, 0x41, 0x08, 0x06, 0x21, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x5a, 0x00, 0x00, 
-	0x83, 0x10, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xec, 0x41, 0x00, 0x00, 0xcb, 0x39, 
-	0x34, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x69, 0x31, 0xa4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 0x34, 0x6b, 0x35, 0x6b, 
-	0xb1, 0x56, 0x69, 0x31, 0xa4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xc7, 0x14, 0xa5, 0x31, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xe7, 0x18, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0xf3, 0x62, 
-	0xf3, 0x62, 0xf2, 0x5e, 0xb1, 0x5a, 0x70, 0x52, 0x27, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 
-	0x00, 0x00, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0x0d, 0x46, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x14, 0x67, 0xa4, 0x14, 0x00, 0x00, 0x70, 0x52, 
-	0x34, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x83, 0x10, 0x90, 0x52, 0xf2, 0x5e, 0x4e, 0x4a, 0x00, 0x00, 
-	0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xab, 0x39, 0x00, 0x00, 0x70, 0x52, 0x34, 0x6b, 0xd2, 0x5a, 
-	0x00, 0x00, 0x83, 0x10, 0x90, 0x52, 0xf2, 0x5e, 0x4f, 0x4a, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x55, 0x4a, 
-	0xf5, 0x3d, 0xf5, 0x3d, 0xf5, 0x3d, 0xf5, 0x3d, 0xd4, 0x35, 0x90, 0x08, 0x0f, 0x19, 0x0f, 0x1d, 
-	0x0e, 0x1d, 0x0e, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 
-	0x0f, 0x1d, 0x0f, 0x1d, 0x0e, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0e, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 
-	0x0f, 0x1d, 0x0e, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0e, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 
-	0x0e, 0x1d, 0x0f, 0x1d, 0x0f, 0x1d, 0xb0, 0x0c, 0xb4, 0x31, 0xf5, 0x3d, 0xf5, 0x3d, 0xf5, 0x3d, 
-	0xf5, 0x3d, 0x34, 0x42, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x1c, 
-	0x0d, 0x46, 0xb1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x41, 0x08, 
-	0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x27, 0x25, 0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x6f, 0x4e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xcb, 0x39, 0x00, 0x00, 0x06, 0x21, 0x14, 0x67, 
-	0x34, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x69, 0x31, 0x35, 0x6b, 0x35, 0x6b, 0xec, 0x3d, 0x00, 0x00, 
-	0x48, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x6f, 0x4e, 0x35, 0x6b, 0x6f, 0x4e, 
-	0x00, 0x00, 0x69, 0x31, 0x35, 0x6b, 0x35, 0x6b, 0xec, 0x3d, 0x00, 0x00, 0x48, 0x2d, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0xb6, 0x52, 0x75, 0x4e, 0x35, 0x67, 0xf6, 0x62, 0x53, 0x25, 0xc8, 0x14, 0xa7, 0x31, 0xf0, 0x14, 
-	0xa7, 0x31, 0xa6, 0x31, 0x2e, 0x21, 0x89, 0x2d, 0xa6, 0x31, 0x6b, 0x29, 0x4c, 0x25, 0xa6, 0x31, 
-	0x88, 0x2d, 0x0e, 0x1d, 0xa6, 0x31, 0xa6, 0x31, 0xef, 0x18, 0xa6, 0x31, 0xa6, 0x31, 0x2e, 0x1d, 
-	0x89, 0x2d, 0xa6, 0x31, 0x6b, 0x29, 0x4d, 0x25, 0xa6, 0x31, 0x88, 0x2d, 0x0f, 0x1d, 0xa6, 0x31, 
-	0xa6, 0x31, 0xef, 0x18, 0xa7, 0x31, 0xe8, 0x18, 0x72, 0x25, 0xd6, 0x5a, 0x36, 0x67, 0xb6, 0x56, 
-	0x75, 0x4e, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5a, 0x20, 0x04, 
-	0xc4, 0x18, 0x07, 0x25, 0x89, 0x31, 0x0c, 0x42, 0x4f, 0x4e, 0x0d, 0x42, 0x00, 0x00, 0x27, 0x25, 
-	0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 
-	0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x8a, 0x35, 0x34, 0x67, 0x35, 0x6b, 0xec, 0x3d, 
-	0x00, 0x00, 0xe5, 0x1c, 0x2e, 0x46, 0x8a, 0x31, 0x27, 0x25, 0x00, 0x00, 0xec, 0x3d, 0x34, 0x6b, 
-	0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0x07, 0x25, 
-	0x2e, 0x4a, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x48, 0x29, 0x8a, 0x35, 0x89, 0x31, 0xa3, 0x14, 0x00, 0x00, 0xc4, 0x18, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0x20, 0x04, 0x0d, 0x46, 0xab, 0x35, 0xaa, 0x35, 0x20, 0x04, 
-	0x62, 0x0c, 0x6f, 0x4e, 0x35, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0x07, 0x25, 0x2e, 0x4a, 0x90, 0x52, 
-	0x00, 0x00, 0x20, 0x04, 0x0d, 0x46, 0xab, 0x35, 0xaa, 0x35, 0x20, 0x04, 0x62, 0x0c, 0x6f, 0x4e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0xb6, 0x56, 0x95, 0x4e, 0x35, 0x67, 0x16, 0x63, 0x53, 0x29, 0xc7, 0x14, 0xa6, 0x31, 0xef, 0x18, 
-	0xa6, 0x31, 0xa6, 0x31, 0x2e, 0x21, 0x89, 0x2d, 0xa6, 0x31, 0x6b, 0x29, 0x4d, 0x25, 0xa6, 0x31, 
-	0xa8, 0x2d, 0x0e, 0x1d, 0xa6, 0x35, 0xa6, 0x31, 0xef, 0x18, 0xa6, 0x31, 0xa6, 0x31, 0x2e, 0x21, 
-	0x89, 0x2d, 0xa6, 0x31, 0x6a, 0x29, 0x4d, 0x25, 0xa6, 0x31, 0xa8, 0x2d, 0x0e, 0x1d, 0xa6, 0x31, 
-	0xa6, 0x31, 0xef, 0x18, 0xa6, 0x31, 0xe8, 0x18, 0x73, 0x29, 0xf6, 0x5e, 0x35, 0x67, 0xb6, 0x56, 
-	0x95, 0x52, 0x35, 0x67, 0x35, 0x67, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x27, 0x25, 0x00, 0x00, 
-	0x4e, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x34, 0x6b, 0x14, 0x63, 
-	0xcb, 0x3d, 0x83, 0x10, 0x06, 0x21, 0x4f, 0x4a, 0x6f, 0x4e, 0x00, 0x00, 0xcc, 0x3d, 0x34, 0x6b, 
-	0x34, 0x6b, 0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0xf3, 0x62, 0x69, 0x2d, 0x62, 0x0c, 
-	0x27, 0x25, 0x13, 0x63, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xe6, 0x1c, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x27, 0x25, 0x0d, 0x42, 0xf3, 0x62, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x2e, 0x4a, 0xe6, 0x1c, 0xa4, 0x18, 0xec, 0x41, 0x14, 0x67, 0x4e, 0x4a, 
-	0x06, 0x21, 0x48, 0x29, 0x34, 0x6b, 0xf3, 0x62, 0x68, 0x2d, 0x62, 0x0c, 0x27, 0x25, 0x13, 0x63, 
-	0x2e, 0x4a, 0xe6, 0x1c, 0xa4, 0x18, 0xec, 0x41, 0x14, 0x67, 0x4e, 0x4a, 0x06, 0x21, 0x48, 0x29, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x54, 0x4a, 0xb3, 0x0c, 0xb3, 0x0c, 
-	0x93, 0x08, 0x94, 0x08, 0xd4, 0x10, 0xb4, 0x10, 0x74, 0x04, 0x73, 0x04, 0x73, 0x04, 0x74, 0x04, 
-	0x93, 0x04, 0x73, 0x04, 0x74, 0x04, 0x73, 0x04, 0x73, 0x04, 0x73, 0x04, 0x73, 0x04, 0x93, 0x04, 
-	0x73, 0x04, 0x74, 0x04, 0x73, 0x04, 0x73, 0x04, 0x74, 0x04, 0x73, 0x04, 0x73, 0x04, 0x74, 0x04, 
-	0x73, 0x04, 0x73, 0x04, 0x73, 0x04, 0x74, 0x04, 0x73, 0x04, 0x73, 0x04, 0x74, 0x04, 0x73, 0x04, 
-	0x73, 0x04, 0x74, 0x04, 0x73, 0x04, 0x73, 0x04, 0x94, 0x08, 0xd4, 0x14, 0xf4, 0x14, 0xd4, 0x10, 
-	0xb4, 0x0c, 0xd3, 0x10, 0xd4, 0x10, 0x14, 0x3e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x5a, 0x00, 0x00, 
-	0x62, 0x0c, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x16, 0x63, 0x16, 0x63, 
-	0x16, 0x63, 0x16, 0x63, 0xf6, 0x5e, 0xf6, 0x5e, 0x90, 0x31, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 
-	0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 
-	0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xab, 0x10, 
-	0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 
-	0xaa, 0x10, 0xab, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0x4e, 0x25, 0xd5, 0x5a, 0xf6, 0x5e, 0xf6, 0x5e, 
-	0xf6, 0x5e, 0x16, 0x63, 0xf6, 0x62, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x13, 0x63, 0xd2, 0x5a, 0xb1, 0x56, 0xb1, 0x5a, 0xd2, 0x5a, 0x13, 0x63, 0xec, 0x3d, 
-	0x00, 0x00, 0x48, 0x29, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xee, 0x3d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xac, 0x35, 0x14, 0x67, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 
-	0x69, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 
-	0x00, 0x00, 0x00, 0x00, 0xcb, 0x39, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0xcd, 0x39, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x8c, 0x31, 0x14, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4f, 0x4a, 0x00, 0x00, 
-	0x00, 0x00, 0xaa, 0x35, 0x2e, 0x46, 0x4f, 0x4e, 0x4f, 0x4e, 0x0d, 0x42, 0x69, 0x2d, 0x20, 0x04, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x67, 
-	0x14, 0x63, 0xac, 0x31, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x6b, 0x2d, 
-	0xf4, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x62, 0x0c, 0x21, 0x08, 
-	0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 
-	0x6f, 0x4e, 0x06, 0x21, 0xc5, 0x1c, 0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 
-	0x4a, 0x29, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0x09, 0x21, 0xd2, 0x5a, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x5a, 0x00, 0x00, 0x68, 0x2d, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x91, 0x52, 0xe9, 0x1c, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0x50, 0x4a, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x83, 0x10, 
-	0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xee, 0x3d, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xac, 0x35, 0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x27, 0x25, 0x00, 0x00, 
-	0x06, 0x21, 0x90, 0x52, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x91, 0x52, 0x2a, 0x25, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x09, 0x1d, 0x71, 0x4e, 0x35, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0x07, 0x25, 
-	0x00, 0x00, 0x00, 0x00, 0x83, 0x10, 0x89, 0x31, 0xec, 0x41, 0x0d, 0x46, 0x0d, 0x42, 0xec, 0x3d, 
-	0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x67, 0xd3, 0x5a, 0xac, 0x35, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x6b, 0x2d, 0xb2, 0x56, 
-	0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 
-	0x6f, 0x4e, 0x27, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x18, 
-	0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xb2, 0x5a, 
-	0xcd, 0x35, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xa8, 0x14, 
-	0x8c, 0x31, 0xb2, 0x56, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0xf3, 0x5e, 0x90, 0x52, 0x2e, 0x4a, 0xec, 0x3d, 0xcb, 0x39, 0x6f, 0x4e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5a, 0xee, 0x3d, 0xd3, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0x50, 0x4a, 0x6b, 0x29, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0x2a, 0x25, 0x2f, 0x4a, 0xd3, 0x5e, 0x35, 0x67, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0xf3, 0x5e, 0x0e, 0x42, 0xb2, 0x56, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb2, 0x56, 0xc8, 0x14, 0x6b, 0x2d, 0x2f, 0x46, 
-	0x92, 0x56, 0xf3, 0x5e, 0x14, 0x67, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x14, 0x63, 
-	0xd3, 0x5a, 0x91, 0x52, 0x0f, 0x42, 0x6b, 0x29, 0xa8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xa8, 0x14, 0x4a, 0x25, 0x0e, 0x42, 0x70, 0x4e, 
-	0xd2, 0x5a, 0xf4, 0x62, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xf3, 0x5e, 
-	0xb2, 0x56, 0x50, 0x4a, 0x8c, 0x31, 0xc8, 0x14, 0x71, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x91, 0x52, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xa8, 0x14, 0xc8, 0x18, 0xe9, 0x1c, 0xe8, 0x18, 0xc8, 0x14, 0xa8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xa8, 0x14, 0xa8, 0x14, 0xe8, 0x18, 0xe9, 0x18, 0xc8, 0x14, 0xa8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x50, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xb2, 0x56, 0xe9, 0x18, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0x70, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x91, 0x56, 0xaa, 0x35, 0xc5, 0x18, 
-	0x41, 0x08, 0xe5, 0x1c, 0xab, 0x39, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x10, 0x48, 0x29, 0x2d, 0x46, 0xf3, 0x62, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 
-	0x6b, 0x29, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0x29, 0x21, 0xb2, 0x5a, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x21, 0x04, 0xab, 0x35, 
-	0xec, 0x3d, 0x48, 0x29, 0x00, 0x00, 0x62, 0x0c, 0xd2, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0xe5, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 0x69, 0x2d, 0x62, 0x0c, 0x00, 0x00, 0xa3, 0x14, 
-	0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x20, 0x04, 0x70, 0x52, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x67, 0x2f, 0x46, 0xc8, 0x18, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x0e, 0x3e, 
-	0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x06, 0x21, 0x00, 0x00, 0x90, 0x52, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0xcb, 0x39, 0x27, 0x25, 0x6f, 0x4e, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xcb, 0x39, 0x00, 0x00, 
-	0xc4, 0x18, 0x14, 0x63, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf4, 0x5e, 0x2f, 0x42, 0x09, 0x1d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xe8, 0x18, 0xee, 0x3d, 0xf3, 0x5e, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x83, 0x10, 0x00, 0x00, 0xb1, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x6f, 0x4e, 0x48, 0x29, 0x62, 0x0c, 0x27, 0x25, 0x4f, 0x4a, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0xf3, 0x5e, 0x2e, 0x4a, 0xe5, 0x1c, 0x06, 0x21, 0x4e, 0x4a, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xec, 0x41, 0xa4, 0x14, 0xe5, 0x1c, 0x4e, 0x4a, 0x4e, 0x4a, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xc5, 0x18, 
-	0x00, 0x00, 0x4f, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x2e, 0x46, 0x27, 0x25, 0x83, 0x10, 
-	0x48, 0x29, 0x6f, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x34, 0x67, 0x34, 0x67, 0x2e, 0x46, 0x27, 0x25, 0x83, 0x10, 0x48, 0x29, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xd2, 0x5a, 0x70, 0x4e, 0x2f, 0x46, 
-	0x0e, 0x42, 0xee, 0x3d, 0xcd, 0x39, 0xcd, 0x39, 0xac, 0x35, 0xac, 0x35, 0xac, 0x31, 0x8c, 0x31, 
-	0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0xac, 0x35, 0xac, 0x35, 
-	0xad, 0x35, 0xac, 0x10, 0x8c, 0x0c, 0x6c, 0x08, 0x8c, 0x08, 0x8c, 0x08, 0x6c, 0x08, 0x6d, 0x08, 
-	0x6d, 0x08, 0x6d, 0x04, 0x6d, 0x04, 0x6d, 0x04, 0x6e, 0x04, 0x6e, 0x04, 0x6e, 0x00, 0x6f, 0x00, 
-	0x6f, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x91, 0x08, 0x71, 0x04, 0x50, 0x00, 0x4f, 0x00, 
-	0x6f, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x6e, 0x04, 0x6d, 0x04, 0x6d, 0x04, 0x6d, 0x04, 
-	0x6d, 0x08, 0x6d, 0x08, 0x6c, 0x08, 0x6c, 0x08, 0x8c, 0x08, 0x8c, 0x08, 0x8c, 0x0c, 0xac, 0x10, 
-	0x8d, 0x31, 0xac, 0x35, 0xac, 0x35, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 
-	0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0xac, 0x35, 0xac, 0x35, 0xcd, 0x39, 0xcd, 0x39, 0xee, 0x3d, 
-	0x0e, 0x42, 0x2f, 0x46, 0x70, 0x4e, 0xb2, 0x56, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0x20, 0x04, 0xaa, 0x35, 0xf3, 0x62, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xaa, 0x35, 0x00, 0x00, 0xc5, 0x18, 0x4f, 0x4e, 
-	0xf2, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x46, 
-	0x00, 0x00, 0x69, 0x2d, 0x70, 0x52, 0xab, 0x39, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xab, 0x39, 0x69, 0x2d, 0xaa, 0x35, 0x00, 0x00, 0x00, 0x00, 0x90, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0xe5, 0x1c, 0x2e, 0x46, 0xaa, 0x35, 0x06, 0x21, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x0d, 0x42, 
-	0x00, 0x00, 0xaa, 0x35, 0x34, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0xaa, 0x35, 0x6f, 0x4e, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x52, 0x34, 0x6b, 0x90, 0x56, 0x48, 0x29, 0x00, 0x00, 0xcb, 0x39, 
-	0x6f, 0x4e, 0x34, 0x67, 0xcb, 0x39, 0x00, 0x00, 0xaa, 0x35, 0x6f, 0x4e, 0xe6, 0x1c, 0x00, 0x00, 
-	0x90, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x21, 0xdb, 0x56, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 
-	0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 
-	0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0x97, 0x2d, 0xdb, 0x5a, 0xbf, 0x77, 0xbf, 0x77, 
-	0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 
-	0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0x3c, 0x63, 0xb4, 0x0c, 
-	0x36, 0x67, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2d, 0x46, 0x00, 0x00, 0x00, 0x00, 0x90, 0x52, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0x27, 0x25, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xc4, 0x18, 0xec, 0x3d, 0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x62, 0x0c, 
-	0x00, 0x00, 0xf3, 0x62, 0x34, 0x6b, 0x34, 0x67, 0xc4, 0x18, 0x83, 0x10, 0x34, 0x67, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xaa, 0x35, 0x34, 0x6b, 0x35, 0x6b, 0xcc, 0x3d, 0x00, 0x00, 0xec, 0x3d, 
-	0x35, 0x6b, 0x14, 0x67, 0x62, 0x0c, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x48, 0x29, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 
-	0x00, 0x00, 0x48, 0x29, 0x34, 0x6b, 0x34, 0x67, 0x4e, 0x4a, 0x2e, 0x46, 0x13, 0x63, 0x35, 0x6b, 
-	0x6f, 0x4e, 0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x34, 0x67, 0x4e, 0x4a, 0x2e, 0x46, 0x13, 0x63, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 
-	0xcb, 0x39, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0xf5, 0x3d, 0x79, 0x4e, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xb7, 0x31, 0x1c, 0x63, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdb, 0x5a, 0x95, 0x2d, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0x83, 0x10, 0x00, 0x00, 0xcc, 0x3d, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xb1, 0x56, 0x0c, 0x42, 
-	0x27, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x56, 0x34, 0x6b, 0xd1, 0x5a, 0x00, 0x00, 
-	0x20, 0x04, 0x4f, 0x4a, 0x4f, 0x4a, 0x4f, 0x4a, 0x06, 0x21, 0x00, 0x00, 0xd2, 0x5a, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0x90, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0xaa, 0x35, 
-	0x34, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x2d, 0x46, 
-	0x00, 0x00, 0xec, 0x41, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x4f, 0x4a, 
-	0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0x90, 0x52, 0x00, 0x00, 0x69, 0x2d, 0x34, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x90, 0x52, 0x00, 0x00, 
-	0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x75, 0x4e, 0x36, 0x21, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 
-	0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 
-	0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x16, 0x1d, 0xf8, 0x39, 0x9a, 0x4e, 0x9a, 0x4e, 
-	0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 
-	0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x9a, 0x4e, 0x99, 0x4e, 0x97, 0x2d, 0x35, 0x46, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x4f, 0x4e, 0x00, 0x00, 0x21, 0x08, 0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0xf3, 0x5e, 0x8a, 0x35, 0x00, 0x00, 0x27, 0x29, 0x34, 0x6b, 0xb1, 0x56, 0x00, 0x00, 
-	0x21, 0x08, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0xd1, 0x5a, 0x34, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x8a, 0x35, 
-	0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0x83, 0x10, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 
-	0x00, 0x00, 0xec, 0x41, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xec, 0x41, 
-	0x00, 0x00, 0xcb, 0x39, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x56, 0x69, 0x31, 0xa4, 0x14, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xab, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x56, 0x69, 0x31, 0xa4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x69, 0x2d, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0xf5, 0x5e, 0xb1, 0x10, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 
-	0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 
-	0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 
-	0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 
-	0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x1d, 0x10, 0x19, 0xb0, 0x10, 0xb5, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x06, 0x21, 0x00, 0x00, 0x0d, 0x42, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0xd1, 0x5a, 0x00, 0x00, 
-	0x41, 0x08, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x8a, 0x35, 
-	0x35, 0x6b, 0xd2, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x0d, 0x46, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xe5, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xa4, 0x14, 
-	0x00, 0x00, 0x70, 0x52, 0x35, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x83, 0x10, 0x90, 0x52, 0xf2, 0x5e, 
-	0x4f, 0x4a, 0x00, 0x00, 0x69, 0x2d, 0x35, 0x6b, 0x35, 0x6b, 0xab, 0x39, 0x00, 0x00, 0x70, 0x52, 
-	0x35, 0x6b, 0xd2, 0x5a, 0x00, 0x00, 0x83, 0x10, 0x90, 0x56, 0xf2, 0x5e, 0x4f, 0x4a, 0x00, 0x00, 
-	0x69, 0x2d, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x07, 0x21, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x27, 0x21, 0x14, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x70, 0x52, 0x00, 0x00, 0x83, 0x10, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5a, 0x69, 0x2d, 0x27, 0x25, 0x13, 0x63, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0x27, 0x25, 0x35, 0x6b, 0x14, 0x67, 0x62, 0x0c, 
-	0x00, 0x00, 0xd2, 0x5a, 0x34, 0x6b, 0x34, 0x67, 0xe6, 0x1c, 0x68, 0x2d, 0x34, 0x67, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x8a, 0x35, 
-	0x34, 0x6b, 0x14, 0x63, 0x41, 0x08, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x27, 0x25, 
-	0x00, 0x00, 0xec, 0x41, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0xcb, 0x39, 0x00, 0x00, 
-	0x06, 0x21, 0x14, 0x67, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x69, 0x31, 0x35, 0x6b, 0x34, 0x6b, 
-	0xec, 0x3d, 0x00, 0x00, 0x48, 0x2d, 0x34, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0x6f, 0x4e, 
-	0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 0x69, 0x31, 0x34, 0x6b, 0x34, 0x6b, 0xec, 0x3d, 0x00, 0x00, 
-	0x48, 0x2d, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x07, 0x21, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x27, 0x21, 0x14, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x67, 0x06, 0x21, 0x00, 0x00, 0x4e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x68, 0x2d, 0x00, 0x00, 0x41, 0x08, 0x89, 0x31, 
-	0xaa, 0x35, 0x27, 0x25, 0x00, 0x00, 0x00, 0x00, 0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x2e, 0x46, 
-	0x00, 0x00, 0x06, 0x21, 0x4e, 0x4a, 0xaa, 0x35, 0x00, 0x00, 0x2e, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x8a, 0x35, 
-	0x35, 0x6b, 0x35, 0x6b, 0xec, 0x3d, 0x00, 0x00, 0xe5, 0x1c, 0x2e, 0x46, 0x8a, 0x31, 0x27, 0x25, 
-	0x00, 0x00, 0xec, 0x41, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xe6, 0x1c, 0x00, 0x00, 0x48, 0x29, 0x8a, 0x35, 0x89, 0x31, 0xa3, 0x14, 0x00, 0x00, 0xa4, 0x18, 
-	0xd2, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0xb1, 0x56, 0x00, 0x00, 0x20, 0x04, 0x0d, 0x42, 0xab, 0x35, 
-	0xaa, 0x35, 0x20, 0x04, 0x62, 0x0c, 0x6f, 0x4e, 0x35, 0x6b, 0x0d, 0x42, 0x00, 0x00, 0x07, 0x25, 
-	0x2e, 0x4a, 0x90, 0x52, 0x00, 0x00, 0x20, 0x04, 0x0d, 0x46, 0xab, 0x35, 0xaa, 0x35, 0x20, 0x04, 
-	0x62, 0x0c, 0x6f, 0x4e, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x07, 0x21, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x27, 0x21, 0x13, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x90, 0x52, 0x00, 0x00, 0xc5, 0x1c, 0x34, 0x67, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x14, 0x67, 0x4f, 0x4e, 0x69, 0x31, 0xe5, 0x1c, 
-	0x41, 0x08, 0xe6, 0x1c, 0xcb, 0x39, 0xd1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x6f, 0x4e, 0x27, 0x29, 0x83, 0x10, 0x48, 0x29, 0x6f, 0x4e, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 
-	0x27, 0x25, 0x00, 0x00, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 0x8a, 0x35, 
-	0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xcb, 0x3d, 0x83, 0x10, 0x06, 0x21, 0x4f, 0x4a, 0x6f, 0x4e, 
-	0x00, 0x00, 0xec, 0x3d, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x27, 0x25, 0x0d, 0x46, 0xf3, 0x62, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x4a, 0xe6, 0x1c, 0xc4, 0x18, 0xec, 0x41, 
-	0x14, 0x67, 0x4e, 0x4a, 0x06, 0x21, 0x48, 0x29, 0x35, 0x6b, 0xf3, 0x62, 0x69, 0x2d, 0x62, 0x0c, 
-	0x27, 0x25, 0x13, 0x63, 0x2e, 0x4a, 0xe6, 0x1c, 0xa4, 0x18, 0xec, 0x41, 0x34, 0x67, 0x4e, 0x4a, 
-	0x06, 0x21, 0x48, 0x29, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x07, 0x21, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x27, 0x21, 0x14, 0x63, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0x27, 0x25, 0x00, 0x00, 0x89, 0x31, 0x48, 0x2d, 0x00, 0x00, 0xaa, 0x35, 0x14, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x07, 0x21, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x27, 0x21, 0x14, 0x63, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x3d, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x07, 0x21, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x27, 0x21, 0x14, 0x63, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x06, 0x21, 
-	0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 0xd2, 0x5a, 0xb1, 0x5a, 0x00, 0x00, 0x20, 0x04, 0x13, 0x63, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xd5, 0x5e, 0xd5, 0x5a, 0xd5, 0x5e, 0xd5, 0x5e, 0xd5, 0x5e, 
-	0xd5, 0x5a, 0xd5, 0x56, 0xea, 0x1c, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 
-	0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 
-	0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 
-	0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 
-	0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x89, 0x2d, 0x0a, 0x1d, 0xb4, 0x56, 
-	0xd5, 0x5a, 0xd5, 0x5a, 0xd5, 0x5e, 0xd5, 0x5e, 0xd6, 0x5a, 0xd5, 0x5e, 0x35, 0x67, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x6f, 0x4e, 0x00, 0x00, 
-	0x00, 0x00, 0xab, 0x35, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0x48, 0x29, 0x00, 0x00, 0x6f, 0x4e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x70, 0x52, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf5, 0x5a, 0x93, 0x08, 0x74, 0x04, 0x74, 0x00, 0x73, 0x00, 0x74, 0x04, 
-	0x74, 0x00, 0x74, 0x04, 0x74, 0x04, 0x93, 0x08, 0x74, 0x04, 0x74, 0x04, 0x93, 0x08, 0x93, 0x08, 
-	0x74, 0x04, 0x74, 0x04, 0x93, 0x08, 0x93, 0x08, 0x74, 0x04, 0x93, 0x08, 0x93, 0x04, 0x93, 0x08, 
-	0x74, 0x04, 0x93, 0x04, 0x93, 0x08, 0x93, 0x08, 0x74, 0x04, 0x93, 0x08, 0x93, 0x08, 0x93, 0x08, 
-	0x74, 0x04, 0x93, 0x08, 0x93, 0x08, 0x93, 0x08, 0x74, 0x04, 0x93, 0x08, 0x93, 0x08, 0x93, 0x08, 
-	0x74, 0x04, 0x93, 0x04, 0x93, 0x08, 0x74, 0x04, 0x74, 0x04, 0x93, 0x08, 0x74, 0x04, 0x74, 0x04, 
-	0x74, 0x04, 0x74, 0x00, 0x74, 0x04, 0x74, 0x00, 0x74, 0x04, 0x73, 0x00, 0xb5, 0x56, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xc5, 0x18, 0x00, 0x00, 
-	0x69, 0x2d, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x4e, 0x4a, 0x00, 0x00, 0x69, 0x2d, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xe5, 0x1c, 0xa4, 0x14, 0xf2, 0x5e, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x36, 0x67, 0x96, 0x52, 0xf6, 0x39, 0x16, 0x67, 0x16, 0x63, 
-	0x76, 0x4e, 0xf6, 0x3d, 0x09, 0x1d, 0xa8, 0x31, 0x2e, 0x21, 0x2e, 0x21, 0xa7, 0x31, 0xa7, 0x31, 
-	0x10, 0x19, 0x4c, 0x25, 0xa7, 0x31, 0xa8, 0x31, 0xf1, 0x18, 0x6b, 0x29, 0xa7, 0x31, 0xa8, 0x31, 
-	0xd1, 0x10, 0x8a, 0x2d, 0xa7, 0x31, 0xa8, 0x31, 0xb3, 0x10, 0x88, 0x2d, 0xa7, 0x31, 0x89, 0x2d, 
-	0xb2, 0x0c, 0xa8, 0x31, 0xa8, 0x31, 0x8a, 0x2d, 0xd1, 0x10, 0xa8, 0x31, 0xa7, 0x31, 0x6a, 0x29, 
-	0xf1, 0x18, 0xa7, 0x31, 0xa7, 0x31, 0x6c, 0x25, 0x10, 0x19, 0xa8, 0x31, 0x08, 0x1d, 0x35, 0x42, 
-	0x36, 0x42, 0x16, 0x63, 0x16, 0x67, 0x36, 0x46, 0x76, 0x4e, 0x16, 0x67, 0x35, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x2e, 0x46, 0x00, 0x00, 0x83, 0x10, 
-	0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 0x00, 0x00, 0x00, 0x00, 
-	0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x2e, 0x4a, 0x00, 0x00, 0x83, 0x10, 0x14, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb5, 0x56, 0x15, 0x3e, 0x34, 0x6b, 0x35, 0x6b, 
-	0x95, 0x52, 0x15, 0x3e, 0x07, 0x21, 0xc5, 0x35, 0x4e, 0x21, 0x4d, 0x25, 0xc5, 0x35, 0xc5, 0x35, 
-	0x10, 0x1d, 0x6b, 0x29, 0xc5, 0x35, 0xc5, 0x35, 0xf1, 0x18, 0x89, 0x2d, 0xc5, 0x35, 0xc5, 0x35, 
-	0xd0, 0x14, 0xa8, 0x2d, 0xc5, 0x35, 0xa5, 0x35, 0xb2, 0x10, 0xa6, 0x31, 0xc5, 0x35, 0xa7, 0x31, 
-	0xb1, 0x0c, 0xc5, 0x35, 0xc5, 0x35, 0xa8, 0x31, 0xd0, 0x10, 0xa5, 0x35, 0xc5, 0x35, 0x89, 0x2d, 
-	0xf1, 0x18, 0xc5, 0x35, 0xc5, 0x35, 0x6a, 0x29, 0x10, 0x1d, 0xc5, 0x35, 0x27, 0x21, 0x34, 0x46, 
-	0x35, 0x46, 0x35, 0x6b, 0x35, 0x6b, 0x55, 0x4a, 0x75, 0x4e, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xf3, 0x62, 0x62, 0x0c, 0x00, 0x00, 0x4e, 0x4a, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x27, 0x25, 0x00, 0x00, 
-	0x0d, 0x42, 0x35, 0x6b, 0xb1, 0x56, 0x21, 0x08, 0x00, 0x00, 0x4f, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x15, 0x63, 0xf6, 0x62, 0x16, 0x63, 0x76, 0x4e, 0xf6, 0x39, 0xf6, 0x62, 0x16, 0x5f, 
-	0x75, 0x4e, 0xf5, 0x39, 0x09, 0x1d, 0x88, 0x2d, 0x2f, 0x1d, 0x2e, 0x21, 0xa7, 0x31, 0xa7, 0x31, 
-	0x10, 0x1d, 0x4c, 0x25, 0xa7, 0x2d, 0xa7, 0x31, 0xf1, 0x18, 0x6b, 0x29, 0xa7, 0x31, 0x88, 0x31, 
-	0xd1, 0x10, 0x6a, 0x2d, 0xa7, 0x2d, 0x88, 0x2d, 0xb2, 0x0c, 0x88, 0x2d, 0xa7, 0x31, 0x88, 0x2d, 
-	0xb2, 0x0c, 0xa7, 0x2d, 0xa7, 0x31, 0x8a, 0x2d, 0xd1, 0x10, 0xa7, 0x31, 0xa7, 0x31, 0x6a, 0x2d, 
-	0xf2, 0x14, 0xa7, 0x31, 0xa7, 0x31, 0x6c, 0x25, 0x10, 0x19, 0xa7, 0x31, 0x08, 0x1d, 0x15, 0x42, 
-	0x16, 0x42, 0x15, 0x63, 0x15, 0x63, 0x36, 0x46, 0x56, 0x4a, 0x15, 0x63, 0x16, 0x63, 0x15, 0x63, 
-	0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xcb, 0x39, 0x00, 0x00, 0xa4, 0x14, 0x14, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x90, 0x52, 0x00, 0x00, 
-	0x00, 0x00, 0x07, 0x25, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x35, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xf5, 0x5e, 0x73, 0x04, 0x74, 0x00, 0x74, 0x00, 0x54, 0x00, 0x54, 0x00, 0x73, 0x00, 0x74, 0x00, 
-	0x74, 0x00, 0x75, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x94, 0x04, 0x74, 0x04, 
-	0x74, 0x04, 0x74, 0x04, 0x94, 0x08, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x94, 0x08, 0x74, 0x08, 
-	0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x75, 0x04, 0x74, 0x04, 0x94, 0x04, 0x74, 0x08, 
-	0x75, 0x04, 0x94, 0x08, 0x94, 0x08, 0x74, 0x08, 0x75, 0x04, 0x94, 0x08, 0x94, 0x08, 0x74, 0x04, 
-	0x75, 0x04, 0x94, 0x08, 0x94, 0x08, 0x74, 0x04, 0x74, 0x04, 0x94, 0x08, 0x74, 0x04, 0x74, 0x08, 
-	0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x00, 0x74, 0x00, 0x74, 0x04, 0x74, 0x04, 0x73, 0x00, 
-	0xb5, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x90, 0x52, 0x48, 0x29, 0xec, 0x41, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xec, 0x3d, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x3d, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x16, 0x63, 0xf6, 0x62, 0xf6, 0x62, 0xf6, 0x5e, 0xf6, 0x62, 0xf6, 0x5e, 0xf6, 0x5e, 
-	0x8f, 0x31, 0xaa, 0x10, 0xaa, 0x10, 0xaa, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 
-	0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 
-	0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 
-	0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 
-	0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xab, 0x10, 0xcc, 0x18, 
-	0x95, 0x4e, 0xf6, 0x5e, 0xf6, 0x5e, 0xf6, 0x5e, 0xf6, 0x5e, 0xf6, 0x5e, 0xf6, 0x5e, 0xf6, 0x62, 
-	0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x14, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xd2, 0x5a, 0x90, 0x52, 0xf3, 0x5e, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x14, 0x63, 0x8c, 0x31, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0x09, 0x1d, 0xb2, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xd3, 0x5a, 0x2a, 0x21, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0x4f, 0x46, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0xd1, 0x5e, 0xf2, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 
-	0x8f, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x6e, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x50, 0x4a, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xac, 0x35, 0xf4, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x8f, 0x56, 0x4d, 0x4e, 0xd1, 0x5e, 0xd2, 0x5e, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 0x6f, 0x52, 
-	0x6e, 0x52, 0xd2, 0x5e, 0x34, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x67, 0xf2, 0x5e, 0x8f, 0x56, 0x4d, 0x4e, 0xd1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x5e, 0xac, 0x31, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x09, 0x21, 0x91, 0x52, 0x35, 0x67, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x67, 0x13, 0x67, 0x13, 0x63, 0x66, 0x31, 0xa8, 0x39, 0xf2, 0x62, 0x35, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x34, 0x67, 0xea, 0x41, 
-	0x87, 0x35, 0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x13, 0x63, 0x34, 0x67, 0x0c, 0x46, 0x87, 0x39, 0x6f, 0x52, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x67, 0x50, 0x4a, 0xe9, 0x1c, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xa8, 0x14, 0xcd, 0x39, 0xf4, 0x5e, 
-	0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0xea, 0x41, 0xa8, 0x39, 0x8f, 0x52, 0x4d, 0x4e, 0xea, 0x41, 0x2c, 0x4a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x6e, 0x4e, 0x87, 0x35, 0xaf, 0x56, 
-	0xca, 0x3d, 0x2c, 0x46, 0x0b, 0x46, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x8f, 0x56, 0x86, 0x35, 0xb0, 0x5a, 0x88, 0x39, 0x2c, 0x4a, 0x0c, 0x46, 0x13, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xb2, 0x56, 
-	0x6b, 0x2d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xe8, 0x18, 
-	0x50, 0x4a, 0x34, 0x63, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x13, 0x63, 0x4d, 0x4e, 0x65, 0x31, 0x87, 0x35, 0xea, 0x41, 0x01, 0x29, 0xd1, 0x5e, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x6e, 0x52, 0x87, 0x39, 0x87, 0x35, 
-	0xea, 0x41, 0x22, 0x29, 0x6e, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb0, 0x56, 0xb1, 0x5a, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x8f, 0x52, 0xa8, 0x39, 0x87, 0x35, 0xc9, 0x41, 0x45, 0x31, 0x4d, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd3, 0x5a, 0xad, 0x35, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0x29, 0x21, 0x70, 0x4e, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x8f, 0x56, 0xf2, 0x62, 0x6e, 0x52, 0xea, 0x41, 0xc9, 0x3d, 0xa8, 0x39, 0xea, 0x41, 0xb0, 0x56, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xb1, 0x5a, 0xf2, 0x5e, 0x8f, 0x56, 0xc9, 0x3d, 0x0b, 0x46, 
-	0x45, 0x2d, 0xea, 0x41, 0x6d, 0x52, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2c, 0x4a, 0x2c, 0x4a, 0xb0, 0x5a, 0xb0, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xd1, 0x5e, 0xd2, 0x5e, 
-	0x90, 0x56, 0xea, 0x41, 0x0b, 0x46, 0x23, 0x2d, 0xc9, 0x41, 0x4d, 0x4e, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xb2, 0x56, 0xad, 0x35, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x29, 0x21, 0x50, 0x4a, 0x14, 0x63, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0xb0, 0x5a, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xea, 0x41, 0x01, 0x29, 0x6f, 0x52, 0x34, 0x6b, 0x8f, 0x52, 0xa8, 0x3d, 0x44, 0x2d, 0xb1, 0x5a, 
-	0x13, 0x63, 0xb0, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0xf2, 0x62, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x6e, 0x4e, 0x01, 0x29, 0xea, 0x41, 0x35, 0x6b, 0xf2, 0x5e, 
-	0xc8, 0x3d, 0x23, 0x2d, 0x4d, 0x4e, 0x34, 0x67, 0x6f, 0x52, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0xf3, 0x62, 0x14, 0x67, 0xf2, 0x62, 0x66, 0x31, 0x66, 0x31, 0xd1, 0x5a, 
-	0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0xf3, 0x62, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xf3, 0x62, 0xf2, 0x62, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x8f, 0x52, 0x01, 0x29, 
-	0xa9, 0x39, 0x34, 0x6b, 0x13, 0x63, 0xa8, 0x39, 0x44, 0x2d, 0x2c, 0x4a, 0x34, 0x67, 0x6f, 0x52, 
-	0xf3, 0x5e, 0x70, 0x4e, 0x6b, 0x29, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x18, 0xee, 0x3d, 0xb2, 0x5a, 
-	0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0xd2, 0x5e, 0x0c, 0x46, 
-	0x14, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x4d, 0x4e, 0x01, 0x29, 0x45, 0x2d, 0xf2, 0x62, 0x2d, 0x4a, 0x65, 0x31, 0xc9, 0x3d, 0xc9, 0x3d, 
-	0x23, 0x29, 0x6e, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 0x2c, 0x4a, 0xd1, 0x5a, 0x13, 0x63, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb0, 0x5a, 0x01, 0x29, 0x02, 0x29, 0xb0, 0x5a, 0xb0, 0x56, 
-	0x02, 0x29, 0xea, 0x41, 0xa8, 0x39, 0x66, 0x31, 0xea, 0x41, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x13, 0x67, 0x66, 0x35, 0xa8, 0x39, 0x8f, 0x52, 0x4d, 0x4a, 0xc9, 0x3d, 
-	0xea, 0x41, 0xf2, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x14, 0x67, 0xcd, 0x39, 0x4f, 0x4a, 0xf3, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 
-	0x8f, 0x56, 0xd1, 0x5e, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xd1, 0x5e, 0x22, 0x29, 
-	0x01, 0x29, 0x8f, 0x56, 0xd1, 0x5e, 0x01, 0x29, 0xeb, 0x41, 0x87, 0x31, 0x68, 0x2d, 0xe7, 0x1c, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0x09, 0x21, 0x0e, 0x42, 0xb2, 0x56, 0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0xf4, 0x62, 0x4f, 0x4a, 0xe6, 0x1c, 0xca, 0x3d, 
-	0x2c, 0x4a, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x88, 0x39, 0x23, 0x2d, 0x87, 0x39, 0x44, 0x2d, 0x86, 0x35, 0xa7, 0x39, 0x22, 0x29, 0x01, 0x29, 
-	0xa8, 0x3d, 0x13, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0xf2, 0x5e, 0xf2, 0x62, 0xea, 0x41, 0xc9, 0x3d, 0x13, 0x67, 0x34, 0x67, 0x35, 0x67, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xeb, 0x41, 0x22, 0x29, 0x86, 0x35, 0x23, 0x29, 0x87, 0x39, 
-	0x66, 0x35, 0x65, 0x31, 0x01, 0x29, 0x44, 0x2d, 0xf2, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 0x2c, 0x4a, 0x23, 0x2d, 0x87, 0x35, 0x0b, 0x46, 0x01, 0x29, 
-	0x4d, 0x4e, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0xac, 0x35, 0xc8, 0x14, 0x4b, 0x29, 0x0f, 0x42, 0xec, 0x3d, 
-	0x67, 0x2d, 0x2c, 0x4a, 0x6f, 0x4e, 0x14, 0x67, 0x34, 0x67, 0x14, 0x67, 0xcb, 0x3d, 0x03, 0x25, 
-	0x04, 0x25, 0xe4, 0x20, 0x89, 0x31, 0xe7, 0x1c, 0x09, 0x1d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x4a, 0x29, 0x0e, 0x42, 0x70, 0x4e, 0xb2, 0x56, 
-	0xf3, 0x5e, 0x14, 0x63, 0x14, 0x63, 0x34, 0x67, 0x34, 0x67, 0x14, 0x67, 0x14, 0x63, 0xf4, 0x5e, 
-	0xd2, 0x5a, 0x91, 0x52, 0x2f, 0x42, 0x6b, 0x2d, 0xc8, 0x14, 0xc7, 0x18, 0x6f, 0x52, 0x45, 0x31, 
-	0x6f, 0x52, 0xb0, 0x5a, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xd1, 0x5e, 0x0b, 0x46, 0x44, 0x2d, 0xc9, 0x41, 0x66, 0x35, 0x01, 0x29, 0x22, 0x29, 0x23, 0x2d, 
-	0xa8, 0x39, 0xd1, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x8f, 0x56, 0x23, 0x2d, 0x2c, 0x4a, 0x2c, 0x4a, 0x45, 0x2d, 0xf2, 0x5e, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xf3, 0x62, 0x4d, 0x4e, 0x22, 0x29, 0xa8, 0x39, 0xc9, 0x3d, 
-	0x01, 0x29, 0x01, 0x29, 0x43, 0x2d, 0x86, 0x35, 0x8f, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xf2, 0x5e, 0xd1, 0x5a, 0xf2, 0x5e, 0x2c, 0x4a, 0xc9, 0x3d, 0xa8, 0x39, 0x86, 0x35, 0xe9, 0x41, 
-	0x2c, 0x4a, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xee, 0x3d, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xc8, 0x18, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xc8, 0x18, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x6a, 0x29, 0x88, 0x39, 0xea, 0x41, 0xe9, 0x41, 
-	0xa8, 0x39, 0xc9, 0x3d, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0xd1, 0x5a, 0x86, 0x35, 0x02, 0x29, 0x44, 0x2d, 0x01, 0x29, 0xc9, 0x3d, 0xea, 0x41, 0xf2, 0x5e, 
-	0xf3, 0x62, 0x34, 0x67, 0xb0, 0x56, 0xb0, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x13, 0x63, 0x12, 0x63, 0x86, 0x35, 0x44, 0x2d, 0x66, 0x35, 0xa7, 0x39, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x0b, 0x46, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 0xea, 0x41, 0x01, 0x29, 0x44, 0x2d, 0x22, 0x29, 
-	0xa8, 0x39, 0xa8, 0x39, 0xb0, 0x56, 0x13, 0x67, 0x13, 0x63, 0xf2, 0x5e, 0x8f, 0x52, 0x34, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xb0, 0x5a, 0x23, 0x2d, 0x22, 0x29, 0xf2, 0x62, 0x34, 0x6b, 0x6f, 0x52, 0xe9, 0x41, 0x44, 0x2d, 
-	0x0b, 0x46, 0x34, 0x6b, 0xd1, 0x5a, 0xf2, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x2f, 0x4a, 0xe8, 0x18, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x2e, 0x46, 0xd2, 0x5e, 0x45, 0x31, 0x66, 0x35, 0x23, 0x29, 
-	0x86, 0x35, 0x0c, 0x46, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x23, 0x29, 0x23, 0x2d, 0xa7, 0x39, 0x86, 0x35, 0x23, 0x2d, 0x0b, 0x46, 0x4d, 0x4e, 0x0b, 0x46, 
-	0x44, 0x2d, 0xa8, 0x39, 0x01, 0x29, 0x66, 0x35, 0x2d, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x13, 0x67, 
-	0xa8, 0x39, 0xc9, 0x3d, 0x13, 0x67, 0x90, 0x56, 0xc8, 0x3d, 0xc9, 0x3d, 0x13, 0x67, 0xd1, 0x5e, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0xd1, 0x5e, 0x6e, 0x52, 0xeb, 0x41, 0xd1, 0x5e, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0xb0, 0x5a, 0x88, 0x39, 0x23, 0x2d, 0xa7, 0x39, 0x86, 0x35, 0x23, 0x2d, 
-	0xc9, 0x3d, 0x4d, 0x4e, 0x2c, 0x4a, 0x45, 0x31, 0xa8, 0x39, 0x22, 0x29, 0x65, 0x31, 0xca, 0x3d, 
-	0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x12, 0x67, 0x44, 0x31, 0x01, 0x29, 0xea, 0x41, 0x34, 0x67, 0x2c, 0x4a, 0x22, 0x29, 0xc9, 0x41, 
-	0xa8, 0x39, 0xc9, 0x3d, 0x65, 0x31, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x35, 0x6b, 0x0d, 0x46, 0xc7, 0x18, 
-	0xa8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0x6b, 0x29, 0x4e, 0x4a, 0x66, 0x35, 0x0b, 0x46, 0x14, 0x67, 0x13, 0x63, 0x87, 0x39, 
-	0xa8, 0x39, 0x0c, 0x46, 0x35, 0x6b, 0xf3, 0x62, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x01, 0x29, 0x87, 0x39, 0x44, 0x2d, 0x65, 0x31, 0x65, 0x31, 0xa8, 0x3d, 0x01, 0x29, 0x01, 0x29, 
-	0x66, 0x35, 0x23, 0x29, 0x2c, 0x4a, 0xf2, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0xa8, 0x39, 0x01, 0x29, 0x8f, 0x56, 0x6e, 0x4e, 0x87, 0x35, 0xa7, 0x39, 0xc9, 0x3d, 0xc9, 0x3d, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x8f, 0x56, 0x34, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x67, 0x13, 0x67, 0x34, 0x67, 0x0c, 0x46, 0x86, 0x35, 0x0c, 0x46, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x2c, 0x4a, 0x01, 0x29, 0x22, 0x29, 0x87, 0x35, 0x23, 0x29, 0x23, 0x2d, 0x87, 0x39, 
-	0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x23, 0x29, 0x0b, 0x46, 0x90, 0x56, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0xeb, 0x41, 0x01, 0x29, 0x22, 0x29, 0x44, 0x31, 0xa8, 0x39, 0xa7, 0x39, 0xa8, 0x39, 0x87, 0x35, 
-	0x01, 0x29, 0x01, 0x29, 0x4d, 0x4a, 0x14, 0x63, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x0b, 0x46, 0xea, 0x41, 0xd1, 0x5e, 0xd2, 0x5e, 
-	0x2e, 0x4a, 0xe8, 0x1c, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0x2a, 0x25, 
-	0x71, 0x4e, 0x34, 0x67, 0xd1, 0x5a, 0x02, 0x29, 0x01, 0x29, 0xf2, 0x5e, 0xf2, 0x62, 0x01, 0x29, 
-	0x66, 0x35, 0x0b, 0x46, 0x2d, 0x4a, 0xa9, 0x3d, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x6e, 0x52, 0xf3, 0x62, 0x4d, 0x4e, 0xa7, 0x39, 0x01, 0x29, 0x87, 0x35, 0x8f, 0x56, 0x6f, 0x52, 
-	0x2c, 0x4a, 0xb0, 0x5a, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 
-	0xea, 0x41, 0x66, 0x35, 0x45, 0x31, 0x45, 0x31, 0x65, 0x31, 0x01, 0x29, 0x02, 0x29, 0xd1, 0x5e, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x6e, 0x52, 
-	0x2c, 0x4a, 0xd1, 0x5a, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x4d, 0x4e, 0xa8, 0x39, 0xd1, 0x5a, 0x44, 0x2d, 0x6e, 0x52, 0x4d, 0x4e, 0x90, 0x56, 
-	0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x6e, 0x52, 0x13, 0x67, 0x4d, 0x4e, 0xea, 0x45, 0x23, 0x29, 
-	0x44, 0x2d, 0x6e, 0x52, 0xb0, 0x5a, 0x0b, 0x42, 0xb0, 0x5a, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x67, 
-	0x34, 0x67, 0xaf, 0x56, 0x87, 0x35, 0xa8, 0x39, 0x0a, 0x46, 0x45, 0x31, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x22, 0x29, 0x0b, 0x46, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x34, 0x6b, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x13, 0x67, 0x87, 0x35, 0x01, 0x29, 0x0c, 0x46, 0x35, 0x6b, 
-	0x4d, 0x4e, 0x24, 0x2d, 0x05, 0x25, 0xe7, 0x1c, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 
-	0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x14, 0xc8, 0x18, 0xac, 0x35, 0x91, 0x52, 0x34, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x0b, 0x46, 0x01, 0x29, 0x22, 0x29, 0x45, 0x2d, 0x2c, 0x4a, 0x44, 0x2d, 
-	0x0a, 0x46, 0x01, 0x29, 0x01, 0x29, 0x2d, 0x4a, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xc9, 0x3d, 0x6f, 0x52, 0x86, 0x35, 0x65, 0x31, 0x02, 0x29, 0x01, 0x29, 0x22, 0x29, 0x0b, 0x46, 
-	0xc9, 0x3d, 0xa7, 0x39, 0xa9, 0x39, 0x6e, 0x4e, 0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x6e, 0x52, 0x44, 0x2d, 0x65, 0x31, 0x87, 0x39, 0x01, 0x29, 0x65, 0x31, 0x2d, 0x4a, 0xb1, 0x5a, 
-	0x34, 0x6b, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xb1, 0x5a, 0xb0, 0x5a, 
-	0x44, 0x2d, 0x6e, 0x52, 0x13, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x14, 0x67, 0x2c, 0x4a, 0xa8, 0x39, 0xc9, 0x3d, 0xa8, 0x39, 0xea, 0x41, 0x66, 0x35, 0xd1, 0x5e, 
-	0x4e, 0x4e, 0xd1, 0x5e, 0xa8, 0x39, 0x66, 0x35, 0x6e, 0x52, 0xca, 0x3d, 0x22, 0x29, 0x65, 0x31, 
-	0x01, 0x29, 0x01, 0x29, 0xc9, 0x3d, 0x0c, 0x46, 0x65, 0x31, 0xca, 0x3d, 0x4d, 0x4a, 0xb0, 0x56, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x14, 0x67, 0x2c, 0x4a, 0x01, 0x29, 0x01, 0x29, 0x23, 0x29, 0x23, 0x29, 0x44, 0x2d, 0x65, 0x31, 
-	0x2c, 0x4a, 0xf2, 0x62, 0x13, 0x67, 0x35, 0x6b, 0xd2, 0x5e, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd2, 0x5e, 0xa9, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x4d, 0x4e, 
-	0x0b, 0x46, 0xc9, 0x41, 0xc9, 0x3d, 0x01, 0x29, 0x02, 0x29, 0x04, 0x21, 0xe5, 0x20, 0xe6, 0x1c, 
-	0xe6, 0x1c, 0xc6, 0x1c, 0x08, 0x25, 0xc7, 0x18, 0xc7, 0x18, 0xc7, 0x18, 0xc7, 0x18, 0xc7, 0x18, 
-	0xc7, 0x18, 0xc7, 0x18, 0xe8, 0x1c, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 
-	0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0xe8, 0x1c, 0xc7, 0x18, 0xc9, 0x14, 0x90, 0x0c, 0x90, 0x08, 
-	0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x08, 0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x0c, 
-	0x91, 0x0c, 0x91, 0x08, 0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x08, 0x91, 0x08, 0x91, 0x0c, 
-	0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x08, 0x91, 0x08, 
-	0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x08, 0x91, 0x08, 0x91, 0x08, 
-	0x91, 0x08, 0x91, 0x08, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x0c, 0x91, 0x08, 0x91, 0x08, 0x91, 0x0c, 
-	0x91, 0x0c, 0x91, 0x0c, 0x91, 0x0c, 0x0e, 0x1d, 0x6b, 0x2d, 0x6b, 0x29, 0x6b, 0x29, 0x4a, 0x29, 
-	0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x09, 0x21, 0xc7, 0x18, 
-	0xc7, 0x18, 0x6a, 0x29, 0x29, 0x25, 0xc7, 0x18, 0xc7, 0x18, 0x6a, 0x2d, 0x4a, 0x29, 0x08, 0x21, 
-	0xee, 0x3d, 0x2f, 0x46, 0x70, 0x4e, 0xb2, 0x56, 0x14, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x6f, 0x52, 0x66, 0x35, 0xa8, 0x3d, 0xa8, 0x39, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 0x8f, 0x52, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x43, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xa8, 0x39, 0x13, 0x63, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 
-	0xc9, 0x41, 0x86, 0x35, 0x86, 0x35, 0x02, 0x29, 0x2c, 0x4a, 0x8f, 0x56, 0x8f, 0x52, 0x4d, 0x4e, 
-	0xc9, 0x3d, 0xca, 0x3d, 0xd1, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xc9, 0x3d, 0xa8, 0x39, 
-	0x0a, 0x46, 0xea, 0x41, 0x0b, 0x46, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 
-	0x34, 0x6b, 0x8f, 0x56, 0x22, 0x29, 0x87, 0x35, 0x22, 0x2d, 0x86, 0x35, 0xa7, 0x39, 0x2c, 0x4a, 
-	0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x43, 0x2d, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x45, 0x31, 0xd1, 0x5a, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0x2c, 0x4a, 0x86, 0x35, 0x86, 0x35, 0xa7, 0x39, 0xa7, 0x39, 0x01, 0x29, 0x4d, 0x4e, 0x6e, 0x52, 
-	0xb1, 0x5a, 0x0c, 0x46, 0xc9, 0x3d, 0xeb, 0x41, 0x01, 0x29, 0x87, 0x39, 0x2c, 0x4a, 0x34, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x6f, 0x52, 0xea, 0x41, 0xc8, 0x3d, 0x44, 0x2d, 
-	0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x29, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0xc9, 0x3d, 0x01, 0x29, 0x04, 0x25, 0x93, 0x08, 0x3c, 0x67, 
-	0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 
-	0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 
-	0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x3c, 0x63, 0x95, 0x08, 0x9a, 0x4e, 0x5c, 0x67, 0x5c, 0x67, 
-	0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 
-	0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 0x5c, 0x67, 
-	0x5c, 0x67, 0x5c, 0x67, 0x18, 0x3e, 0x95, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x8f, 0x56, 0x01, 0x25, 
-	0x01, 0x29, 0x6f, 0x52, 0xb0, 0x56, 0x44, 0x2d, 0x0b, 0x46, 0x44, 0x2d, 0x22, 0x29, 0xea, 0x41, 
-	0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0xc9, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x23, 0x2d, 
-	0x23, 0x2d, 0x0a, 0x46, 0xd2, 0x5e, 0x13, 0x63, 0x34, 0x6b, 0xd2, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 
-	0x23, 0x2d, 0xa8, 0x39, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 
-	0x01, 0x29, 0x44, 0x2d, 0x4d, 0x4e, 0xf2, 0x62, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4d, 0x4e, 0x01, 0x29, 
-	0x02, 0x29, 0x23, 0x2d, 0x02, 0x29, 0x65, 0x35, 0x65, 0x31, 0x01, 0x29, 0x23, 0x2d, 0x02, 0x29, 
-	0xa8, 0x3d, 0xb0, 0x56, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x67, 0x33, 0x67, 0x2c, 0x4a, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 0x34, 0x67, 0x6e, 0x52, 0x66, 0x35, 
-	0x23, 0x2d, 0x87, 0x39, 0x8f, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x2d, 0x4a, 
-	0x87, 0x35, 0x6f, 0x52, 0x13, 0x67, 0x13, 0x67, 0x65, 0x31, 0xc9, 0x3d, 0x0b, 0x46, 0x13, 0x63, 
-	0xb0, 0x56, 0xc9, 0x41, 0x0b, 0x46, 0x22, 0x29, 0x66, 0x31, 0x66, 0x35, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x22, 0x29, 0x44, 0x2d, 0x2c, 0x4a, 0xd1, 0x5a, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x6e, 0x52, 0x23, 0x2d, 
-	0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x01, 0x29, 0x44, 0x31, 0x66, 0x35, 0x65, 0x31, 0x01, 0x29, 
-	0x01, 0x29, 0x22, 0x29, 0x01, 0x29, 0x65, 0x31, 0xa7, 0x39, 0xd1, 0x5a, 0x34, 0x67, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x6e, 0x52, 0x44, 0x2d, 0x01, 0x29, 0xc9, 0x3d, 
-	0x66, 0x35, 0x01, 0x29, 0x22, 0x29, 0xea, 0x41, 0xa8, 0x39, 0x0b, 0x46, 0x22, 0x29, 0x45, 0x31, 
-	0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x44, 0x2d, 
-	0x0b, 0x46, 0xb0, 0x5a, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x2c, 0x46, 0x87, 0x39, 0xa7, 0x39, 0x87, 0x35, 0xb1, 0x14, 0x9e, 0x73, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x7b, 0x95, 0x0c, 0x1c, 0x63, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xb7, 0x35, 0xf5, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x4d, 0x4e, 0x87, 0x35, 
-	0x87, 0x39, 0x44, 0x2d, 0x44, 0x2d, 0x45, 0x31, 0x22, 0x29, 0x01, 0x29, 0x65, 0x31, 0x13, 0x67, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x2c, 0x4a, 0x87, 0x39, 0xa7, 0x39, 0x87, 0x39, 0x23, 0x2d, 0xea, 0x41, 
-	0x6e, 0x52, 0xd1, 0x5e, 0x2c, 0x46, 0x0b, 0x46, 0xa9, 0x39, 0x24, 0x2d, 0x0b, 0x42, 0x13, 0x63, 
-	0xd1, 0x5e, 0x0b, 0x46, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0xea, 0x41, 
-	0x0b, 0x46, 0x0b, 0x46, 0x01, 0x29, 0x2c, 0x4a, 0xb1, 0x5a, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 0xb0, 0x5a, 
-	0x90, 0x56, 0x6f, 0x52, 0xea, 0x41, 0x23, 0x2d, 0xa8, 0x39, 0x8e, 0x52, 0x2c, 0x4a, 0x6e, 0x52, 
-	0x13, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x67, 0xea, 0x41, 0x0b, 0x46, 0x4d, 0x4e, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x8f, 0x56, 0x23, 0x2d, 0xb0, 0x56, 0x34, 0x67, 
-	0xc9, 0x3d, 0x87, 0x39, 0x8f, 0x52, 0x13, 0x63, 0xf2, 0x5e, 0x35, 0x67, 0x34, 0x67, 0xea, 0x41, 
-	0x01, 0x29, 0x45, 0x31, 0x13, 0x67, 0xf2, 0x62, 0x23, 0x2d, 0x22, 0x29, 0xc9, 0x3d, 0x90, 0x56, 
-	0xa8, 0x39, 0x8f, 0x56, 0x34, 0x67, 0xd1, 0x5e, 0x4d, 0x4e, 0x23, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0xa7, 0x39, 0x2c, 0x4a, 0x2c, 0x4a, 0x02, 0x29, 0xa8, 0x39, 0xd1, 0x5e, 
-	0x13, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xf2, 0x62, 0x8f, 0x52, 
-	0x0c, 0x46, 0x6e, 0x4e, 0x6e, 0x52, 0x8e, 0x56, 0xa8, 0x3d, 0x01, 0x29, 0xc8, 0x3d, 0x4d, 0x4e, 
-	0x0c, 0x46, 0x65, 0x31, 0x2c, 0x4a, 0x4e, 0x4e, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x2d, 0x4a, 0x86, 0x35, 0x86, 0x35, 0xa8, 0x3d, 
-	0x01, 0x29, 0x6e, 0x52, 0x4d, 0x4e, 0xb0, 0x5a, 0x4d, 0x4e, 0xd0, 0x5a, 0x86, 0x35, 0x87, 0x39, 
-	0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x86, 0x35, 0x2c, 0x4a, 0x4d, 0x4a, 
-	0x01, 0x29, 0x66, 0x35, 0xd2, 0x5e, 0x13, 0x63, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xb0, 0x56, 0x44, 0x2d, 0x01, 0x29, 0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x10, 0x21, 0x1c, 0x63, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x7b, 0x95, 0x08, 0x1c, 0x63, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 
-	0xff, 0x7f, 0xdf, 0x7b, 0x14, 0x1d, 0x35, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 0x0b, 0x46, 
-	0x01, 0x29, 0x87, 0x39, 0xc9, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x86, 0x35, 0xca, 0x3d, 0x8f, 0x56, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0xb0, 0x5a, 0x45, 0x2d, 0x01, 0x29, 0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x86, 0x39, 0x65, 0x31, 
-	0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x01, 0x29, 0xa7, 0x39, 0x0b, 0x46, 0x13, 0x63, 0x35, 0x6b, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0x23, 0x2d, 0x0b, 0x46, 0xf2, 0x62, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xb1, 0x5a, 0x2c, 0x4a, 0x6e, 0x52, 0x23, 0x2d, 
-	0xea, 0x41, 0xea, 0x41, 0x22, 0x29, 0x66, 0x35, 0x01, 0x29, 0x23, 0x2d, 0xea, 0x41, 0x45, 0x31, 
-	0x87, 0x35, 0x2c, 0x46, 0x13, 0x67, 0xb0, 0x5a, 0xd1, 0x5a, 0xb0, 0x56, 0x22, 0x29, 0x6e, 0x52, 
-	0x14, 0x67, 0x14, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0xb0, 0x56, 0x01, 0x29, 0x66, 0x31, 0x13, 0x63, 
-	0x22, 0x29, 0xea, 0x41, 0x87, 0x39, 0x23, 0x29, 0xb1, 0x5a, 0x35, 0x6b, 0xf2, 0x5e, 0xea, 0x41, 
-	0x01, 0x29, 0x01, 0x29, 0xa9, 0x39, 0x6f, 0x52, 0x22, 0x29, 0x4d, 0x4e, 0x02, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x24, 0x2d, 0xc9, 0x3d, 0x23, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 0x02, 0x29, 
-	0xc9, 0x3d, 0xd1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x13, 0x63, 0x35, 0x6b, 0x8f, 0x52, 
-	0x0b, 0x46, 0xf2, 0x62, 0xf2, 0x62, 0x01, 0x29, 0x43, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 
-	0x8f, 0x56, 0xb0, 0x5a, 0x2c, 0x46, 0x8f, 0x56, 0x8f, 0x56, 0x13, 0x63, 0x34, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x90, 0x56, 0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x45, 0x31, 0x22, 0x29, 
-	0x65, 0x31, 0x23, 0x2d, 0x23, 0x2d, 0x01, 0x29, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x2d, 0x23, 0x2d, 0xc8, 0x3d, 0xb0, 0x56, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 
-	0x13, 0x63, 0x8f, 0x56, 0x0c, 0x46, 0xb1, 0x5a, 0x2c, 0x4a, 0x2c, 0x4a, 0x4c, 0x29, 0x97, 0x2d, 
-	0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 
-	0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 
-	0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x39, 0x42, 0x75, 0x04, 0xb8, 0x35, 0x59, 0x46, 0x59, 0x46, 
-	0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 
-	0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 0x59, 0x46, 
-	0x59, 0x46, 0x18, 0x3e, 0x32, 0x25, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x67, 0xd1, 0x5a, 0xea, 0x45, 
-	0x01, 0x29, 0xa8, 0x39, 0x22, 0x29, 0xea, 0x41, 0x0b, 0x46, 0xd1, 0x5e, 0xf2, 0x5e, 0xf2, 0x62, 
-	0x90, 0x56, 0x2d, 0x4a, 0xf3, 0x62, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 
-	0x13, 0x67, 0x90, 0x56, 0x2c, 0x4a, 0xb0, 0x5a, 0x2c, 0x4a, 0x2c, 0x4a, 0x65, 0x31, 0x66, 0x35, 
-	0x4d, 0x4e, 0x2d, 0x4a, 0x86, 0x35, 0x4d, 0x4e, 0xd1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0xa8, 0x39, 0x6f, 0x52, 0x13, 0x63, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 0xc9, 0x3d, 0x65, 0x31, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x21, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x23, 0x2d, 0x6e, 0x52, 0x34, 0x67, 0x6f, 0x52, 0x00, 0x29, 0x4d, 0x4e, 0xc9, 0x3d, 0x0c, 0x46, 
-	0x65, 0x31, 0x13, 0x63, 0x34, 0x6b, 0x35, 0x6b, 0x90, 0x56, 0xc9, 0x41, 0x86, 0x35, 0x23, 0x2d, 
-	0x22, 0x29, 0x23, 0x2d, 0x01, 0x29, 0xc9, 0x3d, 0x34, 0x67, 0x35, 0x6b, 0x34, 0x67, 0x8f, 0x52, 
-	0x0b, 0x46, 0xa7, 0x39, 0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 0x4d, 0x4e, 
-	0xf2, 0x5e, 0x35, 0x67, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0xd1, 0x5a, 0xa8, 0x3d, 0x01, 0x29, 0xa7, 0x39, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xa7, 0x39, 0x01, 0x25, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x25, 0xb1, 0x5a, 0x34, 0x6b, 
-	0x35, 0x67, 0x13, 0x63, 0x0c, 0x46, 0xc9, 0x3d, 0x24, 0x2d, 0x2c, 0x4a, 0xc9, 0x3d, 0x87, 0x39, 
-	0x23, 0x2d, 0xea, 0x45, 0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x66, 0x31, 0x2c, 0x4a, 0xf2, 0x5e, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 
-	0x34, 0x67, 0x8f, 0x52, 0x0b, 0x42, 0xf2, 0x5e, 0x4d, 0x4e, 0x01, 0x25, 0x26, 0x29, 0xeb, 0x18, 
-	0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 
-	0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 
-	0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x29, 0x4a, 0x25, 0x4a, 0x25, 
-	0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 
-	0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 0x4a, 0x25, 
-	0x4a, 0x25, 0x0b, 0x1d, 0x72, 0x4e, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x6e, 0x52, 0x66, 0x35, 0x01, 0x29, 
-	0xa7, 0x39, 0x22, 0x29, 0x45, 0x31, 0x87, 0x35, 0xea, 0x41, 0xc9, 0x3d, 0x02, 0x29, 0x65, 0x35, 
-	0x22, 0x29, 0xa8, 0x3d, 0x2d, 0x4a, 0x34, 0x67, 0x34, 0x67, 0x35, 0x67, 0x35, 0x6b, 0xf2, 0x5e, 
-	0x34, 0x67, 0x8f, 0x52, 0xeb, 0x41, 0xf2, 0x5e, 0x4e, 0x4e, 0x01, 0x25, 0x44, 0x31, 0x01, 0x29, 
-	0x23, 0x29, 0x4d, 0x4e, 0xb0, 0x56, 0xea, 0x41, 0x8f, 0x52, 0xb0, 0x5a, 0xf2, 0x62, 0x34, 0x6b, 
-	0x0c, 0x46, 0x4c, 0x4e, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x6f, 0x52, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x5e, 0xb0, 0x5a, 0x6f, 0x52, 
-	0x4d, 0x4e, 0xc9, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0xea, 0x41, 0x0b, 0x46, 
-	0xea, 0x41, 0x8f, 0x52, 0x34, 0x67, 0xf2, 0x62, 0xc9, 0x3d, 0x01, 0x29, 0x45, 0x31, 0x44, 0x31, 
-	0xeb, 0x41, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x13, 0x63, 0xa7, 0x39, 0x01, 0x29, 0xc9, 0x3d, 
-	0x01, 0x29, 0x22, 0x29, 0xea, 0x41, 0x90, 0x56, 0x13, 0x67, 0x13, 0x63, 0x35, 0x6b, 0xb0, 0x56, 
-	0x86, 0x35, 0x01, 0x29, 0x66, 0x31, 0xea, 0x45, 0x01, 0x29, 0x01, 0x29, 0x86, 0x35, 0x0b, 0x42, 
-	0x6e, 0x52, 0xa8, 0x39, 0xea, 0x41, 0x2c, 0x4a, 0x2c, 0x4a, 0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xeb, 0x41, 0x34, 0x67, 0x34, 0x6b, 
-	0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 0x66, 0x31, 0xa7, 0x39, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x29, 0xca, 0x3d, 0xf2, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0xb0, 0x5a, 0xd1, 0x5e, 0x34, 0x67, 0x2c, 0x4a, 0x65, 0x31, 
-	0x01, 0x29, 0x22, 0x29, 0x6e, 0x52, 0xd1, 0x5e, 0xa8, 0x39, 0x45, 0x31, 0x0a, 0x46, 0x0b, 0x46, 
-	0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0xc9, 0x3d, 0x34, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x0b, 0x46, 0x22, 0x29, 
-	0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x67, 0x31, 0x27, 0x21, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0x47, 0x25, 0x91, 0x52, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4d, 0x4e, 0x44, 0x2d, 0x44, 0x2d, 0xea, 0x41, 
-	0x23, 0x2d, 0x86, 0x35, 0x87, 0x39, 0xc8, 0x3d, 0x44, 0x2d, 0x01, 0x29, 0x65, 0x35, 0x65, 0x31, 
-	0x4d, 0x4e, 0xb1, 0x5a, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x0c, 0x46, 0x22, 0x29, 
-	0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x65, 0x35, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x2c, 0x4a, 0x35, 0x6b, 
-	0x8f, 0x56, 0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x4d, 0x4e, 0x34, 0x6b, 0x35, 0x6b, 0x13, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 0xea, 0x41, 0xc9, 0x41, 0xeb, 0x41, 0x4d, 0x4e, 
-	0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 
-	0x01, 0x29, 0x66, 0x35, 0xa8, 0x39, 0x0b, 0x46, 0xb0, 0x5a, 0xd1, 0x5e, 0x45, 0x31, 0xea, 0x41, 
-	0x4c, 0x4a, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x2c, 0x4a, 0x87, 0x35, 0x86, 0x35, 0x65, 0x31, 
-	0xa8, 0x3d, 0x4d, 0x4e, 0xb0, 0x5a, 0xea, 0x41, 0x2d, 0x4a, 0x23, 0x29, 0x2c, 0x4a, 0x6e, 0x52, 
-	0xc9, 0x3d, 0x01, 0x29, 0xa8, 0x3d, 0x23, 0x29, 0xea, 0x41, 0x0b, 0x42, 0xb0, 0x5a, 0x13, 0x67, 
-	0x6f, 0x52, 0xf2, 0x62, 0x0b, 0x46, 0x2c, 0x4a, 0xc9, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xc9, 0x3d, 0x34, 0x6b, 0x35, 0x6b, 0x14, 0x67, 
-	0x34, 0x6b, 0x35, 0x67, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x12, 0x63, 0x8f, 0x56, 0xf2, 0x62, 
-	0xeb, 0x41, 0x4d, 0x4e, 0x2b, 0x4a, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x87, 0x35, 0x2c, 0x4e, 0x2c, 0x4a, 0xea, 0x41, 0x0b, 0x46, 0x8f, 0x52, 0x35, 0x6b, 0xd1, 0x5a, 
-	0x0b, 0x46, 0xeb, 0x41, 0x0b, 0x46, 0x01, 0x29, 0x44, 0x2d, 0xea, 0x41, 0x22, 0x29, 0xa7, 0x39, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x45, 0x2d, 0x44, 0x2d, 0x23, 0x2d, 0x01, 0x29, 0x87, 0x39, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xa8, 0x3d, 
-	0x13, 0x67, 0x35, 0x6b, 0x14, 0x67, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x4d, 0x4a, 
-	0xc9, 0x3d, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x04, 0x21, 0x27, 0x21, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0x47, 0x25, 0xec, 0x3d, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x6f, 0x52, 0x34, 0x67, 
-	0x6e, 0x52, 0xc9, 0x41, 0x01, 0x29, 0x02, 0x29, 0x4d, 0x4e, 0xd1, 0x5e, 0x4d, 0x4e, 0x90, 0x56, 
-	0x34, 0x67, 0x34, 0x67, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 0x4d, 0x4e, 
-	0xc9, 0x3d, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xc9, 0x3d, 0x8f, 0x56, 0x34, 0x67, 0x34, 0x6b, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x02, 0x29, 0x86, 0x35, 0xc9, 0x3d, 0x45, 0x31, 0x2c, 0x4a, 0x13, 0x67, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 0xc9, 0x3d, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x86, 0x35, 0x01, 0x29, 0x23, 0x2d, 0x13, 0x67, 0x13, 0x63, 0x44, 0x2d, 0x22, 0x29, 
-	0x0b, 0x46, 0xd2, 0x5e, 0xc9, 0x3d, 0x23, 0x2d, 0x01, 0x29, 0x65, 0x31, 0x23, 0x29, 0x86, 0x35, 
-	0x65, 0x31, 0x22, 0x29, 0x01, 0x29, 0x44, 0x31, 0x45, 0x31, 0xe9, 0x41, 0x0b, 0x4a, 0x23, 0x2d, 
-	0x01, 0x29, 0xa8, 0x39, 0x22, 0x29, 0x44, 0x31, 0x44, 0x2d, 0xca, 0x3d, 0x88, 0x35, 0x23, 0x2d, 
-	0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0xea, 0x41, 0x23, 0x29, 
-	0x2c, 0x4a, 0xd1, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x8f, 0x56, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0x8f, 0x56, 0x2d, 0x4a, 0x0b, 0x46, 0x4e, 0x4e, 0xf2, 0x5e, 
-	0x8f, 0x56, 0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x29, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x2d, 0x4a, 0xa9, 0x39, 0x6e, 0x52, 
-	0xc9, 0x3d, 0x22, 0x29, 0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x44, 0x2d, 0xea, 0x41, 0x24, 0x2d, 0x0b, 0x46, 0xb0, 0x5a, 0x35, 0x6b, 0x34, 0x67, 0x13, 0x63, 
-	0xd1, 0x5a, 0x13, 0x67, 0x6f, 0x52, 0x8e, 0x52, 0xa8, 0x39, 0x01, 0x29, 0x04, 0x21, 0x27, 0x21, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0x47, 0x25, 0x90, 0x52, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0xb0, 0x56, 0x0b, 0x42, 0x8f, 0x56, 0x44, 0x2d, 0x23, 0x2d, 0x2c, 0x46, 
-	0xa8, 0x39, 0x01, 0x29, 0x87, 0x39, 0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 0xa8, 0x39, 0x44, 0x2d, 
-	0x45, 0x31, 0xea, 0x41, 0x8f, 0x56, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x13, 0x63, 
-	0xd1, 0x5a, 0x13, 0x67, 0x6f, 0x52, 0x6e, 0x52, 0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x86, 0x35, 0x2c, 0x4a, 0x6d, 0x4e, 0x87, 0x35, 0x66, 0x35, 0x13, 0x67, 0x14, 0x67, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0xb0, 0x56, 0x34, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x14, 0x67, 0x0b, 0x42, 0x4d, 0x4e, 
-	0x4d, 0x4e, 0xc9, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x6e, 0x52, 0x8f, 0x56, 0x23, 0x2d, 0x01, 0x29, 0xc9, 0x3d, 0xb0, 0x5a, 0x22, 0x29, 0x4c, 0x4e, 
-	0x02, 0x29, 0x01, 0x29, 0xa8, 0x39, 0xf2, 0x62, 0x6e, 0x52, 0x13, 0x63, 0x2c, 0x4e, 0x65, 0x31, 
-	0x02, 0x29, 0x2c, 0x4a, 0x8f, 0x56, 0x4d, 0x4e, 0x6e, 0x52, 0x65, 0x31, 0x23, 0x2d, 0x01, 0x29, 
-	0xc9, 0x3d, 0x22, 0x29, 0x45, 0x31, 0xa7, 0x39, 0xa8, 0x3d, 0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x2c, 0x4a, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x8f, 0x56, 0xea, 0x41, 0xb0, 0x5a, 
-	0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x6f, 0x52, 0x66, 0x35, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0x6e, 0x4e, 
-	0x14, 0x67, 0x8f, 0x56, 0x4d, 0x4e, 0xea, 0x41, 0x87, 0x35, 0x0b, 0x46, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x0b, 0x46, 0x34, 0x6b, 0x90, 0x56, 0xa8, 0x3d, 0xea, 0x41, 
-	0xa8, 0x39, 0x6f, 0x52, 0xeb, 0x45, 0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x04, 0x21, 0x27, 0x21, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0x47, 0x25, 0x4f, 0x4a, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0xb0, 0x5a, 0x65, 0x31, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x22, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0xa8, 0x39, 0xf2, 0x5e, 0x34, 0x67, 0x35, 0x6b, 0xb0, 0x56, 0xc9, 0x3d, 0xea, 0x41, 
-	0xa8, 0x39, 0x6f, 0x52, 0x0b, 0x46, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0xc9, 0x3d, 0x0b, 0x46, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xea, 0x41, 0xf2, 0x62, 0xf3, 0x62, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 0x13, 0x67, 0xf2, 0x5e, 0x8f, 0x56, 0x8f, 0x56, 0x6f, 0x52, 
-	0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xa8, 0x3d, 
-	0xd1, 0x5e, 0x8f, 0x52, 0x87, 0x39, 0x66, 0x35, 0x87, 0x39, 0x22, 0x29, 0x02, 0x29, 0x22, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0xeb, 0x45, 0xc9, 0x3d, 0x23, 0x29, 0xea, 0x41, 0x44, 0x31, 0x65, 0x31, 
-	0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 0x45, 0x31, 0x65, 0x31, 0x86, 0x35, 0x0b, 0x46, 0x6e, 0x52, 
-	0x13, 0x63, 0x6d, 0x52, 0x0b, 0x46, 0x22, 0x29, 0x01, 0x29, 0x2c, 0x4a, 0x2c, 0x4a, 0x00, 0x25, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x87, 0x39, 0xb0, 0x5a, 
-	0xf2, 0x62, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0xb0, 0x5a, 0xb0, 0x5a, 0xa8, 0x39, 0x4d, 0x4e, 
-	0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0xea, 0x41, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xc9, 0x3d, 0x6f, 0x52, 0xf2, 0x62, 0xf2, 0x5e, 
-	0xf2, 0x5e, 0x2c, 0x4a, 0x13, 0x67, 0x13, 0x63, 0x8f, 0x56, 0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x87, 0x35, 0xb0, 0x5a, 0xf2, 0x62, 0x34, 0x6b, 0x34, 0x6b, 0x4d, 0x4e, 0xa8, 0x39, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x04, 0x21, 0x27, 0x21, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0x47, 0x25, 0xe5, 0x20, 0xea, 0x41, 0xf2, 0x62, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x67, 0x34, 0x6b, 0xd1, 0x5e, 0x2c, 0x4a, 0x4d, 0x4e, 0x66, 0x35, 0xc9, 0x3d, 
-	0x66, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x45, 0x2d, 0xa8, 0x39, 
-	0x2c, 0x4a, 0x90, 0x56, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x67, 0x34, 0x6b, 0x4e, 0x4e, 0xa8, 0x3d, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 0x8f, 0x56, 
-	0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 0x45, 0x31, 0x22, 0x29, 0x8f, 0x56, 0x34, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0xf3, 0x62, 0x65, 0x31, 0x01, 0x29, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x01, 0x29, 0x44, 0x2d, 0xea, 0x45, 0x01, 0x29, 0x01, 0x29, 
-	0xa7, 0x39, 0x2c, 0x4a, 0x66, 0x31, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x43, 0x2d, 0x23, 0x2d, 0xea, 0x3d, 
-	0xb0, 0x56, 0xea, 0x41, 0x01, 0x29, 0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0x2b, 0x4a, 
-	0x66, 0x35, 0x43, 0x2d, 0x22, 0x29, 0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x65, 0x31, 
-	0x02, 0x29, 0x2c, 0x4a, 0x34, 0x67, 0x34, 0x67, 0x4e, 0x4e, 0x45, 0x31, 0xc8, 0x3d, 0xea, 0x41, 
-	0x2c, 0x4a, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x34, 0x6b, 0x6e, 0x4e, 0x90, 0x56, 
-	0xd1, 0x5e, 0x8f, 0x56, 0x2c, 0x4a, 0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xc9, 0x3d, 0x34, 0x67, 0x35, 0x67, 0x13, 0x63, 0xea, 0x41, 
-	0x22, 0x29, 0x02, 0x29, 0x23, 0x2d, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x45, 0x31, 0x02, 0x29, 0x0b, 0x46, 0x14, 0x67, 0x35, 0x67, 0xd1, 0x5e, 
-	0x66, 0x31, 0x23, 0x2d, 0x86, 0x35, 0x45, 0x2d, 0x86, 0x35, 0x01, 0x29, 0x04, 0x21, 0x27, 0x21, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 
-	0xc5, 0x35, 0x47, 0x25, 0x0d, 0x46, 0x13, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x34, 0x6b, 0x14, 0x67, 0xb1, 0x5a, 0x8f, 0x56, 0xd1, 0x5e, 0x34, 0x67, 0xd1, 0x5a, 0x0b, 0x46, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x86, 0x35, 0x0b, 0x46, 0x0b, 0x46, 
-	0x01, 0x29, 0xc9, 0x3d, 0xaf, 0x56, 0xf2, 0x62, 0x13, 0x63, 0x35, 0x6b, 0x35, 0x6b, 0xd1, 0x5e, 
-	0x66, 0x35, 0x23, 0x2d, 0x66, 0x31, 0x45, 0x2d, 0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0xd1, 0x5e, 0x34, 0x67, 0x35, 0x6b, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x44, 0x31, 0x43, 0x2d, 0x0b, 0x4a, 0x45, 0x2d, 0x87, 0x35, 0xd2, 0x5e, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0xd1, 0x5a, 0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x2d, 0x65, 0x31, 0x65, 0x31, 0xa7, 0x39, 0x24, 0x2d, 0xeb, 0x45, 0x4d, 0x4e, 
-	0xf2, 0x62, 0xd1, 0x5e, 0x2c, 0x4a, 0x2c, 0x4a, 0x23, 0x2d, 0xe9, 0x41, 0x22, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x44, 0x31, 0x44, 0x31, 0x01, 0x29, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x43, 0x2d, 0x44, 0x31, 0xe9, 0x41, 0xa8, 0x39, 0x45, 0x2d, 
-	0xb0, 0x56, 0x34, 0x67, 0x34, 0x67, 0xb0, 0x5a, 0x8f, 0x56, 0x0b, 0x42, 0x66, 0x31, 0xa7, 0x39, 
-	0x6e, 0x52, 0x35, 0x6b, 0x34, 0x6b, 0xd2, 0x5e, 0x34, 0x6b, 0x4d, 0x4e, 0x8f, 0x56, 0xb0, 0x56, 
-	0x4d, 0x4a, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0xb0, 0x5a, 0x13, 0x63, 0x13, 0x67, 0xb0, 0x56, 0x13, 0x67, 
-	0xb0, 0x5a, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 0x64, 0x31, 
-	0xc9, 0x3d, 0xc9, 0x3d, 0x44, 0x2d, 0x8f, 0x56, 0x14, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x63, 
-	0x14, 0x63, 0x14, 0x63, 0x14, 0x63, 0x6f, 0x52, 0x46, 0x31, 0x02, 0x25, 0xe5, 0x20, 0x08, 0x21, 
-	0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x31, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x31, 0xa6, 0x35, 
-	0xa6, 0x35, 0xa6, 0x31, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x31, 
-	0xa6, 0x31, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x31, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 
-	0xa6, 0x31, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x31, 0xa6, 0x31, 
-	0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x35, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x35, 
-	0xa6, 0x31, 0x47, 0x25, 0x72, 0x52, 0x36, 0x67, 0x35, 0x67, 0x36, 0x67, 0x35, 0x67, 0x35, 0x67, 
-	0x35, 0x67, 0x91, 0x56, 0x24, 0x29, 0x23, 0x2d, 0x01, 0x29, 0x45, 0x2d, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xc9, 0x3d, 0xf2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x14, 0x67, 
-	0x13, 0x67, 0x13, 0x67, 0x13, 0x67, 0x8e, 0x52, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 0xd2, 0x5e, 0x35, 0x6b, 0x35, 0x6b, 0x34, 0x67, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x2d, 0x2c, 0x46, 0x13, 0x67, 0x34, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x35, 0x6b, 0x35, 0x67, 0x34, 0x67, 0xb1, 0x5a, 0xb0, 0x56, 0x6e, 0x52, 0x2c, 0x4e, 
-	0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x2d, 0x01, 0x29, 0x45, 0x31, 0x01, 0x29, 0x65, 0x31, 0x23, 0x2d, 0x65, 0x31, 
-	0x45, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x22, 0x29, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 0x87, 0x35, 0x13, 0x67, 0x13, 0x67, 
-	0x35, 0x6b, 0x35, 0x6b, 0xf2, 0x62, 0x23, 0x2d, 0xca, 0x3d, 0x34, 0x6b, 0xea, 0x41, 0x66, 0x31, 
-	0x6e, 0x52, 0x8f, 0x52, 0x87, 0x35, 0x22, 0x29, 0x44, 0x2d, 0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x22, 0x29, 0x87, 0x35, 
-	0xd1, 0x5e, 0xd1, 0x5a, 0xa9, 0x39, 0x2d, 0x4a, 0x4d, 0x4e, 0x4d, 0x52, 0x22, 0x2d, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 
-	0x45, 0x31, 0x13, 0x67, 0x13, 0x67, 0x35, 0x6b, 0x13, 0x67, 0x8f, 0x52, 0x93, 0x31, 0xf4, 0x18, 
-	0x14, 0x1d, 0x15, 0x21, 0xd3, 0x14, 0x93, 0x08, 0x92, 0x0c, 0x93, 0x0c, 0x93, 0x08, 0x93, 0x08, 
-	0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x10, 
-	0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x0c, 
-	0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x0c, 0xb3, 0x0c, 
-	0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x10, 0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x0c, 0xb3, 0x0c, 
-	0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x10, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 0xb3, 0x0c, 
-	0xb3, 0x0c, 0x93, 0x08, 0xf4, 0x18, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 
-	0x15, 0x21, 0x15, 0x21, 0x32, 0x25, 0xcb, 0x3d, 0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0xea, 0x41, 0x90, 0x56, 0x34, 0x67, 0x13, 0x67, 0x8f, 0x52, 0x6e, 0x52, 0x4d, 0x4e, 
-	0x87, 0x35, 0xca, 0x3d, 0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x0c, 0x46, 0x8f, 0x56, 0x0b, 0x42, 0x90, 0x56, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x87, 0x35, 0x4d, 0x4e, 0x8f, 0x52, 0xf3, 0x62, 0x34, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0xd1, 0x5e, 0x6e, 0x52, 0x87, 0x35, 0x2d, 0x4a, 0x2c, 0x4a, 0x66, 0x31, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x64, 0x31, 
-	0x44, 0x2d, 0x66, 0x35, 0x0b, 0x46, 0x87, 0x35, 0xe9, 0x41, 0x87, 0x39, 0x87, 0x39, 0xca, 0x41, 
-	0x45, 0x2d, 0x22, 0x29, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x87, 0x35, 0x0b, 0x46, 0xb0, 0x56, 
-	0x8e, 0x52, 0x44, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x45, 0x2d, 0x2c, 0x4a, 
-	0x6f, 0x52, 0xd2, 0x5e, 0xd1, 0x5e, 0x45, 0x31, 0x02, 0x29, 0x4d, 0x4e, 0x87, 0x39, 0xe9, 0x41, 
-	0x01, 0x29, 0x45, 0x31, 0xeb, 0x41, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x23, 0x2d, 0xb0, 0x5a, 
-	0x34, 0x67, 0x8f, 0x56, 0x13, 0x67, 0xf2, 0x5e, 0x4d, 0x4e, 0x44, 0x2d, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x44, 0x2d, 0x2c, 0x4a, 0x6e, 0x52, 0xa7, 0x39, 0x22, 0x29, 0xce, 0x18, 0xb1, 0x10, 
-	0x92, 0x0c, 0x93, 0x08, 0xb1, 0x10, 0xb1, 0x10, 0xb0, 0x10, 0x74, 0x08, 0x91, 0x0c, 0xb1, 0x0c, 
-	0xf1, 0x18, 0xd2, 0x10, 0x94, 0x08, 0xf1, 0x18, 0xf1, 0x18, 0xf1, 0x18, 0x94, 0x0c, 0xd2, 0x14, 
-	0xf1, 0x14, 0xf1, 0x14, 0xd2, 0x14, 0x94, 0x08, 0xf1, 0x18, 0xf1, 0x14, 0xf1, 0x18, 0xb3, 0x10, 
-	0xb3, 0x10, 0xf1, 0x18, 0xf1, 0x18, 0xf1, 0x18, 0x94, 0x04, 0xf1, 0x14, 0xf1, 0x18, 0xf1, 0x14, 
-	0xd2, 0x10, 0xb3, 0x0c, 0xf1, 0x18, 0xf1, 0x18, 0xf1, 0x18, 0x94, 0x08, 0xd2, 0x14, 0xf1, 0x18, 
-	0xf1, 0x18, 0xd2, 0x14, 0x94, 0x08, 0xf1, 0x14, 0xf1, 0x18, 0xf1, 0x18, 0xb3, 0x0c, 0xd2, 0x10, 
-	0xf1, 0x18, 0xb1, 0x10, 0x91, 0x0c, 0x94, 0x08, 0xb5, 0x31, 0xb5, 0x31, 0xb5, 0x35, 0x75, 0x29, 
-	0x35, 0x21, 0xb5, 0x35, 0x15, 0x42, 0x34, 0x67, 0x0c, 0x46, 0x4d, 0x4a, 0x8f, 0x52, 0x6e, 0x52, 
-	0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x4d, 0x4e, 0x34, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 0x6e, 0x4e, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x35, 0x4d, 0x4a, 
-	0x34, 0x67, 0x13, 0x63, 0x66, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0xa8, 0x39, 0x4d, 0x4e, 0x34, 0x67, 0xb0, 0x5a, 0xa8, 0x39, 0x02, 0x29, 0x01, 0x29, 0xa8, 0x39, 
-	0xd1, 0x5e, 0xb0, 0x5a, 0xc9, 0x3d, 0x2b, 0x4a, 0x4d, 0x4e, 0x4d, 0x4e, 0x23, 0x2d, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x4d, 0x4e, 0x90, 0x56, 0xca, 0x3d, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x2d, 0x0b, 0x46, 0x0a, 0x46, 0x66, 0x35, 0xc8, 0x3d, 0x22, 0x29, 0x01, 0x29, 
-	0x02, 0x29, 0xa8, 0x39, 0x13, 0x63, 0x87, 0x35, 0x44, 0x2d, 0x22, 0x29, 0x22, 0x29, 0x01, 0x29, 
-	0x02, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0xe9, 0x41, 0xea, 0x41, 0x44, 0x2d, 
-	0xeb, 0x41, 0x23, 0x2d, 0x00, 0x25, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x29, 0x45, 0x31, 0x01, 0x29, 0x01, 0x29, 
-	0xcc, 0x1c, 0xcd, 0x18, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x90, 0x0c, 0xe7, 0x1c, 0x27, 0x21, 
-	0xa5, 0x35, 0x8a, 0x2d, 0x11, 0x1d, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x11, 0x19, 0x8a, 0x2d, 
-	0xc5, 0x35, 0xc5, 0x35, 0x88, 0x31, 0xd0, 0x14, 0xa6, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x4e, 0x21, 
-	0x4d, 0x25, 0xc5, 0x35, 0xc5, 0x35, 0xa5, 0x35, 0xb2, 0x10, 0xa6, 0x31, 0xc5, 0x35, 0xc5, 0x35, 
-	0x6b, 0x29, 0x0f, 0x1d, 0xc5, 0x35, 0xc5, 0x35, 0xa5, 0x35, 0xf0, 0x18, 0x89, 0x2d, 0xc5, 0x35, 
-	0xc5, 0x35, 0xa8, 0x31, 0xf1, 0x14, 0xa5, 0x35, 0xc5, 0x35, 0xa5, 0x35, 0x2e, 0x21, 0x6c, 0x25, 
-	0xa5, 0x35, 0x47, 0x25, 0x0f, 0x42, 0xf3, 0x18, 0x35, 0x67, 0x35, 0x6b, 0x35, 0x6b, 0x95, 0x52, 
-	0x35, 0x46, 0x13, 0x63, 0x34, 0x67, 0xb0, 0x56, 0xd1, 0x5a, 0xd2, 0x5e, 0x6e, 0x4e, 0x66, 0x31, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xea, 0x41, 
-	0x13, 0x67, 0x34, 0x6b, 0xf2, 0x5e, 0x34, 0x67, 0x34, 0x6b, 0x4e, 0x4e, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x29, 0x0b, 0x46, 0xf3, 0x62, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x45, 0x31, 0x86, 0x35, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0xa8, 0x39, 0x34, 0x67, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x4d, 0x4a, 0x65, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0x45, 0x31, 0x01, 0x29, 0x86, 0x35, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x44, 0x2d, 0x01, 0x29, 0x22, 0x29, 0x65, 0x31, 0x22, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x23, 0x2d, 0x87, 0x39, 0x23, 0x29, 0x22, 0x29, 0x01, 0x29, 
-	0x02, 0x29, 0x65, 0x31, 0xd1, 0x5e, 0x0b, 0x46, 0x02, 0x29, 0x44, 0x2d, 0x45, 0x31, 0xa8, 0x39, 
-	0xb0, 0x5a, 0xd1, 0x5e, 0x13, 0x67, 0x6e, 0x52, 0x33, 0x67, 0xf2, 0x5e, 0xf2, 0x5e, 0xb0, 0x5a, 
-	0x0b, 0x46, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0xa7, 0x39, 
-	0x22, 0x29, 0x22, 0x29, 0x01, 0x29, 0x02, 0x29, 0x44, 0x2d, 0xb0, 0x5a, 0x8f, 0x52, 0x4d, 0x4e, 
-	0xd0, 0x39, 0x4f, 0x29, 0xa8, 0x39, 0x01, 0x29, 0x02, 0x29, 0xb0, 0x10, 0xe7, 0x1c, 0x27, 0x21, 
-	0xc5, 0x35, 0x8a, 0x2d, 0x11, 0x1d, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x10, 0x1d, 0x89, 0x2d, 
-	0xc5, 0x35, 0xc5, 0x35, 0xa8, 0x31, 0xd0, 0x14, 0xa5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x4e, 0x21, 
-	0x4d, 0x25, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xb2, 0x10, 0xa6, 0x31, 0xc5, 0x35, 0xc5, 0x35, 
-	0x6b, 0x29, 0x0f, 0x1d, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xf0, 0x18, 0x89, 0x2d, 0xc5, 0x35, 
-	0xc5, 0x35, 0xa8, 0x31, 0xf1, 0x14, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x2e, 0x21, 0x6c, 0x25, 
-	0xc5, 0x35, 0x47, 0x25, 0xe6, 0x1c, 0x91, 0x0c, 0x90, 0x56, 0x35, 0x6b, 0x34, 0x6b, 0x95, 0x52, 
-	0x71, 0x2d, 0x86, 0x35, 0x65, 0x31, 0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x66, 0x31, 0x01, 0x29, 0xc9, 0x3d, 0xd1, 0x5e, 0x13, 0x63, 0x8f, 0x56, 0x4e, 0x4e, 
-	0x0b, 0x46, 0xc9, 0x3d, 0xa8, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x35, 0x2d, 0x4a, 0xa8, 0x39, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x44, 0x2d, 0x0b, 0x46, 0xb0, 0x5a, 0x6e, 0x52, 0xb0, 0x56, 0x13, 0x63, 0x34, 0x67, 0x35, 0x6b, 
-	0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x34, 0x67, 0x6f, 0x52, 0x2c, 0x4a, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x0b, 0x46, 0x6e, 0x52, 0x8f, 0x56, 0x90, 0x56, 
-	0xd2, 0x5e, 0xb0, 0x5a, 0xea, 0x41, 0x01, 0x29, 0x65, 0x35, 0x65, 0x31, 0x44, 0x2d, 0xea, 0x41, 
-	0xc9, 0x3d, 0x23, 0x2d, 0x43, 0x2d, 0x01, 0x29, 0x02, 0x29, 0x4d, 0x4e, 0x2c, 0x4a, 0xa8, 0x39, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x22, 0x29, 0x86, 0x35, 0x65, 0x35, 0x4d, 0x4e, 0x44, 0x2d, 0xa8, 0x3d, 0x23, 0x2d, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x0b, 0x46, 
-	0x4d, 0x4e, 0xaf, 0x5a, 0x8f, 0x56, 0xd1, 0x5e, 0x13, 0x63, 0xf2, 0x5e, 0x2c, 0x4a, 0xf2, 0x5e, 
-	0x54, 0x4a, 0xb1, 0x35, 0x65, 0x31, 0x01, 0x29, 0x02, 0x29, 0x90, 0x10, 0xe7, 0x1c, 0x27, 0x21, 
-	0xc5, 0x35, 0x8a, 0x2d, 0x11, 0x1d, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x11, 0x1d, 0x89, 0x2d, 
-	0xc5, 0x35, 0xc5, 0x35, 0xa8, 0x31, 0xd0, 0x14, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x4e, 0x25, 
-	0x4d, 0x29, 0xc5, 0x35, 0xc5, 0x35, 0xa5, 0x35, 0xb2, 0x10, 0xa6, 0x31, 0xc5, 0x35, 0xc5, 0x35, 
-	0x6b, 0x29, 0x0f, 0x1d, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0xf0, 0x18, 0x89, 0x2d, 0xc5, 0x35, 
-	0xc5, 0x35, 0x88, 0x31, 0xf1, 0x18, 0xc5, 0x35, 0xc5, 0x35, 0xc5, 0x35, 0x2e, 0x21, 0x6c, 0x29, 
-	0xc5, 0x35, 0x47, 0x25, 0xac, 0x35, 0xf3, 0x18, 0x36, 0x67, 0x34, 0x6b, 0x34, 0x67, 0x95, 0x56, 
-	0xd3, 0x3d, 0x45, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x6e, 0x52, 0x34, 0x67, 0xf2, 0x5e, 0x2c, 0x4a, 0xf2, 0x62, 
-	0xf2, 0x62, 0x90, 0x56, 0x66, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x22, 0x2d, 0x02, 0x29, 0xc8, 0x3d, 0x45, 0x31, 0x01, 0x29, 0xeb, 0x41, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x8f, 0x56, 0x34, 0x6b, 0x35, 0x6b, 0x34, 0x6b, 0x35, 0x6b, 
-	0x35, 0x6b, 0x34, 0x6b, 0x2c, 0x4a, 0x87, 0x35, 0x66, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x86, 0x35, 
-	0x0b, 0x4a, 0x87, 0x35, 0x0b, 0x46, 0xc8, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x22, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x44, 0x2d, 0x4d, 0x4e, 0x8f, 0x56, 
-	0xaf, 0x56, 0x66, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x4d, 0x4e, 0x34, 0x67, 
-	0x34, 0x6b, 0x8f, 0x52, 0x0b, 0x46, 0x2c, 0x4a, 0x0b, 0x46, 0xc8, 0x3d, 0x44, 0x31, 0xea, 0x45, 
-	0xa8, 0x39, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x6e, 0x52, 0x34, 0x67, 0x34, 0x67, 0xf2, 0x5e, 
-	0xf3, 0x62, 0x90, 0x56, 0x6e, 0x4e, 0x6e, 0x52, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x22, 0x29, 0x4d, 0x4e, 0x34, 0x67, 0x4e, 0x4e, 0x0e, 0x21, 0x30, 0x29, 0xce, 0x18, 0xae, 0x14, 
-	0x91, 0x0c, 0x91, 0x10, 0xce, 0x18, 0xce, 0x18, 0xce, 0x18, 0x93, 0x08, 0xaf, 0x10, 0xcf, 0x10, 
-	0x2f, 0x21, 0x10, 0x1d, 0xb3, 0x10, 0x2f, 0x21, 0x2f, 0x21, 0x2f, 0x21, 0xb3, 0x10, 0x10, 0x1d, 
-	0x2f, 0x21, 0x2f, 0x21, 0x2f, 0x1d, 0xb3, 0x0c, 0x2f, 0x21, 0x2f, 0x21, 0x2f, 0x21, 0xf2, 0x14, 
-	0xf1, 0x18, 0x2f, 0x21, 0x2f, 0x21, 0x2f, 0x21, 0x94, 0x08, 0x2f, 0x21, 0x2f, 0x21, 0x2e, 0x21, 
-	0x11, 0x19, 0xd2, 0x10, 0x2e, 0x21, 0x2e, 0x21, 0x2f, 0x21, 0xb3, 0x10, 0x10, 0x21, 0x4e, 0x21, 
-	0x4e, 0x25, 0x2f, 0x21, 0xb3, 0x0c, 0x2e, 0x25, 0x4e, 0x25, 0x4e, 0x21, 0xd2, 0x14, 0x10, 0x19, 
-	0x2f, 0x25, 0xef, 0x18, 0xb4, 0x35, 0xb5, 0x10, 0x36, 0x46, 0x55, 0x46, 0x35, 0x4a, 0xd5, 0x39, 
-	0x95, 0x31, 0xb2, 0x31, 0xce, 0x18, 0xce, 0x18, 0xce, 0x18, 0x05, 0x25, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0xa7, 0x39, 0xd1, 0x5e, 0x4d, 0x4e, 0x45, 0x31, 0x66, 0x35, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x02, 0x29, 0x65, 0x35, 0x44, 0x2d, 0xf2, 0x62, 0x90, 0x56, 0x34, 0x6b, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x22, 0x29, 0x86, 0x35, 0xc9, 0x3d, 0xea, 0x41, 0x0c, 0x46, 
-	0x4e, 0x4e, 0xb1, 0x5a, 0xd0, 0x5a, 0xc8, 0x3d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x44, 0x2d, 0x0b, 0x4a, 0xca, 0x41, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x23, 0x2d, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x35, 0x22, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x66, 0x31, 
-	0xa8, 0x3d, 0xea, 0x41, 0xca, 0x3d, 0x4d, 0x4a, 0xc9, 0x3d, 0x44, 0x2d, 0x01, 0x29, 0x23, 0x2d, 
-	0x4d, 0x4e, 0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x87, 0x35, 0x2c, 0x4a, 0xa8, 0x39, 
-	0x4d, 0x4e, 0xb0, 0x56, 0x6e, 0x4e, 0x87, 0x35, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x65, 0x31, 0x26, 0x29, 0x93, 0x08, 0x74, 0x04, 0x74, 0x08, 0x74, 0x04, 
-	0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x75, 0x04, 0x75, 0x04, 
-	0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x74, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 
-	0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 
-	0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 
-	0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x04, 0x75, 0x00, 0x75, 0x04, 
-	0x75, 0x00, 0x75, 0x00, 0x75, 0x00, 0x75, 0x04, 0x75, 0x00, 0x75, 0x00, 0x75, 0x04, 0x75, 0x00, 
-	0x75, 0x04, 0x75, 0x00, 0x75, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 
-	0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x74, 0x04, 0x94, 0x08, 0x72, 0x4e, 0xa8, 0x39, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x00, 0x25, 0x01, 0x29, 0x66, 0x31, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 
-	0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0xea, 0x41, 0xb0, 0x5a, 0xf2, 0x62
-	
-};
-const int main_screen_size = sizeof(main_screen);
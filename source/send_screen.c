@@ -1,4809 +0,0 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
-
-const unsigned char send_screen[] = {
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0x9c, 0x73, 
-	0x0f, 0x3e, 0x94, 0x4e, 0xbd, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xf8, 0x5a, 0xf0, 0x39, 0x10, 0x3e, 0x32, 0x42, 0x94, 0x4a, 0x53, 0x46, 
-	0x53, 0x42, 0xf8, 0x5a, 0x9d, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0x18, 0x5f, 0xad, 0x31, 
-	0x53, 0x4a, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0x9b, 0x6f, 0x38, 0x63, 0xef, 0x35, 0xae, 0x31, 0x52, 0x46, 0x39, 0x5f, 0xde, 0x77, 
-	0xde, 0x73, 0x7c, 0x67, 0x5d, 0x5f, 0x7e, 0x63, 0x7f, 0x67, 0x3d, 0x5f, 0x5d, 0x63, 0x90, 0x29, 
-	0x58, 0x3e, 0x1f, 0x53, 0x1f, 0x53, 0xdf, 0x4e, 0x5f, 0x46, 0xff, 0x39, 0x9f, 0x35, 0xde, 0x20, 
-	0x55, 0x10, 0x5f, 0x6b, 0xde, 0x77, 0xde, 0x77, 0xbf, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x18, 0x5f, 
-	0x17, 0x5b, 0xcc, 0x2d, 0xcb, 0x2d, 0x8a, 0x25, 0x73, 0x4a, 0xf6, 0x56, 0x7b, 0x67, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7c, 0x6b, 0x5b, 0x67, 
-	0xcf, 0x35, 0xb5, 0x52, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x3a, 0x5f, 0x7e, 0x67, 0x5d, 0x5f, 
-	0x7e, 0x67, 0x7d, 0x67, 0x7d, 0x67, 0x7d, 0x63, 0x3c, 0x5b, 0x7e, 0x5f, 0x1d, 0x53, 0x3f, 0x57, 
-	0x1f, 0x53, 0xff, 0x4e, 0x9f, 0x42, 0xff, 0x31, 0xbf, 0x2d, 0xff, 0x35, 0x9d, 0x29, 0x18, 0x42, 
-	0x9d, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0x10, 0x3e, 0x10, 0x3e, 0x5a, 0x67, 
-	0xbd, 0x73, 0x39, 0x5f, 0xb6, 0x52, 0xae, 0x2d, 0xef, 0x35, 0xef, 0x35, 0x6b, 0x29, 0x8c, 0x29, 
-	0xb5, 0x4e, 0x39, 0x63, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0x32, 0x42, 0xd6, 0x56, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0x7c, 0x6b, 0x31, 0x3e, 0x52, 0x46, 
-	0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbd, 0x77, 0x9c, 0x6f, 
-	0xce, 0x39, 0xef, 0x3d, 0xde, 0x7b, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7b, 0x6b, 
-	0x53, 0x46, 0x11, 0x3e, 0x8d, 0x2d, 0x11, 0x3e, 0x32, 0x42, 0x74, 0x4a, 0x19, 0x5f, 0x7c, 0x6b, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x39, 0x63, 0xce, 0x35, 
-	0xb6, 0x56, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbd, 0x73, 0xdd, 0x77, 
-	0x52, 0x46, 0xf0, 0x39, 0x0f, 0x3a, 0xb3, 0x4e, 0x72, 0x4a, 0xcd, 0x35, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xd8, 0x52, 0x9e, 0x67, 0x7e, 0x67, 0x7e, 0x67, 0x5e, 0x63, 0x5e, 0x63, 0x97, 0x4a, 
-	0x58, 0x3e, 0x3f, 0x57, 0xfe, 0x4e, 0x9f, 0x4a, 0x5f, 0x46, 0xdf, 0x39, 0x5f, 0x2d, 0x3d, 0x29, 
-	0x54, 0x25, 0x7e, 0x6f, 0x1b, 0x63, 0xd9, 0x5a, 0x1b, 0x63, 0xdf, 0x77, 0xbd, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xd7, 0x56, 
-	0x9b, 0x6b, 0xab, 0x2d, 0xcb, 0x31, 0xec, 0x31, 0x89, 0x25, 0x0f, 0x3a, 0x93, 0x4a, 0xb5, 0x52, 
-	0xde, 0x77, 0xbe, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xf8, 0x56, 0x3a, 0x63, 
-	0xce, 0x31, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xd9, 0x56, 0x7d, 0x67, 
-	0x5c, 0x63, 0x7d, 0x63, 0x7d, 0x63, 0x6e, 0x21, 0x5d, 0x5f, 0x5e, 0x5f, 0x7f, 0x63, 0x1e, 0x53, 
-	0x1f, 0x4f, 0xff, 0x4e, 0x5f, 0x3e, 0xbf, 0x2d, 0x7f, 0x2d, 0x7f, 0x2d, 0x17, 0x1d, 0x7f, 0x6f, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xb5, 0x52, 0xcd, 0x35, 0x30, 0x3e, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x7c, 0x6b, 0xf7, 0x56, 0x73, 0x4a, 0xf0, 0x39, 0x94, 0x4a, 
-	0xce, 0x31, 0x8d, 0x2d, 0xad, 0x2d, 0x52, 0x42, 0x5a, 0x63, 0xde, 0x77, 0xde, 0x73, 0x9d, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x73, 0xb6, 0x52, 0xcf, 0x35, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xf7, 0x5a, 0x31, 0x42, 
-	0x5a, 0x63, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x73, 0x9c, 0x73, 
-	0x10, 0x42, 0x4a, 0x25, 0xbd, 0x73, 0xde, 0x77, 0x5b, 0x67, 0x18, 0x5f, 0x74, 0x4a, 0x11, 0x3e, 
-	0x8d, 0x2d, 0x94, 0x4e, 0xd7, 0x56, 0x39, 0x5f, 0x9c, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xf7, 0x5a, 0xef, 0x39, 
-	0x18, 0x5f, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x7c, 0x67, 
-	0xfb, 0x5a, 0x4f, 0x29, 0x8f, 0x2d, 0x31, 0x3e, 0x30, 0x42, 0x94, 0x4e, 0xde, 0x77, 0xde, 0x73, 
-	0x9c, 0x6b, 0x12, 0x3a, 0x7d, 0x67, 0x7e, 0x67, 0x7d, 0x63, 0x7e, 0x63, 0x7f, 0x63, 0x5e, 0x5b, 
-	0x3e, 0x5b, 0x1e, 0x57, 0xff, 0x52, 0x9f, 0x4a, 0x9f, 0x4a, 0xbf, 0x35, 0x3f, 0x2d, 0xb5, 0x14, 
-	0x50, 0x08, 0x32, 0x08, 0x55, 0x10, 0x55, 0x10, 0x32, 0x0c, 0x16, 0x42, 0xdf, 0x77, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0x94, 0x4e, 0x9b, 0x6b, 0x0e, 0x3a, 0x0d, 0x36, 0x89, 0x29, 0x89, 0x25, 0x8a, 0x25, 0x93, 0x4a, 
-	0x94, 0x4e, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0x9c, 0x6f, 0x18, 0x5b, 0x31, 0x42, 
-	0x39, 0x5f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x95, 0x4e, 
-	0x5b, 0x5f, 0x9e, 0x63, 0x5e, 0x5f, 0x1b, 0x57, 0x9f, 0x67, 0x97, 0x46, 0xf3, 0x2d, 0x1d, 0x57, 
-	0x3f, 0x57, 0x1f, 0x53, 0x7f, 0x46, 0xdf, 0x31, 0x7e, 0x2d, 0x1a, 0x21, 0x74, 0x08, 0x79, 0x2d, 
-	0x57, 0x2d, 0xfc, 0x5a, 0xbf, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0x7b, 0x6b, 0x6b, 0x29, 0xad, 0x31, 0xfe, 0x77, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x5a, 0x63, 
-	0x94, 0x4e, 0x10, 0x3a, 0xad, 0x2d, 0x31, 0x42, 0x10, 0x3a, 0x6c, 0x29, 0x94, 0x4e, 0x7c, 0x6b, 
-	0xde, 0x77, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0x19, 0x5f, 0xf0, 0x39, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xd6, 0x56, 
-	0xef, 0x39, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0x39, 0x67, 
-	0x31, 0x42, 0x6b, 0x29, 0xf7, 0x5a, 0xb5, 0x4e, 0xef, 0x35, 0xf0, 0x39, 0x94, 0x4a, 0x19, 0x5f, 
-	0x5b, 0x67, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x73, 0x4e, 0xce, 0x35, 
-	0x7b, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x33, 0x42, 0x18, 0x3a, 
-	0x77, 0x29, 0x11, 0x1d, 0x71, 0x25, 0x0b, 0x19, 0x6a, 0x25, 0x18, 0x5f, 0xbe, 0x73, 0x39, 0x5f, 
-	0x96, 0x4a, 0x9e, 0x67, 0x9e, 0x67, 0x7e, 0x67, 0x9f, 0x67, 0x7f, 0x67, 0x7e, 0x63, 0x7f, 0x5f, 
-	0x3e, 0x5b, 0x5f, 0x5f, 0x7b, 0x42, 0x9e, 0x46, 0x3f, 0x3e, 0xbe, 0x35, 0xd6, 0x1c, 0xd7, 0x1c, 
-	0xde, 0x20, 0x9f, 0x1c, 0x5d, 0x10, 0x5c, 0x10, 0x7c, 0x14, 0x54, 0x0c, 0xd4, 0x39, 0xdf, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xd6, 0x52, 0x7b, 0x6b, 0xcd, 0x31, 0xaa, 0x29, 0x89, 0x29, 0xaa, 0x29, 0x48, 0x21, 
-	0xb3, 0x4e, 0xf7, 0x5a, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x18, 0x5f, 0xf7, 0x56, 0x29, 0x1d, 
-	0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x77, 0xff, 0x7b, 
-	0x7c, 0x67, 0xd9, 0x4e, 0x1b, 0x57, 0xfb, 0x52, 0x13, 0x36, 0x97, 0x46, 0xb9, 0x4a, 0x3e, 0x57, 
-	0x3f, 0x57, 0x3e, 0x57, 0xfd, 0x4e, 0xfb, 0x35, 0xb6, 0x10, 0x1d, 0x25, 0xde, 0x1c, 0x7d, 0x10, 
-	0x7d, 0x10, 0x31, 0x04, 0x9a, 0x4e, 0xbf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0x94, 0x4e, 0x6b, 0x29, 0x5a, 0x67, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xdf, 0x77, 0xde, 0x73, 0x9c, 0x6b, 0x19, 0x5f, 0xb6, 0x52, 0x94, 0x4a, 0x4a, 0x21, 0x29, 0x1d, 
-	0xad, 0x2d, 0x18, 0x5f, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0x39, 0x63, 0x95, 0x4e, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x18, 0x5f, 
-	0x10, 0x3e, 0x5a, 0x67, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9d, 0x6f, 0x7b, 0x6b, 0xf7, 0x5a, 0x73, 0x4a, 0x31, 0x42, 
-	0x52, 0x46, 0x52, 0x46, 0x94, 0x4a, 0xb6, 0x52, 0xf7, 0x5a, 0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x74, 0x4e, 0x8c, 0x2d, 
-	0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0x16, 0x3a, 0xf5, 0x18, 
-	0x1b, 0x1d, 0x1a, 0x1d, 0xb5, 0x10, 0x34, 0x25, 0xb1, 0x31, 0x7b, 0x6b, 0xde, 0x77, 0x96, 0x4e, 
-	0xbe, 0x6b, 0x7e, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0x9f, 0x67, 0x7e, 0x63, 0x9f, 0x63, 0x7e, 0x5f, 
-	0x7f, 0x63, 0xba, 0x4a, 0x39, 0x3e, 0x7f, 0x46, 0x5f, 0x42, 0x57, 0x21, 0x93, 0x14, 0x1e, 0x29, 
-	0x9e, 0x1c, 0x5f, 0x14, 0x5e, 0x10, 0x3c, 0x0c, 0x1d, 0x0c, 0x78, 0x10, 0x2a, 0x00, 0x1a, 0x5f, 
-	0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0x9d, 0x6f, 0xb6, 0x52, 0x9d, 0x6f, 0xf7, 0x56, 0xee, 0x35, 0xcc, 0x31, 0xab, 0x2d, 
-	0xab, 0x2d, 0xd5, 0x56, 0x39, 0x5f, 0xbe, 0x73, 0xde, 0x73, 0xb5, 0x4e, 0x94, 0x4e, 0x51, 0x42, 
-	0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 
-	0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x7b, 0x6b, 0x5b, 0x6b, 0x9d, 0x73, 0x7c, 0x6b, 
-	0x19, 0x5f, 0x3a, 0x5f, 0xf9, 0x56, 0xb8, 0x4a, 0x3b, 0x5b, 0x7e, 0x63, 0x5f, 0x5f, 0x3e, 0x57, 
-	0xfd, 0x4e, 0x59, 0x36, 0x54, 0x1d, 0xb9, 0x29, 0xbf, 0x31, 0xff, 0x20, 0x9f, 0x18, 0x5e, 0x10, 
-	0x7e, 0x10, 0x9b, 0x14, 0x52, 0x08, 0x3e, 0x67, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0x7a, 0x67, 0xad, 0x31, 0x52, 0x46, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x9c, 0x6f, 0x3a, 0x63, 
-	0x19, 0x5f, 0xf0, 0x39, 0x2a, 0x21, 0xad, 0x31, 0x18, 0x5b, 0x5b, 0x67, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x7c, 0x6b, 0x3a, 0x63, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0x94, 0x4e, 0x6c, 0x2d, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x39, 0x63, 0x94, 0x4e, 0x53, 0x46, 0x52, 0x46, 0x53, 0x46, 0x31, 0x3e, 0x94, 0x4e, 
-	0xd6, 0x56, 0x5a, 0x67, 0x9d, 0x6f, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xad, 0x31, 0x31, 0x42, 
-	0xde, 0x7b, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7c, 0x6b, 0x1d, 0x5b, 0x17, 0x19, 
-	0x1a, 0x15, 0x1a, 0x19, 0x1a, 0x3a, 0x76, 0x42, 0xcf, 0x31, 0xde, 0x77, 0xde, 0x77, 0x3a, 0x5f, 
-	0x9e, 0x6b, 0x9e, 0x67, 0xbe, 0x6b, 0x7e, 0x63, 0x9f, 0x67, 0x9e, 0x67, 0x7d, 0x63, 0x5d, 0x5f, 
-	0x91, 0x29, 0xbb, 0x4a, 0xbc, 0x4a, 0x3c, 0x3e, 0x3b, 0x3e, 0x58, 0x25, 0x3c, 0x29, 0x3f, 0x2d, 
-	0x9d, 0x18, 0x5e, 0x14, 0x5f, 0x14, 0x3d, 0x0c, 0x1d, 0x0c, 0xb9, 0x18, 0x8c, 0x10, 0xdf, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0x7b, 0x6b, 0xd6, 0x56, 0x7b, 0x6b, 0x38, 0x5f, 0x31, 0x42, 
-	0xac, 0x2d, 0x31, 0x42, 0x94, 0x4a, 0xbe, 0x73, 0xde, 0x77, 0x73, 0x46, 0x30, 0x3e, 0xd6, 0x56, 
-	0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x5b, 0x67, 0x3a, 0x63, 0xb5, 0x4e, 
-	0x7b, 0x67, 0x5a, 0x63, 0x7b, 0x67, 0x5b, 0x67, 0x5b, 0x67, 0x7c, 0x6f, 0xdf, 0x77, 0xde, 0x77, 
-	0xff, 0x77, 0xbd, 0x73, 0xb7, 0x4a, 0x9d, 0x63, 0x33, 0x36, 0x3b, 0x57, 0xb7, 0x46, 0x37, 0x36, 
-	0xfe, 0x4e, 0x3f, 0x57, 0x7e, 0x3e, 0x3f, 0x3a, 0x3f, 0x21, 0xdf, 0x1c, 0x7f, 0x14, 0x9f, 0x14, 
-	0x5f, 0x10, 0x9f, 0x1c, 0x57, 0x10, 0xd8, 0x52, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x73, 0x30, 0x3e, 0x6a, 0x29, 0x9c, 0x6f, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xdf, 0x77, 0xbd, 0x6f, 0x5a, 0x67, 0xb6, 0x52, 0xcf, 0x35, 0x4a, 0x21, 0x11, 0x3e, 
-	0xb5, 0x52, 0x18, 0x5f, 0x7b, 0x6b, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x77, 
-	0x73, 0x4a, 0x73, 0x4a, 0x39, 0x63, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0x5b, 0x67, 0xb5, 0x52, 0x11, 0x3e, 0x32, 0x42, 0xd6, 0x52, 0x5b, 0x67, 0x9d, 0x6f, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9c, 0x6f, 0xad, 0x31, 0x73, 0x4e, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x59, 0x63, 0xfe, 0x5a, 0xbb, 0x2d, 
-	0x9b, 0x29, 0xf5, 0x18, 0xf0, 0x18, 0x5b, 0x67, 0x7b, 0x6b, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x6f, 
-	0x3b, 0x5b, 0xbe, 0x6b, 0x9d, 0x67, 0x9f, 0x6b, 0x9f, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0x5e, 0x5f, 
-	0x98, 0x4a, 0x9a, 0x46, 0x9b, 0x46, 0xf0, 0x14, 0x3c, 0x3e, 0x9e, 0x35, 0x5f, 0x35, 0xff, 0x24, 
-	0x9f, 0x1c, 0x5f, 0x18, 0x5e, 0x14, 0x3c, 0x0c, 0x3d, 0x0c, 0x9a, 0x14, 0x0c, 0x04, 0x1c, 0x63, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x7b, 0x67, 0xd6, 0x52, 0xd7, 0x56, 
-	0xd6, 0x56, 0x94, 0x4e, 0x18, 0x5f, 0x5a, 0x63, 0xde, 0x77, 0x74, 0x4a, 0x73, 0x4a, 0x39, 0x63, 
-	0xbd, 0x6f, 0xde, 0x73, 0x5b, 0x67, 0x7c, 0x6b, 0x7b, 0x67, 0x9d, 0x6f, 0xde, 0x73, 0xde, 0x77, 
-	0xbd, 0x6f, 0x39, 0x63, 0x7b, 0x67, 0x7b, 0x6b, 0x9c, 0x6b, 0x7b, 0x67, 0xf6, 0x5a, 0x30, 0x42, 
-	0x49, 0x21, 0x1a, 0x57, 0x7e, 0x63, 0x7e, 0x63, 0x7d, 0x63, 0x1b, 0x57, 0x55, 0x3e, 0xf6, 0x31, 
-	0x38, 0x36, 0xbd, 0x46, 0xbf, 0x46, 0x1f, 0x36, 0x5f, 0x29, 0x7e, 0x14, 0x7f, 0x18, 0x5e, 0x10, 
-	0x7f, 0x10, 0x7c, 0x14, 0x96, 0x10, 0x4f, 0x29, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0x18, 0x5f, 0x8c, 0x2d, 0xd6, 0x56, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x7b, 0x6b, 0xf7, 0x5a, 
-	0x32, 0x42, 0xae, 0x31, 0x8c, 0x2d, 0x2a, 0x21, 0x6b, 0x25, 0x10, 0x3e, 0xb6, 0x52, 0x19, 0x5f, 
-	0x7b, 0x6b, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0x7b, 0x6b, 0xf7, 0x5a, 0x31, 0x42, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x5a, 0x67, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x18, 0x5f, 0x8c, 0x2d, 0x39, 0x63, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x7b, 0x67, 0x5d, 0x67, 0x9c, 0x4e, 
-	0xb8, 0x2d, 0xfc, 0x5a, 0xf8, 0x56, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 
-	0x9d, 0x6f, 0x11, 0x3a, 0xf9, 0x56, 0x3d, 0x5b, 0xbf, 0x6b, 0x7e, 0x67, 0x9e, 0x67, 0x7f, 0x67, 
-	0x7f, 0x63, 0x3f, 0x5b, 0xdd, 0x4e, 0x7d, 0x46, 0xb7, 0x31, 0xf8, 0x20, 0xdf, 0x24, 0x7e, 0x18, 
-	0x9f, 0x1c, 0x5e, 0x14, 0x7f, 0x1c, 0x3d, 0x10, 0x3c, 0x0c, 0x7c, 0x14, 0x77, 0x10, 0x2f, 0x08, 
-	0x5e, 0x67, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0x7b, 0x67, 0xf8, 0x5a, 0x18, 0x5b, 0x73, 0x46, 0xdf, 0x77, 0x32, 0x42, 0x19, 0x5f, 0x7b, 0x67, 
-	0x9c, 0x6b, 0x94, 0x4e, 0x9d, 0x6f, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x6f, 0x38, 0x5f, 0xee, 0x35, 
-	0x8a, 0x29, 0x48, 0x21, 0x49, 0x21, 0x49, 0x21, 0x8a, 0x29, 0x48, 0x21, 0x6a, 0x25, 0x4a, 0x1d, 
-	0x1a, 0x57, 0x7d, 0x5f, 0x7d, 0x63, 0x7e, 0x63, 0x9f, 0x67, 0xf3, 0x2d, 0x1d, 0x53, 0x18, 0x36, 
-	0x7b, 0x42, 0xbc, 0x46, 0xdf, 0x46, 0x1f, 0x36, 0x3f, 0x21, 0x9f, 0x14, 0x9f, 0x14, 0x7f, 0x14, 
-	0x7e, 0x10, 0xbd, 0x18, 0x96, 0x10, 0x77, 0x4a, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0x9b, 0x6f, 0xac, 0x31, 0xef, 0x35, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xdd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbd, 0x6f, 0x7b, 0x6b, 0x09, 0x21, 0x2a, 0x21, 0x6b, 0x29, 0x6b, 0x29, 0x29, 0x21, 
-	0x6b, 0x29, 0x29, 0x21, 0xce, 0x35, 0xb5, 0x52, 0x19, 0x5f, 0x9c, 0x6f, 0xde, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0x9d, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xde, 0x73, 0x31, 0x3e, 0x6b, 0x29, 0x7a, 0x6b, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xb6, 0x56, 0xae, 0x35, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x74, 0x4a, 0x1a, 0x5f, 
-	0xfa, 0x5a, 0x7b, 0x67, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xff, 0x7b, 0x9c, 0x6b, 0x3b, 0x5f, 0xd1, 0x31, 0x1a, 0x57, 0x9f, 0x67, 0x1b, 0x5b, 
-	0x13, 0x36, 0x9f, 0x67, 0x7a, 0x42, 0x5d, 0x46, 0x99, 0x31, 0x7e, 0x31, 0xfe, 0x28, 0xbe, 0x20, 
-	0x9e, 0x1c, 0x3e, 0x14, 0x7f, 0x18, 0x1c, 0x08, 0x9e, 0x14, 0x5d, 0x10, 0x5a, 0x14, 0x51, 0x0c, 
-	0x9f, 0x73, 0xdc, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xdd, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0x9d, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0x11, 0x3e, 0x10, 0x3a, 0x9c, 0x6b, 
-	0xb6, 0x52, 0x5b, 0x67, 0xbd, 0x73, 0x18, 0x5f, 0x51, 0x42, 0x6a, 0x25, 0x69, 0x25, 0x89, 0x25, 
-	0x68, 0x21, 0x47, 0x21, 0x68, 0x21, 0x48, 0x21, 0x49, 0x21, 0x49, 0x21, 0xf0, 0x39, 0x1a, 0x5b, 
-	0x7d, 0x63, 0x9e, 0x67, 0x7d, 0x63, 0x7e, 0x67, 0x9f, 0x67, 0xd1, 0x2d, 0xdb, 0x4a, 0x5f, 0x5b, 
-	0xfe, 0x4e, 0x74, 0x21, 0x3d, 0x3a, 0xdf, 0x31, 0x3f, 0x25, 0x9f, 0x18, 0x7e, 0x14, 0x7e, 0x10, 
-	0x7d, 0x10, 0x35, 0x04, 0x2e, 0x04, 0x7f, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x7c, 0x6f, 
-	0x2a, 0x21, 0xad, 0x31, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xce, 0x35, 0xee, 0x39, 0x08, 0x1d, 0x94, 0x4e, 0xf7, 0x5a, 0x5a, 0x63, 
-	0xd6, 0x56, 0xef, 0x35, 0xad, 0x2d, 0x6b, 0x25, 0x2a, 0x21, 0x08, 0x19, 0xad, 0x2d, 0xce, 0x35, 
-	0x94, 0x4e, 0x39, 0x5f, 0x7b, 0x6b, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xde, 0x73, 0xcf, 0x35, 0x08, 0x1d, 0xce, 0x39, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0x73, 0x4e, 0x31, 0x42, 0xdf, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xdd, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0x3c, 0x5b, 0x9f, 0x67, 0x9e, 0x63, 0xb0, 0x29, 
-	0xd2, 0x31, 0x9a, 0x46, 0xba, 0x4e, 0x54, 0x25, 0x5a, 0x29, 0x7f, 0x35, 0xf9, 0x24, 0x0e, 0x00, 
-	0x95, 0x14, 0x7d, 0x1c, 0x5e, 0x14, 0x3c, 0x0c, 0x5d, 0x10, 0x7c, 0x14, 0xb8, 0x18, 0x57, 0x46, 
-	0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xde, 0x77, 0x53, 0x46, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xdf, 0x77, 0xbd, 0x73, 0x7b, 0x6b, 0x18, 0x5b, 0x39, 0x63, 0xf8, 0x5a, 0xf7, 0x5a, 0x9d, 0x6f, 
-	0x39, 0x63, 0x7b, 0x67, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xf8, 0x5a, 0xde, 0x73, 0xbe, 0x73, 
-	0xd6, 0x56, 0xbd, 0x73, 0x94, 0x4e, 0x4a, 0x25, 0xac, 0x2d, 0x69, 0x21, 0x48, 0x21, 0x69, 0x25, 
-	0x47, 0x21, 0x48, 0x21, 0x69, 0x25, 0x69, 0x25, 0x6a, 0x25, 0xb5, 0x52, 0x7c, 0x67, 0x5d, 0x67, 
-	0x5d, 0x5f, 0x7d, 0x5f, 0x9e, 0x67, 0x7e, 0x63, 0x55, 0x3e, 0x7e, 0x63, 0x5e, 0x5b, 0x1e, 0x53, 
-	0x1f, 0x53, 0x1b, 0x32, 0x58, 0x21, 0xbf, 0x31, 0x1f, 0x21, 0x7f, 0x10, 0x5e, 0x10, 0x7e, 0x14, 
-	0x5d, 0x10, 0xbc, 0x18, 0x92, 0x14, 0xbf, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdd, 0x77, 0x7a, 0x67, 0x52, 0x46, 0x29, 0x21, 
-	0x07, 0x1d, 0x7b, 0x6b, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x73, 
-	0xbf, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0x10, 0x3e, 0xac, 0x2d, 0xe6, 0x18, 0x39, 0x63, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xde, 0x73, 0x5a, 0x67, 0x18, 0x5f, 0xf7, 0x56, 0x74, 0x4a, 0xf0, 0x39, 0x10, 0x3a, 
-	0xef, 0x35, 0x6c, 0x29, 0x8c, 0x29, 0xf0, 0x39, 0x31, 0x3e, 0x31, 0x42, 0xf8, 0x5a, 0x7b, 0x67, 
-	0xde, 0x73, 0x5a, 0x63, 0x18, 0x5f, 0xad, 0x31, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x73, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0x18, 0x5f, 0x11, 0x42, 0x18, 0x5f, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xdf, 0x77, 0xde, 0x77, 0xdf, 0x7b, 0x9d, 0x6f, 0x7d, 0x63, 0x9f, 0x67, 0x9f, 0x67, 0x9f, 0x67, 
-	0x7f, 0x63, 0x35, 0x3e, 0x79, 0x42, 0x3b, 0x42, 0xfe, 0x3d, 0x3e, 0x2d, 0xfe, 0x28, 0xbc, 0x24, 
-	0x96, 0x18, 0x30, 0x08, 0x77, 0x14, 0x3a, 0x10, 0x19, 0x0c, 0x56, 0x14, 0x35, 0x42, 0xbe, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbc, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0x9c, 0x6b, 0xce, 0x31, 
-	0x9c, 0x6f, 0x19, 0x5f, 0xf8, 0x5a, 0xd7, 0x56, 0x39, 0x63, 0x3a, 0x67, 0x5b, 0x6b, 0x18, 0x5f, 
-	0xf7, 0x5a, 0x39, 0x63, 0x7b, 0x6b, 0xbd, 0x73, 0xff, 0x77, 0xff, 0x77, 0xde, 0x77, 0xbc, 0x73, 
-	0x9b, 0x6f, 0x7b, 0x6b, 0x18, 0x5b, 0x7c, 0x6b, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0x9c, 0x6b, 0x52, 0x46, 0x39, 0x63, 0x93, 0x4a, 0xac, 0x2d, 0xcd, 0x31, 0x6a, 0x25, 0x6a, 0x25, 
-	0x8b, 0x29, 0x8b, 0x29, 0x6a, 0x25, 0x10, 0x3e, 0x7b, 0x6b, 0xdf, 0x73, 0x19, 0x5b, 0x7d, 0x67, 
-	0x7e, 0x67, 0x9e, 0x63, 0x7d, 0x63, 0x5d, 0x5b, 0xf9, 0x52, 0x5f, 0x5f, 0x3f, 0x5b, 0x1e, 0x53, 
-	0x3f, 0x57, 0x3c, 0x3a, 0xdc, 0x31, 0x3b, 0x21, 0x1f, 0x21, 0xbf, 0x18, 0x5d, 0x10, 0x7d, 0x14, 
-	0x9e, 0x18, 0x98, 0x14, 0x98, 0x4e, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0x9c, 0x6b, 0xd0, 0x39, 0xaf, 0x31, 0xef, 0x39, 0x0e, 0x3a, 0x48, 0x21, 
-	0x18, 0x5f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xfb, 0x5e, 
-	0xd9, 0x56, 0xbf, 0x73, 0xbf, 0x73, 0xde, 0x77, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xff, 0x77, 
-	0x52, 0x46, 0x0f, 0x3a, 0x4a, 0x25, 0x9c, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 
-	0x7c, 0x6b, 0x7c, 0x6b, 0x18, 0x5b, 0x31, 0x42, 0xae, 0x2d, 0xae, 0x2d, 0xf0, 0x39, 0xb6, 0x4e, 
-	0x32, 0x42, 0x11, 0x3e, 0x73, 0x4a, 0xad, 0x31, 0xb5, 0x52, 0x18, 0x5f, 0x5a, 0x67, 0x7c, 0x6b, 
-	0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0x31, 0x46, 0x10, 0x3e, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xdd, 0x73, 
-	0xdd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x73, 0xde, 0x73, 0xdf, 0x73, 
-	0xdf, 0x77, 0xde, 0x77, 0xff, 0x77, 0xfa, 0x5a, 0xbe, 0x6b, 0x9e, 0x67, 0x9e, 0x63, 0x7f, 0x63, 
-	0x3e, 0x5b, 0x7a, 0x46, 0x1f, 0x57, 0x7f, 0x46, 0xff, 0x3d, 0x5f, 0x31, 0x3e, 0x2d, 0x1e, 0x2d, 
-	0xbe, 0x20, 0xba, 0x1c, 0x30, 0x08, 0xb4, 0x31, 0x1a, 0x5f, 0xbf, 0x73, 0xdf, 0x77, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbf, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9d, 0x6f, 
-	0xb6, 0x52, 0xde, 0x77, 0xbd, 0x73, 0x7b, 0x6b, 0x7b, 0x6b, 0x7b, 0x6b, 0x9c, 0x6f, 0xbd, 0x73, 
-	0x7a, 0x6b, 0x59, 0x63, 0x17, 0x5f, 0x72, 0x4a, 0x0f, 0x3a, 0x50, 0x42, 0xec, 0x31, 0xab, 0x2d, 
-	0xcc, 0x31, 0xcd, 0x31, 0xb5, 0x4e, 0x19, 0x5f, 0x3a, 0x63, 0xbd, 0x73, 0x7c, 0x6b, 0x9c, 0x6b, 
-	0xbd, 0x6f, 0xde, 0x77, 0x5a, 0x67, 0x73, 0x4a, 0x10, 0x3e, 0x10, 0x3a, 0x10, 0x3e, 0xce, 0x31, 
-	0x52, 0x42, 0xf7, 0x5a, 0x9c, 0x6b, 0xde, 0x73, 0xbe, 0x6f, 0xde, 0x73, 0x11, 0x3a, 0x5b, 0x63, 
-	0x9e, 0x6b, 0x9e, 0x67, 0x9d, 0x67, 0xd1, 0x2d, 0x5d, 0x5b, 0x5e, 0x5f, 0x5f, 0x5b, 0x3e, 0x53, 
-	0xdf, 0x4a, 0x7f, 0x3e, 0x79, 0x21, 0xb5, 0x10, 0xfb, 0x20, 0x9d, 0x18, 0x7e, 0x14, 0x9e, 0x1c, 
-	0x9a, 0x18, 0xd5, 0x39, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0x3d, 0x63, 0x6e, 0x0c, 0x4d, 0x0c, 0x6d, 0x29, 0xec, 0x35, 0xec, 0x35, 
-	0x5b, 0x67, 0xbf, 0x73, 0xdd, 0x73, 0xdc, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x1b, 0x5f, 0xd3, 0x18, 0x77, 0x10, 
-	0xb7, 0x18, 0xf4, 0x3d, 0xdf, 0x77, 0xbe, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xff, 0x7b, 0x94, 0x4e, 
-	0x8c, 0x2d, 0xef, 0x39, 0xbc, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x5a, 0x67, 
-	0xf7, 0x56, 0x32, 0x42, 0x31, 0x3e, 0x32, 0x42, 0xf0, 0x39, 0x4a, 0x25, 0x6b, 0x29, 0x09, 0x1d, 
-	0x6b, 0x25, 0x2a, 0x21, 0xce, 0x35, 0x53, 0x46, 0x32, 0x42, 0x94, 0x4a, 0x39, 0x5f, 0x7b, 0x67, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0x8c, 0x2d, 0x10, 0x3e, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xff, 0x7b, 0xde, 0x73, 0x7d, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0x9f, 0x67, 0x7f, 0x63, 
-	0x5f, 0x5f, 0x3f, 0x57, 0x1f, 0x57, 0xda, 0x31, 0xff, 0x3d, 0x5e, 0x31, 0x5f, 0x35, 0x1f, 0x2d, 
-	0x7f, 0x1c, 0x5e, 0x18, 0xba, 0x1c, 0xcf, 0x18, 0x9f, 0x73, 0x9d, 0x6f, 0xbf, 0x73, 0xbe, 0x73, 
-	0xdd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x5a, 0x67, 0x7b, 0x6b, 0xd6, 0x56, 0x10, 0x3a, 0x0e, 0x3a, 0x0e, 0x3a, 0xaa, 0x29, 
-	0xaa, 0x29, 0x88, 0x25, 0x89, 0x25, 0xa9, 0x29, 0xaa, 0x29, 0x69, 0x25, 0x69, 0x25, 0x89, 0x25, 
-	0xab, 0x2d, 0xcc, 0x31, 0x8b, 0x29, 0x95, 0x4e, 0x5b, 0x67, 0xbd, 0x73, 0xbd, 0x73, 0xae, 0x31, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0x9c, 0x6b, 0x5a, 0x63, 0x9c, 0x6f, 
-	0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0x9c, 0x6b, 0x3a, 0x63, 
-	0xd8, 0x56, 0xb7, 0x52, 0xf8, 0x56, 0xf8, 0x52, 0x7e, 0x63, 0x5e, 0x5b, 0x3e, 0x57, 0xfe, 0x4e, 
-	0xbf, 0x46, 0x7f, 0x3e, 0x1f, 0x3a, 0x5c, 0x29, 0xd3, 0x18, 0x7c, 0x4e, 0x77, 0x29, 0x91, 0x10, 
-	0xb2, 0x31, 0x9e, 0x6f, 0xbc, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0x9d, 0x6f, 0x5c, 0x67, 0x8f, 0x10, 0x95, 0x10, 0x4e, 0x04, 0xd0, 0x35, 0x4b, 0x21, 0xef, 0x39, 
-	0x59, 0x63, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbf, 0x73, 0x76, 0x29, 0xdd, 0x18, 0x3d, 0x0c, 
-	0x7c, 0x10, 0x76, 0x14, 0x97, 0x52, 0xdf, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xb5, 0x52, 0x4a, 0x25, 
-	0x73, 0x4a, 0xde, 0x77, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0x39, 0x63, 0xf7, 0x5a, 0xff, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x39, 0x63, 
-	0xb6, 0x52, 0x53, 0x46, 0x74, 0x4a, 0xcf, 0x35, 0xf0, 0x39, 0x94, 0x4a, 0x29, 0x1d, 0x6c, 0x29, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xb5, 0x52, 0xee, 0x39, 0x5a, 0x67, 0xbe, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbf, 0x73, 
-	0xbf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xde, 0x7b, 0x7b, 0x6b, 0x5c, 0x67, 0x7e, 0x67, 0x7e, 0x67, 0x9f, 0x67, 0x7f, 0x67, 
-	0x5e, 0x5f, 0x3e, 0x5b, 0xdc, 0x4e, 0xd9, 0x35, 0xff, 0x41, 0x5f, 0x35, 0x1f, 0x2d, 0xff, 0x2c, 
-	0x7e, 0x18, 0x5d, 0x14, 0x7d, 0x18, 0x34, 0x08, 0x9a, 0x56, 0xbe, 0x77, 0xbe, 0x73, 0xdd, 0x73, 
-	0xdc, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xf7, 0x5a, 0xd6, 0x56, 0x9b, 0x6b, 0x38, 0x5f, 0x0e, 0x3a, 0x8a, 0x29, 
-	0x89, 0x25, 0x68, 0x21, 0x89, 0x25, 0x47, 0x1d, 0x69, 0x25, 0xab, 0x2d, 0x30, 0x3e, 0x72, 0x46, 
-	0x93, 0x4a, 0xd6, 0x56, 0x9c, 0x6f, 0xde, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xf7, 0x56, 
-	0x19, 0x5f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xdf, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xd8, 0x52, 0x9f, 0x67, 0x5e, 0x5b, 0x3f, 0x5b, 0xdf, 0x4e, 
-	0x9f, 0x46, 0x5f, 0x3a, 0xdf, 0x31, 0x7d, 0x29, 0x31, 0x21, 0xdf, 0x77, 0xdf, 0x73, 0xbe, 0x6f, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 
-	0xdf, 0x73, 0x2e, 0x21, 0x73, 0x0c, 0x74, 0x0c, 0x0c, 0x00, 0x2d, 0x08, 0x4d, 0x0c, 0x0d, 0x21, 
-	0x59, 0x63, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0x7d, 0x6b, 0xf8, 0x18, 0x9e, 0x14, 0x9e, 0x14, 
-	0x5c, 0x0c, 0xbd, 0x1c, 0x0c, 0x00, 0x0d, 0x1d, 0xdb, 0x56, 0x3b, 0x63, 0x54, 0x46, 0x51, 0x42, 
-	0xfe, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x73, 0x4a, 
-	0x4a, 0x25, 0x6b, 0x29, 0xde, 0x77, 0x9d, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xef, 0x39, 0xce, 0x35, 0xdf, 0x7b, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xdf, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xf1, 0x39, 0xfa, 0x56, 0x7e, 0x67, 0x9f, 0x67, 0x7f, 0x67, 
-	0x7e, 0x63, 0x5e, 0x5f, 0xdc, 0x4e, 0xd9, 0x35, 0x1f, 0x46, 0x5e, 0x31, 0x7f, 0x35, 0x3f, 0x31, 
-	0xbf, 0x20, 0x7d, 0x18, 0x7e, 0x18, 0x76, 0x10, 0xb5, 0x35, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xf8, 0x5a, 0x74, 0x4a, 0xf8, 0x5a, 0x39, 0x63, 
-	0x17, 0x5b, 0x39, 0x63, 0x5a, 0x63, 0x5a, 0x63, 0x39, 0x63, 0xd6, 0x56, 0x52, 0x46, 0xd6, 0x56, 
-	0x9d, 0x6f, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0x9c, 0x6b, 0x9c, 0x6b, 0x5a, 0x63, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xdf, 0x7b, 0xd7, 0x52, 0x56, 0x3e, 0x3d, 0x57, 0x3e, 0x57, 0xff, 0x52, 
-	0xbf, 0x46, 0x3e, 0x36, 0x1f, 0x36, 0x5b, 0x25, 0xd4, 0x35, 0xdf, 0x77, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9d, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0x3a, 0x63, 0x4d, 0x08, 0x34, 0x08, 0x33, 0x04, 0x30, 0x04, 0x52, 0x0c, 0xee, 0x1c, 0x75, 0x4a, 
-	0x9c, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0x1b, 0x5f, 0x9b, 0x29, 0x9e, 0x18, 0x7d, 0x10, 
-	0x9e, 0x14, 0x7d, 0x0c, 0x5a, 0x0c, 0x58, 0x0c, 0x56, 0x0c, 0x32, 0x08, 0x10, 0x1d, 0x3d, 0x63, 
-	0xdf, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x77, 0xf7, 0x5a, 0x4a, 0x25, 
-	0xad, 0x31, 0x9c, 0x6f, 0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xdd, 0x77, 0xdd, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xd6, 0x5a, 0x8c, 0x31, 0x18, 0x5f, 0xdf, 0x77, 0xbf, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0x19, 0x5f, 0x54, 0x42, 0x9f, 0x6b, 0x9e, 0x67, 
-	0x7d, 0x5f, 0x5e, 0x5f, 0xdd, 0x4e, 0xda, 0x35, 0x1f, 0x42, 0x7e, 0x35, 0x1f, 0x29, 0x1f, 0x2d, 
-	0xbe, 0x20, 0x5d, 0x14, 0x7c, 0x18, 0x75, 0x10, 0x78, 0x4a, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0x9c, 0x6f, 0x18, 0x5f, 
-	0x94, 0x4e, 0x73, 0x4a, 0xd7, 0x56, 0xd7, 0x56, 0x19, 0x5f, 0x9c, 0x6f, 0xde, 0x77, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x73, 0x5a, 0x63, 0xbd, 0x6f, 0x73, 0x46, 0xbd, 0x6f, 
-	0xf7, 0x56, 0x39, 0x63, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xdf, 0x77, 0x7d, 0x63, 0x3d, 0x53, 0x1e, 0x53, 0x7d, 0x46, 
-	0x5e, 0x3e, 0xfc, 0x2d, 0xff, 0x35, 0x19, 0x1d, 0x9a, 0x4e, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0x9e, 0x6f, 0xae, 0x10, 0x33, 0x08, 0x34, 0x04, 0x33, 0x04, 0x50, 0x08, 0x97, 0x52, 0x9d, 0x73, 
-	0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 
-	0xdf, 0x77, 0x7c, 0x67, 0x5c, 0x67, 0xff, 0x7b, 0x5c, 0x63, 0x7c, 0x29, 0xdf, 0x1c, 0xbd, 0x14, 
-	0x7d, 0x10, 0x5d, 0x08, 0x3b, 0x08, 0x3b, 0x08, 0x3b, 0x08, 0x7d, 0x10, 0x57, 0x0c, 0x51, 0x08, 
-	0x7f, 0x6f, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbf, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0x31, 0x42, 
-	0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0x18, 0x5f, 0x8c, 0x31, 0xcf, 0x39, 0xde, 0x7b, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0xbe, 0x77, 0xbd, 0x73, 0x73, 0x42, 0x9f, 0x67, 0x9f, 0x63, 
-	0x7f, 0x5f, 0x1e, 0x57, 0xbb, 0x4e, 0xef, 0x18, 0xfd, 0x3d, 0x5e, 0x2d, 0x3e, 0x29, 0x1f, 0x29, 
-	0xbd, 0x20, 0xbe, 0x20, 0xdd, 0x20, 0x30, 0x08, 0x3c, 0x63, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9d, 0x6f, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x7c, 0x6b, 0xae, 0x31, 0x53, 0x46, 0xde, 0x73, 0xb5, 0x4e, 0xbd, 0x6b, 
-	0xbd, 0x6f, 0x5b, 0x67, 0xd7, 0x56, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xff, 0x7b, 0x75, 0x46, 0x3d, 0x5b, 0xb8, 0x4e, 0x92, 0x29, 
-	0xd7, 0x31, 0x9e, 0x4a, 0x97, 0x29, 0x58, 0x46, 0x9f, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0x6f, 0x29, 0x2e, 0x04, 0x74, 0x10, 0x93, 0x10, 0x70, 0x29, 0xbf, 0x73, 0x9d, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x77, 0xbd, 0x73, 0xdf, 0x73, 
-	0xd4, 0x31, 0xb9, 0x29, 0x77, 0x25, 0xb5, 0x2d, 0x3e, 0x5f, 0x19, 0x1d, 0xff, 0x20, 0x5d, 0x0c, 
-	0x5e, 0x10, 0x5d, 0x10, 0x3b, 0x08, 0x3c, 0x08, 0x3c, 0x08, 0x3d, 0x08, 0x58, 0x08, 0x91, 0x10, 
-	0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0x39, 0x63, 0x10, 0x3e, 0x6b, 0x29, 0xb5, 0x52, 0xde, 0x77, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x6f, 0xdd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 
-	0xde, 0x77, 0x9b, 0x6f, 0x9c, 0x6f, 0x9d, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdd, 0x73, 0xdd, 0x73, 
-	0xde, 0x73, 0xbf, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0x8e, 0x29, 0x5e, 0x63, 0x5f, 0x63, 
-	0x5e, 0x5f, 0xb9, 0x4a, 0x4b, 0x21, 0x95, 0x4e, 0xd8, 0x39, 0xbf, 0x39, 0x3f, 0x29, 0x1d, 0x29, 
-	0xb7, 0x1c, 0x71, 0x10, 0x32, 0x21, 0xb8, 0x52, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0x32, 0x42, 0x7b, 0x67, 0x95, 0x4e, 0xde, 0x73, 0x3a, 0x5f, 0xbd, 0x6f, 
-	0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xf8, 0x5a, 0x18, 0x5f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x7c, 0x6b, 0x95, 0x4e, 0x59, 0x67, 0xff, 0x77, 
-	0x3a, 0x5f, 0x55, 0x46, 0x9e, 0x6f, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbc, 0x6f, 0x53, 0x42, 0xab, 0x10, 0x6f, 0x29, 0x9e, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0x97, 0x46, 
-	0xde, 0x4a, 0x3e, 0x32, 0xff, 0x2d, 0xbe, 0x2d, 0x94, 0x0c, 0x1b, 0x21, 0x9e, 0x14, 0x7e, 0x10, 
-	0x7c, 0x10, 0x5b, 0x0c, 0x3c, 0x08, 0x3c, 0x08, 0x3c, 0x08, 0x1d, 0x08, 0x38, 0x0c, 0xf7, 0x3d, 
-	0xdf, 0x77, 0xde, 0x73, 0xdf, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0x9c, 0x6f, 0x0f, 0x3e, 0x4a, 0x25, 0xad, 0x31, 0xf7, 0x5a, 0xde, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xdf, 0x7b, 
-	0xdf, 0x7b, 0xdf, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xdd, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0x9d, 0x6f, 0x12, 0x3e, 0xd0, 0x31, 
-	0xaf, 0x2d, 0x95, 0x4e, 0xde, 0x77, 0xfe, 0x7b, 0x96, 0x4e, 0xf2, 0x1c, 0x18, 0x25, 0xf7, 0x20, 
-	0x8d, 0x14, 0x3d, 0x67, 0xbf, 0x73, 0xbf, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xf7, 0x56, 0x7b, 0x6b, 0xd6, 0x52, 0x95, 0x4e, 0xff, 0x77, 0xd6, 0x52, 0xde, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0x9d, 0x6f, 0xd6, 0x52, 0x5a, 0x63, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x9c, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xf4, 0x31, 
-	0xff, 0x46, 0x7e, 0x36, 0x5f, 0x36, 0xff, 0x35, 0x1b, 0x21, 0xd9, 0x18, 0xbd, 0x14, 0x5e, 0x0c, 
-	0xbf, 0x18, 0x7e, 0x0c, 0x3d, 0x08, 0x5d, 0x0c, 0x7e, 0x0c, 0x3c, 0x0c, 0x13, 0x08, 0x5d, 0x6b, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0x9c, 0x6f, 
-	0x94, 0x4e, 0x8c, 0x2d, 0x8b, 0x2d, 0x73, 0x4a, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xfe, 0x7b, 0xde, 0x77, 0x9d, 0x6f, 0x35, 0x42, 
-	0x74, 0x29, 0xf0, 0x1c, 0x3d, 0x67, 0xbe, 0x73, 0xbe, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xde, 0x77, 
-	0xff, 0x7b, 0xdf, 0x77, 0xbe, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0x1b, 0x5f, 0x1a, 0x5f, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0x7c, 0x6b, 0x18, 0x5b, 0x7b, 0x6b, 0x51, 0x42, 0xd6, 0x56, 0xde, 0x77, 0x18, 0x5b, 0x9d, 0x6b, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xde, 0x73, 0x9c, 0x6b, 0x18, 0x5b, 
-	0x5a, 0x63, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbf, 0x73, 
-	0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x77, 0xde, 0x77, 0x77, 0x42, 
-	0x1f, 0x4f, 0x3d, 0x32, 0x5f, 0x36, 0x3f, 0x36, 0x1f, 0x36, 0x1b, 0x1d, 0xfd, 0x18, 0x7b, 0x0c, 
-	0x5d, 0x10, 0x7d, 0x0c, 0x7e, 0x10, 0x5d, 0x10, 0x7c, 0x10, 0x36, 0x0c, 0x99, 0x4e, 0xdf, 0x77, 
-	0xbf, 0x73, 0xdf, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0x9c, 0x6f, 0x94, 0x4e, 0x8c, 0x2d, 
-	0xad, 0x31, 0xce, 0x35, 0x7b, 0x6b, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9c, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x7b, 0xde, 0x77, 
-	0xdf, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xff, 0x7b, 0xde, 0x77, 0xff, 0x7b, 0xd1, 0x31, 0xfe, 0x56, 
-	0xbf, 0x52, 0x5f, 0x46, 0x56, 0x25, 0xdc, 0x5a, 0x5e, 0x6b, 0x3b, 0x63, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x7c, 0x6b, 
-	0xef, 0x39, 0xbc, 0x6f, 0x52, 0x42, 0x29, 0x21, 0x5a, 0x67, 0xbd, 0x73, 0x7b, 0x67, 0x5a, 0x63, 
-	0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xb6, 0x52, 0x7c, 0x6b, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xdd, 0x73, 
-	0xdd, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x5a, 0x67, 0x90, 0x25, 
-	0xde, 0x4a, 0x9e, 0x42, 0x7f, 0x36, 0xfe, 0x2d, 0x7f, 0x25, 0x3e, 0x21, 0x1c, 0x1d, 0x13, 0x00, 
-	0x9c, 0x14, 0x39, 0x08, 0x58, 0x0c, 0x59, 0x10, 0x31, 0x08, 0x2c, 0x00, 0x93, 0x2d, 0x35, 0x42, 
-	0xf9, 0x5a, 0x9f, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xdd, 0x73, 0x39, 0x63, 0x31, 0x42, 0x6a, 0x29, 0x49, 0x21, 0xcd, 0x31, 0x49, 0x21, 
-	0xb5, 0x52, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x18, 0x5f, 0x6b, 0x29, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x5a, 0x63, 
-	0xb7, 0x52, 0x96, 0x4a, 0xd7, 0x56, 0xbd, 0x73, 0xdf, 0x77, 0x19, 0x63, 0xfa, 0x52, 0xff, 0x52, 
-	0xbf, 0x4e, 0x5f, 0x4a, 0x7b, 0x2d, 0x59, 0x2d, 0xd4, 0x1c, 0xad, 0x14, 0x9e, 0x6f, 0xbf, 0x77, 
-	0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x7b, 0x11, 0x42, 
-	0x5a, 0x67, 0x39, 0x5f, 0xcd, 0x31, 0x8b, 0x29, 0x9c, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xd6, 0x52, 
-	0xde, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x6f, 0x7b, 0x67, 0xb5, 0x4e, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xd8, 0x52, 0xfd, 0x4e, 
-	0x1f, 0x53, 0xdf, 0x4a, 0x7f, 0x3a, 0x1f, 0x36, 0x7f, 0x29, 0x9e, 0x2d, 0x75, 0x08, 0x98, 0x14, 
-	0x37, 0x0c, 0x9b, 0x14, 0x56, 0x08, 0x11, 0x00, 0x34, 0x08, 0x7b, 0x10, 0x3c, 0x0c, 0x3a, 0x08, 
-	0x14, 0x04, 0x0c, 0x00, 0x1c, 0x63, 0xbf, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbc, 0x6f, 0xde, 0x6f, 0xb9, 0x52, 0xa8, 0x10, 0xcd, 0x31, 0xee, 0x35, 0x52, 0x46, 0x10, 0x3e, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xbf, 0x73, 0x7d, 0x6b, 0xbf, 0x73, 
-	0xdf, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0x7c, 0x6b, 0x31, 0x42, 0xce, 0x35, 0x31, 0x42, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xd8, 0x52, 
-	0xbf, 0x6f, 0x9e, 0x6b, 0x9d, 0x6b, 0x54, 0x46, 0xbd, 0x73, 0x1a, 0x5b, 0x7f, 0x63, 0x1f, 0x57, 
-	0x9f, 0x4e, 0x5f, 0x46, 0x1f, 0x42, 0x1f, 0x46, 0x5f, 0x31, 0xb8, 0x1c, 0x79, 0x4e, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x39, 0x63, 0x95, 0x4e, 
-	0x9b, 0x6b, 0x93, 0x4a, 0xcd, 0x31, 0xce, 0x35, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0x3a, 0x63, 
-	0x39, 0x5f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0x39, 0x5f, 0x7c, 0x6b, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x34, 0x3e, 0xfd, 0x4e, 
-	0x3f, 0x57, 0x9d, 0x42, 0xbf, 0x42, 0x5f, 0x3a, 0x7b, 0x25, 0xd6, 0x14, 0x1c, 0x1d, 0x58, 0x0c, 
-	0x96, 0x10, 0x9a, 0x14, 0x17, 0x04, 0x59, 0x08, 0x3c, 0x0c, 0x3c, 0x0c, 0x5c, 0x08, 0x3c, 0x04, 
-	0x1b, 0x04, 0x79, 0x10, 0x10, 0x21, 0xdf, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x6f, 0x50, 0x25, 0x2f, 0x08, 0x2b, 0x04, 0x0a, 0x1d, 0x8d, 0x2d, 0x4a, 0x21, 0x39, 0x63, 
-	0xde, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 
-	0xde, 0x73, 0xdf, 0x77, 0xde, 0x77, 0x9d, 0x6f, 0xd5, 0x39, 0x55, 0x0c, 0x55, 0x0c, 0x73, 0x10, 
-	0xb4, 0x31, 0x5d, 0x67, 0xde, 0x77, 0x9c, 0x6f, 0x08, 0x1d, 0xac, 0x31, 0xd6, 0x56, 0xdf, 0x77, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0x54, 0x42, 0x76, 0x46, 
-	0xbf, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xdf, 0x73, 0x97, 0x4a, 0x70, 0x25, 0x5f, 0x63, 0xff, 0x56, 
-	0x9f, 0x4a, 0x7f, 0x4a, 0x1f, 0x42, 0x3f, 0x46, 0x7f, 0x35, 0x1d, 0x2d, 0x93, 0x31, 0xdf, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xde, 0x77, 0x8d, 0x2d, 0xbd, 0x6f, 
-	0x59, 0x63, 0xcc, 0x31, 0xcc, 0x31, 0xd6, 0x56, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xde, 0x73, 0x18, 0x5b, 0x7b, 0x6b, 0xde, 0x73, 
-	0xde, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0x98, 0x4a, 
-	0x1e, 0x57, 0x7a, 0x42, 0xb7, 0x25, 0xba, 0x25, 0xbb, 0x31, 0x3a, 0x21, 0xfc, 0x18, 0xdb, 0x18, 
-	0x95, 0x10, 0x13, 0x00, 0x7c, 0x10, 0x5d, 0x0c, 0x1c, 0x08, 0x5d, 0x0c, 0x5d, 0x08, 0x5d, 0x08, 
-	0x5e, 0x0c, 0x7b, 0x0c, 0x73, 0x0c, 0x1c, 0x5f, 0xdd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x6f, 
-	0x2e, 0x25, 0x31, 0x08, 0x13, 0x04, 0x32, 0x08, 0x30, 0x04, 0x2c, 0x08, 0x1a, 0x63, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x77, 0xde, 0x77, 0x3b, 0x5f, 0x59, 0x3e, 0x38, 0x36, 0x59, 0x3a, 0xfc, 0x52, 
-	0xdf, 0x73, 0xde, 0x7b, 0x9e, 0x6f, 0xb4, 0x14, 0xfe, 0x1c, 0xbe, 0x14, 0xde, 0x1c, 0x3f, 0x29, 
-	0x99, 0x14, 0x32, 0x08, 0x37, 0x46, 0xbe, 0x73, 0xd6, 0x56, 0x7b, 0x6b, 0xde, 0x77, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xdf, 0x7b, 0x53, 0x42, 0x1a, 0x5f, 0x7e, 0x67, 
-	0xbf, 0x6f, 0xbe, 0x73, 0xbf, 0x6f, 0x7f, 0x67, 0x7e, 0x63, 0x58, 0x42, 0x3f, 0x5f, 0xdf, 0x52, 
-	0x9f, 0x4e, 0x7f, 0x4a, 0x3f, 0x46, 0x5f, 0x46, 0x9f, 0x35, 0x5f, 0x35, 0x12, 0x21, 0xff, 0x7b, 
-	0xbe, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xd6, 0x56, 0xd7, 0x56, 0x7b, 0x67, 
-	0x93, 0x4a, 0x30, 0x3e, 0x6a, 0x25, 0x9c, 0x6f, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x6f, 0xde, 0x73, 
-	0xbd, 0x73, 0x32, 0x42, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0x19, 0x5f, 0x7b, 0x67, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdd, 0x77, 0xdd, 0x73, 0x9d, 0x6b, 
-	0x0d, 0x15, 0xbc, 0x46, 0x9f, 0x42, 0x1f, 0x32, 0xbf, 0x2d, 0x3a, 0x25, 0xd9, 0x18, 0x7b, 0x10, 
-	0x7a, 0x10, 0x9b, 0x14, 0x3c, 0x08, 0x5d, 0x08, 0x1d, 0x04, 0x5e, 0x0c, 0x7d, 0x10, 0x3c, 0x08, 
-	0x1c, 0x08, 0x7a, 0x10, 0x11, 0x04, 0x9f, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xfa, 0x5a, 
-	0x4d, 0x08, 0x11, 0x00, 0x32, 0x04, 0x54, 0x08, 0x73, 0x10, 0xf3, 0x3d, 0xdf, 0x7b, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xb7, 0x4e, 0x3d, 0x5b, 0x1e, 0x53, 0x7e, 0x3a, 0x9f, 0x3e, 0xdb, 0x29, 
-	0x53, 0x29, 0xdf, 0x77, 0xb4, 0x31, 0x5e, 0x29, 0xdf, 0x18, 0xbf, 0x18, 0x9e, 0x14, 0x7d, 0x10, 
-	0x7c, 0x10, 0x9a, 0x14, 0x52, 0x08, 0xda, 0x56, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0x9c, 0x6f, 0x5b, 0x67, 0x9e, 0x6f, 0x9f, 0x6b, 
-	0xbf, 0x6f, 0xdf, 0x73, 0xbf, 0x6f, 0x9f, 0x67, 0x7f, 0x67, 0xf5, 0x35, 0x7f, 0x63, 0x3f, 0x5f, 
-	0xbf, 0x52, 0x5f, 0x46, 0xdf, 0x3d, 0xff, 0x41, 0x1f, 0x29, 0xff, 0x28, 0x97, 0x31, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x8b, 0x29, 0xbc, 0x6f, 0x51, 0x42, 
-	0x30, 0x3e, 0xee, 0x35, 0x52, 0x46, 0xdf, 0x7b, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x9c, 0x6b, 0x52, 0x46, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0x18, 0x5b, 
-	0xf8, 0x5a, 0xdf, 0x77, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x73, 
-	0xb7, 0x46, 0x1e, 0x4f, 0xdf, 0x46, 0x5f, 0x3a, 0x7e, 0x25, 0xfa, 0x18, 0x3d, 0x25, 0x11, 0x00, 
-	0x77, 0x0c, 0x9f, 0x18, 0x38, 0x08, 0x9a, 0x10, 0x3c, 0x08, 0x5c, 0x04, 0x5d, 0x0c, 0x3d, 0x0c, 
-	0x5d, 0x10, 0x55, 0x08, 0x30, 0x21, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x74, 0x4a, 
-	0x2d, 0x04, 0x11, 0x00, 0x10, 0x00, 0x51, 0x08, 0x2b, 0x04, 0x7d, 0x6f, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0x5b, 0x63, 0xfb, 0x4e, 0x5e, 0x57, 0x3c, 0x53, 0x1f, 0x4f, 0x9e, 0x3e, 0x5e, 0x3a, 
-	0x99, 0x29, 0x77, 0x4a, 0x79, 0x2d, 0x5f, 0x29, 0xfe, 0x1c, 0x5c, 0x0c, 0x7d, 0x10, 0x7d, 0x10, 
-	0x5c, 0x0c, 0xde, 0x1c, 0x57, 0x0c, 0xef, 0x1c, 0xdf, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x9c, 0x6f, 0x7c, 0x6b, 0x9e, 0x6b, 0x9e, 0x6b, 
-	0xbe, 0x6f, 0xbe, 0x6f, 0xbf, 0x6f, 0x7f, 0x67, 0x5f, 0x63, 0x6f, 0x25, 0x7f, 0x63, 0x1f, 0x5b, 
-	0xbf, 0x4e, 0x5f, 0x46, 0x5f, 0x4a, 0x7f, 0x4e, 0x1e, 0x29, 0x1b, 0x29, 0xf2, 0x20, 0xfb, 0x5e, 
-	0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x94, 0x4e, 0x18, 0x5f, 0x17, 0x5b, 0x0f, 0x3a, 
-	0x51, 0x42, 0x8c, 0x2d, 0x9d, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0x5a, 0x67, 0x74, 0x4a, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xde, 0x73, 
-	0x7b, 0x67, 0xb5, 0x4e, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xdd, 0x77, 0xde, 0x73, 
-	0xfb, 0x4e, 0x1f, 0x4f, 0xbf, 0x42, 0x1e, 0x32, 0x1f, 0x36, 0x93, 0x08, 0x93, 0x08, 0x97, 0x10, 
-	0x9d, 0x14, 0xbe, 0x18, 0x32, 0x04, 0x51, 0x08, 0x5a, 0x0c, 0x3d, 0x0c, 0x3c, 0x08, 0x5c, 0x0c, 
-	0x5c, 0x10, 0x98, 0x14, 0xf5, 0x3d, 0xbf, 0x73, 0x9e, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0x5c, 0x67, 
-	0x4c, 0x08, 0x11, 0x04, 0x11, 0x04, 0x4d, 0x04, 0xd9, 0x5a, 0xbe, 0x77, 0xdf, 0x77, 0xdf, 0x77, 
-	0xbe, 0x73, 0xaf, 0x29, 0x7e, 0x5b, 0x5e, 0x57, 0x3e, 0x57, 0xdf, 0x4a, 0xbf, 0x42, 0x7f, 0x3a, 
-	0xde, 0x2d, 0xb4, 0x0c, 0xfb, 0x1c, 0xdf, 0x1c, 0x9e, 0x14, 0x7e, 0x10, 0xdf, 0x1c, 0x7d, 0x10, 
-	0x7d, 0x10, 0x5c, 0x0c, 0x39, 0x0c, 0x0d, 0x00, 0x19, 0x5f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xf7, 0x56, 0x9d, 0x6f, 0x9e, 0x6f, 
-	0xbe, 0x6f, 0xbf, 0x73, 0x7d, 0x67, 0xb9, 0x4e, 0xda, 0x52, 0x50, 0x25, 0x3f, 0x5f, 0xbe, 0x4e, 
-	0x7e, 0x46, 0x7f, 0x4a, 0x3d, 0x46, 0x38, 0x29, 0xd7, 0x1c, 0x31, 0x08, 0xb8, 0x1c, 0x99, 0x18, 
-	0xd1, 0x18, 0x5d, 0x67, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x10, 0x3e, 0x7b, 0x6b, 0x0e, 0x3a, 0x8b, 0x2d, 
-	0x8c, 0x2d, 0x7c, 0x6b, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0x7c, 0x6b, 0x32, 0x42, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0x9c, 0x6b, 0xcf, 0x35, 0x18, 0x5b, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0x7d, 0x6b, 
-	0xfc, 0x52, 0x1f, 0x4f, 0x1f, 0x4f, 0xbf, 0x42, 0x1b, 0x32, 0x16, 0x1d, 0x5f, 0x25, 0xdf, 0x18, 
-	0xbf, 0x18, 0x7e, 0x10, 0x5d, 0x10, 0x55, 0x0c, 0x0f, 0x00, 0x9a, 0x14, 0x5a, 0x0c, 0x5b, 0x0c, 
-	0xbc, 0x18, 0x93, 0x14, 0xfc, 0x5e, 0xbf, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 
-	0x7c, 0x67, 0x96, 0x4e, 0x96, 0x4e, 0xbd, 0x6f, 0xdd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0x76, 0x42, 0x5d, 0x5b, 0x3d, 0x57, 0x5e, 0x57, 0xfd, 0x4a, 0x3f, 0x53, 0xdd, 0x46, 0x5c, 0x36, 
-	0xdc, 0x29, 0x79, 0x25, 0x7e, 0x21, 0xdf, 0x14, 0xdf, 0x1c, 0x9d, 0x10, 0x5d, 0x0c, 0x7d, 0x10, 
-	0x7c, 0x10, 0x7b, 0x0c, 0x78, 0x10, 0x38, 0x46, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0x52, 0x46, 0x9d, 0x6f, 0x9e, 0x6f, 
-	0xbf, 0x73, 0xbf, 0x73, 0x3b, 0x5f, 0xd2, 0x31, 0x35, 0x3e, 0x99, 0x4a, 0x78, 0x46, 0xd7, 0x31, 
-	0x9f, 0x4a, 0xd9, 0x35, 0x58, 0x29, 0x5d, 0x31, 0x98, 0x18, 0x9a, 0x18, 0xbf, 0x20, 0x9f, 0x1c, 
-	0x9c, 0x18, 0xb4, 0x14, 0xfd, 0x5e, 0xbf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xef, 0x39, 0x5a, 0x67, 0x72, 0x46, 0xac, 0x2d, 0x6b, 0x29, 
-	0x9c, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x52, 0x42, 0x39, 0x63, 0xde, 0x77, 
-	0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0x7b, 0x67, 0xd6, 0x52, 0x7c, 0x6b, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x9d, 0x6f, 
-	0x8e, 0x25, 0x36, 0x3a, 0x99, 0x46, 0xd6, 0x2d, 0x11, 0x19, 0x7d, 0x25, 0x9f, 0x25, 0x1d, 0x15, 
-	0x9e, 0x10, 0x9e, 0x10, 0x9e, 0x10, 0x7d, 0x14, 0x34, 0x08, 0xd2, 0x14, 0xf6, 0x1c, 0x74, 0x0c, 
-	0x34, 0x21, 0x3c, 0x63, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0x9e, 0x6f, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0x5b, 0x67, 
-	0xda, 0x4e, 0x5e, 0x5b, 0x5e, 0x5b, 0x3e, 0x57, 0x3e, 0x53, 0x3e, 0x57, 0xdd, 0x4a, 0x96, 0x21, 
-	0x1f, 0x36, 0xff, 0x2d, 0xff, 0x31, 0xbe, 0x14, 0x9f, 0x14, 0x5d, 0x0c, 0x7e, 0x0c, 0x7e, 0x0c, 
-	0x7d, 0x10, 0x5a, 0x0c, 0x71, 0x08, 0x9e, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0x7b, 0x6b, 0x95, 0x4e, 0xbe, 0x73, 
-	0xbf, 0x73, 0xbe, 0x73, 0x9e, 0x6f, 0xd8, 0x52, 0x4e, 0x21, 0xbb, 0x4e, 0x72, 0x29, 0x9d, 0x4a, 
-	0x3d, 0x42, 0xd3, 0x14, 0xb7, 0x31, 0xb4, 0x14, 0xdd, 0x24, 0xbf, 0x24, 0x9f, 0x20, 0xbf, 0x1c, 
-	0x5f, 0x14, 0x9c, 0x18, 0x90, 0x10, 0x9e, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0x74, 0x4a, 0x18, 0x5f, 0x5a, 0x67, 0x6b, 0x29, 0x73, 0x4a, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x77, 0x39, 0x5f, 0x10, 0x3a, 
-	0x18, 0x5b, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xff, 0x77, 0x11, 0x3e, 0x7c, 0x6b, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xff, 0x7b, 0x7c, 0x6f, 0x7b, 0x6b, 0x9d, 0x6f, 0xd7, 0x31, 0xde, 0x2d, 0xff, 0x31, 0x7f, 0x25, 
-	0x9d, 0x10, 0xbe, 0x14, 0x9e, 0x10, 0x5e, 0x0c, 0x9a, 0x14, 0xb3, 0x14, 0x3f, 0x63, 0x7d, 0x67, 
-	0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xbd, 0x73, 
-	0x7d, 0x63, 0x5e, 0x5b, 0x5e, 0x5b, 0x3e, 0x57, 0x3e, 0x53, 0x30, 0x15, 0x7b, 0x3a, 0xfb, 0x2d, 
-	0xbe, 0x29, 0xbb, 0x2d, 0xb7, 0x0c, 0x1f, 0x1d, 0xbe, 0x14, 0x7c, 0x0c, 0x7d, 0x0c, 0x5c, 0x08, 
-	0x9e, 0x14, 0x1a, 0x04, 0x76, 0x0c, 0xba, 0x56, 0xbf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 0xde, 0x7b, 0x5b, 0x67, 0xb6, 0x52, 
-	0xbd, 0x6f, 0xdf, 0x73, 0x9e, 0x6f, 0x97, 0x4a, 0x98, 0x4a, 0x7b, 0x46, 0xd4, 0x2d, 0x11, 0x1d, 
-	0x1c, 0x42, 0xdb, 0x39, 0xfb, 0x41, 0x9f, 0x39, 0xdf, 0x24, 0x7f, 0x1c, 0x9f, 0x20, 0x9f, 0x1c, 
-	0x5f, 0x18, 0xba, 0x1c, 0x6c, 0x0c, 0x9e, 0x73, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xdf, 0x77, 0xd6, 0x56, 0xad, 0x31, 0x73, 0x4a, 0x31, 0x42, 0x7b, 0x6b, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xf8, 0x5a, 0xf0, 0x39, 0x94, 0x4a, 0x18, 0x5f, 0x5b, 0x67, 0x18, 0x5f, 0x53, 0x46, 0xae, 0x31, 
-	0x6b, 0x29, 0x32, 0x42, 0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0x38, 0x63, 0x3a, 0x36, 0xde, 0x29, 0x9e, 0x29, 0x7f, 0x29, 
-	0x1f, 0x21, 0xbe, 0x18, 0xff, 0x20, 0x7d, 0x10, 0xbd, 0x14, 0x33, 0x04, 0x3e, 0x67, 0xbb, 0x6f, 
-	0xbe, 0x73, 0x9f, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xde, 0x73, 0xbf, 0x73, 0xdf, 0x73, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0x54, 0x42, 0x3b, 0x57, 0x5e, 0x5b, 0x5e, 0x57, 0xfd, 0x4a, 0x3e, 0x53, 0x7c, 0x3a, 0x5f, 0x36, 
-	0x9d, 0x25, 0x17, 0x19, 0x5e, 0x21, 0x1f, 0x19, 0x3e, 0x21, 0x7b, 0x0c, 0x9e, 0x14, 0xbd, 0x10, 
-	0xdf, 0x18, 0x5c, 0x0c, 0x96, 0x10, 0x98, 0x4e, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 0xff, 0x7b, 0xde, 0x77, 
-	0xef, 0x39, 0xf8, 0x5a, 0xb7, 0x52, 0x97, 0x4a, 0x59, 0x42, 0x58, 0x3e, 0x17, 0x3a, 0xdf, 0x56, 
-	0x1d, 0x3e, 0x5f, 0x46, 0xdf, 0x3d, 0x9f, 0x39, 0xbf, 0x20, 0x9f, 0x1c, 0x7f, 0x1c, 0x9f, 0x1c, 
-	0x9e, 0x18, 0x76, 0x10, 0x16, 0x3e, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7b, 0x6b, 
-	0x10, 0x3e, 0x09, 0x1d, 0x94, 0x4e, 0x7c, 0x6b, 0xff, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0x7b, 0x6b, 0x39, 0x63, 0x5a, 0x63, 0x7b, 0x67, 0x9c, 0x6f, 
-	0xde, 0x73, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0x5a, 0x67, 0x30, 0x1d, 0x7a, 0x25, 0x9f, 0x25, 0xff, 0x31, 
-	0x7f, 0x25, 0x9e, 0x14, 0xff, 0x20, 0xbd, 0x14, 0xdc, 0x1c, 0x10, 0x04, 0x7f, 0x6b, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x7b, 
-	0x95, 0x4e, 0xb7, 0x46, 0x7e, 0x5f, 0x3e, 0x57, 0x5e, 0x57, 0xd3, 0x2d, 0x5a, 0x3a, 0x1c, 0x32, 
-	0xbc, 0x2d, 0x59, 0x1d, 0xbe, 0x2d, 0x5f, 0x25, 0x32, 0x04, 0x73, 0x10, 0x7c, 0x14, 0x7e, 0x10, 
-	0x3a, 0x04, 0x78, 0x10, 0x71, 0x2d, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xde, 0x77, 0xbd, 0x73, 0x53, 0x46, 0x75, 0x4a, 
-	0x1a, 0x5f, 0x19, 0x5b, 0x75, 0x46, 0x70, 0x25, 0xda, 0x4e, 0xd4, 0x29, 0x78, 0x46, 0xcd, 0x10, 
-	0x4c, 0x04, 0xde, 0x3d, 0xdf, 0x45, 0xff, 0x24, 0xbf, 0x20, 0xbf, 0x20, 0x9f, 0x1c, 0x9f, 0x1c, 
-	0x7a, 0x18, 0x73, 0x10, 0x99, 0x52, 0xdf, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x18, 0x5b, 
-	0x7b, 0x6b, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x77, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xbd, 0x6f, 0xaf, 0x2d, 0x90, 0x25, 0xd2, 0x31, 0x5d, 0x67, 0xdf, 0x77, 
-	0x5b, 0x67, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xf0, 0x35, 0x3f, 0x5f, 0x7b, 0x25, 0xbf, 0x2d, 
-	0x7f, 0x25, 0x5e, 0x25, 0xdd, 0x18, 0xfe, 0x20, 0xd8, 0x18, 0x57, 0x46, 0xbf, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xdf, 0x7b, 
-	0xd0, 0x31, 0x9e, 0x63, 0x5e, 0x5b, 0x3d, 0x57, 0x5f, 0x57, 0xfd, 0x4a, 0xff, 0x4e, 0x5c, 0x3a, 
-	0x98, 0x29, 0x78, 0x25, 0xfa, 0x14, 0xde, 0x18, 0xbc, 0x18, 0x74, 0x0c, 0x0e, 0x00, 0x0a, 0x00, 
-	0xda, 0x56, 0xf9, 0x5a, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0x11, 0x3e, 0x9c, 0x6b, 0x9e, 0x6f, 
-	0xbf, 0x6f, 0xbf, 0x6f, 0xbf, 0x6f, 0x77, 0x46, 0xfd, 0x56, 0xcd, 0x0c, 0x9c, 0x4a, 0x7c, 0x4a, 
-	0x14, 0x21, 0x79, 0x31, 0xdf, 0x45, 0x3f, 0x31, 0xbf, 0x20, 0x9f, 0x20, 0x7f, 0x18, 0x9e, 0x1c, 
-	0x11, 0x04, 0x2e, 0x08, 0x78, 0x4e, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbf, 0x73, 0xdf, 0x77, 
-	0xde, 0x77, 0xff, 0x7b, 0x74, 0x46, 0xdb, 0x4e, 0xdd, 0x4a, 0x9b, 0x42, 0x2e, 0x19, 0x16, 0x3a, 
-	0xad, 0x10, 0x58, 0x42, 0x1d, 0x5f, 0xbf, 0x73, 0xdd, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0x1e, 0x5f, 0x7a, 0x29, 
-	0x7c, 0x25, 0x5d, 0x29, 0x1c, 0x21, 0xb7, 0x18, 0x57, 0x46, 0xdf, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 
-	0xde, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xbf, 0x73, 
-	0x3c, 0x5f, 0x5d, 0x5b, 0x7e, 0x5b, 0x5e, 0x5b, 0x3e, 0x53, 0x3f, 0x53, 0x1f, 0x4f, 0xdf, 0x46, 
-	0x14, 0x15, 0x58, 0x1d, 0x5e, 0x21, 0xfe, 0x18, 0xff, 0x1c, 0x7d, 0x10, 0x7d, 0x14, 0x76, 0x10, 
-	0x56, 0x46, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xdf, 0x7b, 0xff, 0x7b, 0x74, 0x4a, 0x9d, 0x6f, 0x9d, 0x6f, 0xbe, 0x73, 
-	0x9d, 0x6b, 0xde, 0x73, 0x9e, 0x6b, 0xbf, 0x6f, 0x5f, 0x5f, 0x3e, 0x5b, 0x9b, 0x46, 0x1c, 0x3e, 
-	0x13, 0x1d, 0xaf, 0x14, 0x9d, 0x39, 0x3f, 0x31, 0xbf, 0x24, 0x9f, 0x24, 0x9f, 0x20, 0x9f, 0x20, 
-	0x9d, 0x1c, 0x96, 0x18, 0x98, 0x52, 0xdf, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0x55, 0x42, 0x3f, 0x57, 0xbe, 0x42, 0xdf, 0x46, 0x30, 0x11, 0x7e, 0x46, 
-	0xdd, 0x2d, 0x9d, 0x29, 0xf8, 0x18, 0xdc, 0x56, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x6f, 0x9f, 0x6f, 
-	0x77, 0x4a, 0x8e, 0x10, 0xd5, 0x35, 0x1b, 0x5f, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0x9d, 0x6f, 
-	0x9d, 0x63, 0x5c, 0x5b, 0x5c, 0x5b, 0x3d, 0x57, 0x1c, 0x53, 0xbc, 0x46, 0xde, 0x46, 0x7f, 0x3a, 
-	0xfe, 0x2d, 0xbe, 0x29, 0x5f, 0x21, 0x1f, 0x21, 0xff, 0x1c, 0x7e, 0x0c, 0x7d, 0x10, 0x7d, 0x0c, 
-	0x75, 0x0c, 0x1b, 0x5f, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0x32, 0x42, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xb7, 0x4e, 0x98, 0x4a, 0xb9, 0x4a, 0x5f, 0x5f, 0xbf, 0x4e, 
-	0xb9, 0x31, 0x8f, 0x0c, 0xb0, 0x14, 0x9e, 0x39, 0xff, 0x2c, 0xdf, 0x24, 0xbf, 0x20, 0xbf, 0x1c, 
-	0xbe, 0x1c, 0x73, 0x10, 0x1b, 0x5f, 0xdf, 0x77, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xfe, 0x7b, 0xfe, 0x7b, 0xd0, 0x31, 0x5e, 0x57, 0xde, 0x46, 0xff, 0x4a, 0x7d, 0x3a, 0x1e, 0x32, 
-	0x1f, 0x32, 0x9e, 0x21, 0x9e, 0x2d, 0x35, 0x21, 0xbf, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbd, 0x6f, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0x9d, 0x6f, 
-	0x32, 0x3e, 0x19, 0x57, 0x3b, 0x5f, 0x3c, 0x57, 0x56, 0x3a, 0x3f, 0x57, 0xff, 0x4a, 0x5e, 0x32, 
-	0xff, 0x25, 0xbf, 0x25, 0x7f, 0x25, 0x5f, 0x25, 0xff, 0x18, 0xbf, 0x14, 0x7d, 0x0c, 0xdf, 0x18, 
-	0x9a, 0x10, 0x12, 0x21, 0x9f, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x7b, 0xde, 0x77, 0xbd, 0x73, 0xcf, 0x35, 0x11, 0x3e, 0x53, 0x46, 0x9d, 0x6b, 
-	0xbf, 0x73, 0xbe, 0x6f, 0xbf, 0x73, 0x14, 0x3a, 0xd3, 0x31, 0x5d, 0x5f, 0x1f, 0x57, 0xbf, 0x52, 
-	0x7f, 0x4a, 0xba, 0x31, 0x8e, 0x0c, 0x1a, 0x42, 0x99, 0x1c, 0xbe, 0x24, 0xdf, 0x24, 0xbd, 0x20, 
-	0xd8, 0x20, 0x13, 0x3e, 0xff, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xff, 0x7b, 0xde, 0x7b, 0xd7, 0x56, 0x5e, 0x5f, 0x3f, 0x53, 0xdf, 0x42, 0x7e, 0x3a, 0x7f, 0x3e, 
-	0x1f, 0x32, 0x3f, 0x3a, 0xbd, 0x31, 0x91, 0x10, 0xbf, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xbf, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0xff, 0x7b, 0xbd, 0x73, 0x5b, 0x67, 0x3c, 0x5b, 0x5f, 0x5b, 0x3f, 0x57, 0x1e, 0x4f, 0xdf, 0x42, 
-	0x5e, 0x32, 0x5f, 0x36, 0xdf, 0x29, 0x5f, 0x1d, 0x1f, 0x1d, 0x9e, 0x10, 0xbf, 0x18, 0x9d, 0x10, 
-	0xbb, 0x14, 0x12, 0x04, 0x3f, 0x67, 0xdd, 0x73, 0xdc, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7c, 0x6f, 0x3a, 0x63, 0xd7, 0x56, 0xde, 0x73, 
-	0x9d, 0x6b, 0xbe, 0x6f, 0x7d, 0x6b, 0x57, 0x42, 0xf3, 0x31, 0x9f, 0x6b, 0xdf, 0x52, 0x9f, 0x4e, 
-	0x7f, 0x4a, 0x5f, 0x46, 0xf5, 0x1c, 0xbb, 0x52, 0x3b, 0x5f, 0x77, 0x4a, 0x10, 0x21, 0x91, 0x2d, 
-	0xd9, 0x56, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xd6, 0x52, 0x53, 0x42, 
-	0xb6, 0x4e, 0x39, 0x63, 0x7b, 0x67, 0xd8, 0x4e, 0x3e, 0x57, 0xdf, 0x46, 0xbf, 0x42, 0xbd, 0x25, 
-	0x9f, 0x25, 0x3e, 0x21, 0xdb, 0x18, 0xaf, 0x14, 0x5d, 0x67, 0xd8, 0x56, 0x97, 0x4e, 0xd8, 0x56, 
-	0x1b, 0x63, 0xbf, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0x13, 0x3a, 0x3e, 0x57, 0x1e, 0x4f, 0x3f, 0x53, 0xff, 0x4a, 
-	0x3e, 0x2e, 0x99, 0x21, 0xdd, 0x2d, 0xdc, 0x0c, 0xff, 0x1c, 0xdf, 0x1c, 0xbd, 0x14, 0xbd, 0x14, 
-	0xbc, 0x14, 0xd2, 0x14, 0xdf, 0x73, 0x9e, 0x6f, 0xbf, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xef, 0x39, 0x9c, 0x6b, 
-	0x9e, 0x6f, 0xbe, 0x6f, 0x9e, 0x6b, 0xeb, 0x14, 0xba, 0x4e, 0x5f, 0x5b, 0x3f, 0x5b, 0x9f, 0x4a, 
-	0x3f, 0x46, 0xbe, 0x35, 0xbc, 0x31, 0xb4, 0x14, 0x5f, 0x6b, 0xdf, 0x7b, 0xdf, 0x7b, 0xfe, 0x7b, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x7b, 0x12, 0x3e, 0x3b, 0x5f, 0x9e, 0x63, 
-	0x7e, 0x63, 0xf9, 0x56, 0x75, 0x4a, 0x95, 0x46, 0x3c, 0x57, 0x3f, 0x53, 0x9f, 0x42, 0x7f, 0x3e, 
-	0xbf, 0x25, 0x3f, 0x21, 0xd9, 0x18, 0x4e, 0x08, 0x2f, 0x04, 0x77, 0x0c, 0x37, 0x08, 0x15, 0x04, 
-	0x31, 0x08, 0xce, 0x18, 0xfa, 0x5e, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x77, 
-	0xdf, 0x77, 0xde, 0x77, 0x9d, 0x6f, 0x5c, 0x63, 0x5e, 0x57, 0x3d, 0x53, 0x3e, 0x57, 0xff, 0x46, 
-	0x3e, 0x32, 0x77, 0x21, 0x5c, 0x3e, 0x5e, 0x25, 0x3f, 0x21, 0xde, 0x18, 0xbd, 0x14, 0xdd, 0x1c, 
-	0x74, 0x0c, 0x9a, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x5a, 0x6b, 0xf7, 0x56, 0xbe, 0x6f, 
-	0xbf, 0x6f, 0xbe, 0x6f, 0x3a, 0x5f, 0x90, 0x29, 0x5f, 0x5f, 0x3f, 0x5b, 0xff, 0x4e, 0x7f, 0x46, 
-	0xff, 0x41, 0xff, 0x41, 0x9d, 0x31, 0xb5, 0x14, 0x3f, 0x67, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0x8d, 0x29, 0x7c, 0x5f, 0x5d, 0x5b, 
-	0x7e, 0x63, 0x3c, 0x5b, 0x3c, 0x57, 0xb0, 0x29, 0xf4, 0x29, 0xbe, 0x46, 0x1f, 0x32, 0xbe, 0x21, 
-	0xbf, 0x29, 0xbf, 0x2d, 0x30, 0x04, 0x54, 0x0c, 0x7a, 0x0c, 0x7b, 0x0c, 0x5b, 0x08, 0x3c, 0x08, 
-	0x5b, 0x10, 0x79, 0x10, 0x0e, 0x00, 0x12, 0x3e, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0xbe, 0x6f, 0xbf, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xdf, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xdf, 0x77, 
-	0xdf, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0xfa, 0x52, 0x3e, 0x53, 0x5e, 0x57, 0x3d, 0x53, 0xfe, 0x4a, 
-	0xbf, 0x42, 0x76, 0x25, 0x3a, 0x3e, 0x5d, 0x25, 0x1f, 0x1d, 0x1b, 0x21, 0x90, 0x10, 0xae, 0x14, 
-	0x3c, 0x67, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7c, 0x6f, 0x11, 0x3e, 0xd9, 0x56, 
-	0xfb, 0x5a, 0xb7, 0x52, 0x6e, 0x29, 0x99, 0x4a, 0x5f, 0x63, 0x1e, 0x57, 0x9f, 0x4e, 0xff, 0x3d, 
-	0x1f, 0x42, 0x5f, 0x4e, 0xbd, 0x35, 0x70, 0x08, 0x5f, 0x6b, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0x6c, 0x29, 0x3b, 0x5b, 0x7d, 0x5f, 
-	0x9f, 0x67, 0x7e, 0x63, 0x7e, 0x5f, 0xd9, 0x4a, 0x30, 0x19, 0x5b, 0x36, 0xbf, 0x42, 0x7f, 0x3e, 
-	0xfd, 0x2d, 0xf2, 0x18, 0x2f, 0x04, 0xdb, 0x18, 0x3d, 0x08, 0x7e, 0x10, 0x9e, 0x14, 0x5d, 0x08, 
-	0x5e, 0x0c, 0x5d, 0x10, 0x9a, 0x14, 0xf2, 0x1c, 0x9f, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbc, 0x6f, 0x9d, 0x6b, 0x54, 0x46, 0x29, 0x00, 0xad, 0x10, 0x14, 0x3e, 
-	0x1a, 0x5f, 0xbd, 0x6f, 0xbc, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xdf, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xf0, 0x35, 0x3d, 0x57, 0xfb, 0x4a, 0xdd, 0x46, 0x1f, 0x4b, 
-	0xbd, 0x46, 0xda, 0x52, 0x5c, 0x63, 0xdb, 0x31, 0x7d, 0x29, 0x35, 0x25, 0x77, 0x4e, 0xbf, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7b, 0x6b, 0xf8, 0x5a, 
-	0x19, 0x5f, 0x39, 0x63, 0xbd, 0x6f, 0x98, 0x4a, 0x5f, 0x5f, 0x5f, 0x5f, 0x9f, 0x4e, 0xff, 0x41, 
-	0x1f, 0x42, 0xdf, 0x3d, 0x3a, 0x25, 0x94, 0x2d, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0x53, 0x46, 0xd7, 0x52, 0x7d, 0x63, 0x9e, 0x67, 
-	0x9f, 0x6b, 0x7e, 0x63, 0x9f, 0x63, 0x5e, 0x5b, 0xf5, 0x31, 0x1c, 0x36, 0x9f, 0x42, 0x1a, 0x32, 
-	0xdb, 0x29, 0x59, 0x21, 0xf8, 0x18, 0x5f, 0x25, 0xff, 0x1c, 0xbf, 0x18, 0x9e, 0x10, 0x5e, 0x0c, 
-	0x7e, 0x10, 0x9c, 0x10, 0x0e, 0x00, 0xfb, 0x5e, 0xdf, 0x77, 0xdf, 0x7b, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xd3, 0x35, 0x51, 0x08, 0x54, 0x08, 0x55, 0x0c, 0x51, 0x0c, 
-	0xcd, 0x18, 0x19, 0x5f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x77, 0x13, 0x3a, 0x98, 0x46, 0xda, 0x4a, 0x77, 0x3e, 
-	0x96, 0x4a, 0xde, 0x77, 0xfe, 0x77, 0x3c, 0x63, 0xba, 0x52, 0x3d, 0x63, 0xbe, 0x73, 0x9d, 0x6f, 
-	0xbd, 0x6f, 0x7b, 0x67, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdd, 0x77, 0xdd, 0x77, 0xde, 0x77, 0x98, 0x4a, 0x1e, 0x57, 0xde, 0x4e, 0xdf, 0x52, 0x3f, 0x46, 
-	0x1f, 0x46, 0x7e, 0x31, 0xf5, 0x20, 0x1b, 0x63, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x39, 0x63, 0x18, 0x5f, 0x7c, 0x63, 0x7d, 0x63, 0x7e, 0x63, 
-	0x9e, 0x67, 0x7e, 0x63, 0x9e, 0x63, 0x7f, 0x5f, 0x9f, 0x5f, 0x99, 0x42, 0xb6, 0x25, 0x96, 0x29, 
-	0x5c, 0x3e, 0x39, 0x19, 0x9f, 0x2d, 0xde, 0x14, 0xff, 0x1c, 0xbf, 0x18, 0x9f, 0x14, 0x9f, 0x14, 
-	0x5f, 0x10, 0x5f, 0x10, 0x7a, 0x10, 0x94, 0x31, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0x4a, 0x04, 0x31, 0x08, 0x33, 0x00, 0x53, 0x08, 0x2d, 0x04, 
-	0x2a, 0x21, 0x89, 0x29, 0x07, 0x1d, 0x3a, 0x67, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0x7c, 0x6b, 0x9c, 0x6b, 0xbd, 0x73, 
-	0xbe, 0x77, 0xdf, 0x77, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbd, 0x73, 0xdd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xde, 0x73, 0xde, 0x77, 0x9d, 0x6f, 0x5a, 0x63, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdd, 0x77, 0xff, 0x7b, 0x55, 0x46, 0x7a, 0x46, 0x7c, 0x46, 0x33, 0x21, 0x58, 0x29, 
-	0x5a, 0x2d, 0xd3, 0x18, 0x77, 0x4a, 0xbf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x5a, 0x67, 0xd7, 0x52, 0x7d, 0x63, 0x9e, 0x63, 0x7e, 0x5f, 
-	0x7d, 0x5f, 0x7d, 0x5f, 0x7e, 0x63, 0x5d, 0x5f, 0x90, 0x25, 0x30, 0x19, 0xdd, 0x4e, 0xf8, 0x31, 
-	0xd7, 0x2d, 0x7d, 0x3e, 0xfe, 0x2d, 0x5f, 0x25, 0xbf, 0x18, 0x7e, 0x0c, 0xbf, 0x18, 0x7e, 0x10, 
-	0x7e, 0x10, 0x7f, 0x10, 0x9e, 0x14, 0x11, 0x00, 0x9f, 0x6f, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x53, 0x42, 0x2d, 0x04, 0x32, 0x08, 0x51, 0x08, 0x8a, 0x10, 
-	0xcf, 0x31, 0xaa, 0x2d, 0xec, 0x35, 0x06, 0x19, 0x7b, 0x6b, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xdf, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdd, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xdd, 0x73, 0xff, 0x77, 0x7c, 0x6b, 0x53, 0x46, 0x8c, 0x2d, 0xc6, 0x18, 0x63, 0x08, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdd, 0x77, 0xde, 0x7b, 0xbd, 0x77, 0xde, 0x77, 0xb5, 0x4e, 0x11, 0x3a, 0x1a, 0x5f, 0x96, 0x4e, 
-	0x34, 0x42, 0xf9, 0x5a, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x52, 0x46, 0xf9, 0x56, 0x7d, 0x63, 0x9f, 0x63, 
-	0x9e, 0x63, 0x9d, 0x63, 0x3b, 0x5b, 0x97, 0x46, 0x2c, 0x19, 0xf6, 0x35, 0xde, 0x4e, 0x58, 0x3a, 
-	0x31, 0x1d, 0x9b, 0x29, 0x59, 0x1d, 0xb9, 0x14, 0xbf, 0x14, 0xdf, 0x18, 0x9f, 0x10, 0x9f, 0x10, 
-	0x7e, 0x0c, 0x7e, 0x10, 0xbd, 0x14, 0x10, 0x00, 0x5e, 0x67, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xdd, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xf8, 0x56, 0x35, 0x3e, 0xb3, 0x31, 0x14, 0x3e, 
-	0xe9, 0x18, 0x31, 0x3e, 0xac, 0x2d, 0x68, 0x25, 0x8b, 0x2d, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xf7, 0x5a, 0xad, 0x31, 0x07, 0x1d, 0xc5, 0x14, 0xa5, 0x10, 0xe7, 0x1c, 0x29, 0x21, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x7b, 0xde, 0x7b, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xd6, 0x56, 0xd0, 0x31, 0x33, 0x3a, 
-	0x54, 0x3e, 0xd0, 0x2d, 0x4c, 0x21, 0x7c, 0x63, 0x1d, 0x57, 0xdb, 0x4a, 0x58, 0x3a, 0x9a, 0x46, 
-	0xb7, 0x29, 0x99, 0x25, 0x7c, 0x29, 0x52, 0x04, 0xda, 0x18, 0x9d, 0x14, 0x9e, 0x10, 0x7e, 0x0c, 
-	0x5e, 0x08, 0x7e, 0x14, 0x75, 0x10, 0xb9, 0x56, 0xdf, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbf, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0x9e, 0x6f, 
-	0x18, 0x5f, 0xef, 0x39, 0x51, 0x42, 0x31, 0x42, 0x6b, 0x29, 0x8c, 0x2d, 0x9c, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x9e, 0x6f, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x9c, 0x6b, 0x73, 0x46, 
-	0x8c, 0x29, 0x2a, 0x21, 0xe8, 0x18, 0x6b, 0x29, 0xf7, 0x5a, 0x18, 0x5f, 0x6b, 0x29, 0x8c, 0x31, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdd, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xbe, 0x77, 0xdd, 0x77, 0xde, 0x7b, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xbd, 0x73, 0x8e, 0x2d, 
-	0xf9, 0x56, 0x7c, 0x63, 0x7e, 0x67, 0x9f, 0x67, 0x5e, 0x5f, 0x5f, 0x57, 0x78, 0x42, 0x73, 0x25, 
-	0x5f, 0x3a, 0x5f, 0x3a, 0xde, 0x29, 0x5d, 0x21, 0x55, 0x08, 0x77, 0x10, 0x5b, 0x0c, 0x3c, 0x08, 
-	0x3a, 0x08, 0xd5, 0x14, 0xfb, 0x5a, 0xde, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0x39, 0x63, 0x53, 0x4a, 0xb5, 0x52, 0x8c, 0x2d, 0x94, 0x4e, 
-	0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x77, 0x9e, 0x73, 
-	0xbe, 0x73, 0xdf, 0x73, 0xbd, 0x6f, 0x18, 0x5f, 0x52, 0x46, 0x4a, 0x21, 0x0a, 0x1d, 0x73, 0x46, 
-	0x18, 0x5b, 0x5a, 0x67, 0x9c, 0x6f, 0xde, 0x77, 0x7b, 0x6b, 0x28, 0x21, 0x4a, 0x25, 0xd6, 0x56, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0x95, 0x4a, 0x9e, 0x6b, 
-	0x7c, 0x63, 0x7e, 0x63, 0x7e, 0x63, 0x7f, 0x5f, 0x5f, 0x5b, 0x5f, 0x5b, 0x3e, 0x53, 0x1e, 0x4b, 
-	0xbf, 0x42, 0x3f, 0x36, 0xbf, 0x29, 0x7f, 0x25, 0x3f, 0x25, 0x73, 0x0c, 0x15, 0x42, 0x77, 0x4a, 
-	0x1a, 0x5f, 0xbf, 0x73, 0xde, 0x77, 0xfd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xde, 0x73, 0x19, 0x5f, 0x94, 0x4e, 0x94, 0x4e, 
-	0x6b, 0x29, 0xf7, 0x5a, 0xbd, 0x73, 0xdd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xbd, 0x73, 
-	0xf8, 0x5a, 0x8c, 0x2d, 0xe7, 0x14, 0xef, 0x39, 0xf7, 0x5a, 0x5b, 0x67, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0x31, 0x42, 0xac, 0x31, 0x49, 0x25, 0x59, 0x67, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x33, 0x3a, 0x7e, 0x63, 
-	0x9e, 0x67, 0x9f, 0x63, 0x5e, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5b, 0xfe, 0x56, 0xbc, 0x46, 
-	0xff, 0x4a, 0x7f, 0x3a, 0x1f, 0x32, 0x9f, 0x29, 0xde, 0x18, 0x9a, 0x14, 0x94, 0x31, 0xbf, 0x73, 
-	0xdf, 0x77, 0xde, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x73, 0x4a, 
-	0x94, 0x4e, 0x10, 0x3e, 0xc6, 0x14, 0xb4, 0x52, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 
-	0x9c, 0x6f, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0x5a, 0x67, 0x94, 0x4e, 0x6b, 0x29, 0x08, 0x1d, 
-	0x10, 0x3e, 0x18, 0x5f, 0x9c, 0x6f, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x0f, 0x3a, 0xee, 0x35, 0x49, 0x21, 0xde, 0x77, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x55, 0x42, 0x5e, 0x5f, 
-	0x7e, 0x63, 0x7e, 0x5f, 0x7d, 0x5f, 0x7e, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x98, 0x4a, 0xb9, 0x46, 
-	0xbf, 0x42, 0x3f, 0x32, 0xbf, 0x29, 0xbf, 0x29, 0xff, 0x14, 0x9e, 0x14, 0x76, 0x10, 0x77, 0x4e, 
-	0xdf, 0x7b, 0xdf, 0x7b, 0xde, 0x77, 0xdf, 0x77, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x77, 
-	0x7b, 0x6b, 0xee, 0x39, 0xef, 0x39, 0x29, 0x21, 0x08, 0x1d, 0xd6, 0x56, 0xbd, 0x73, 0xde, 0x77, 
-	0x9c, 0x6f, 0xd6, 0x56, 0x10, 0x3e, 0x4b, 0x25, 0x4a, 0x25, 0x32, 0x46, 0x5a, 0x67, 0xde, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0x8b, 0x29, 0xcd, 0x35, 0xd5, 0x56, 0xbd, 0x73, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x9c, 0x6f, 0xae, 0x2d, 0xb8, 0x4e, 
-	0xfa, 0x56, 0xd8, 0x4a, 0x9e, 0x63, 0x5e, 0x5f, 0x3e, 0x57, 0x5f, 0x5f, 0xb9, 0x4a, 0x79, 0x3e, 
-	0xdf, 0x46, 0x5f, 0x3a, 0xff, 0x31, 0xff, 0x31, 0x9f, 0x29, 0x9e, 0x14, 0x77, 0x0c, 0x98, 0x52, 
-	0xdf, 0x7b, 0xdf, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0x9c, 0x6f, 0xd6, 0x56, 0x9c, 0x6f, 0x30, 0x42, 0x8b, 0x2d, 0x8c, 0x2d, 0x8c, 0x2d, 
-	0x29, 0x21, 0x08, 0x1d, 0x73, 0x4a, 0x5a, 0x67, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0x39, 0x63, 0x8b, 0x29, 0xac, 0x2d, 0x9c, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x11, 0x3e, 0x9d, 0x6b, 
-	0xd7, 0x56, 0xb0, 0x29, 0x5e, 0x5f, 0x5e, 0x5b, 0x5e, 0x57, 0x5e, 0x5b, 0x77, 0x46, 0x15, 0x36, 
-	0xbe, 0x42, 0x5f, 0x36, 0xde, 0x29, 0x9f, 0x29, 0x3f, 0x25, 0xbc, 0x18, 0x93, 0x10, 0x3b, 0x63, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xde, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xde, 0x77, 0xde, 0x73, 0x18, 0x5f, 0x52, 0x46, 0x28, 0x21, 0x07, 0x1d, 0xc5, 0x14, 0x31, 0x46, 
-	0x5a, 0x67, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0x6a, 0x29, 0xab, 0x2d, 0xee, 0x39, 0xbd, 0x77, 0xbd, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdf, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0x7c, 0x6f, 0x3c, 0x5f, 0x5e, 0x5b, 0x7e, 0x5f, 0x5d, 0x57, 0x1b, 0x57, 0x96, 0x4e, 0x35, 0x42, 
-	0xdd, 0x4e, 0x1d, 0x2a, 0xff, 0x29, 0xdd, 0x31, 0x17, 0x1d, 0xd1, 0x18, 0xd8, 0x56, 0xde, 0x7b, 
-	0x7a, 0x6b, 0xf7, 0x5e, 0xbd, 0x73, 0xbe, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xde, 0x77, 0x39, 0x63, 
-	0x10, 0x3e, 0x6b, 0x29, 0x29, 0x21, 0x08, 0x1d, 0xee, 0x35, 0x28, 0x21, 0x28, 0x21, 0xde, 0x77, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xf7, 0x5a, 0x6a, 0x29, 0x07, 0x1d, 0x39, 0x63, 0x9d, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0x3b, 0x5f, 0x5d, 0x5f, 0x5d, 0x63, 0x97, 0x4a, 0xf8, 0x5a, 0xbd, 0x73, 0x9c, 0x6f, 
-	0x91, 0x29, 0x9f, 0x42, 0x1f, 0x36, 0x9a, 0x2d, 0xb1, 0x35, 0x9d, 0x6f, 0x9b, 0x6f, 0xad, 0x35, 
-	0x6b, 0x29, 0x8c, 0x2d, 0xef, 0x39, 0xbc, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xde, 0x77, 0x9c, 0x6f, 0xb5, 0x52, 0x2a, 0x21, 0x29, 0x1d, 
-	0xe7, 0x14, 0x8d, 0x2d, 0xf7, 0x5a, 0xbd, 0x6f, 0x73, 0x4a, 0x49, 0x25, 0x52, 0x4a, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0x9d, 0x6f, 0x9c, 0x6f, 0x4a, 0x25, 0x6a, 0x29, 0xc4, 0x14, 0x18, 0x5f, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x77, 0xc7, 0x14, 0x4b, 0x21, 0x32, 0x42, 0x9c, 0x6f, 0xbe, 0x73, 0xdf, 0x77, 0xdd, 0x73, 
-	0x7c, 0x6b, 0x0e, 0x1d, 0xf8, 0x35, 0x2e, 0x21, 0xbf, 0x73, 0xde, 0x77, 0xde, 0x7b, 0x5b, 0x67, 
-	0x30, 0x3e, 0x31, 0x3e, 0x2f, 0x3e, 0x6b, 0x29, 0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xde, 0x73, 0x39, 0x63, 0x31, 0x3e, 0x29, 0x1d, 0xad, 0x2d, 0x10, 0x3a, 0xb5, 0x52, 
-	0x7b, 0x6b, 0xde, 0x77, 0xbe, 0x73, 0xf7, 0x5a, 0x8b, 0x29, 0x49, 0x29, 0xf7, 0x5a, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0x9d, 0x6f, 
-	0x9d, 0x6f, 0xb6, 0x52, 0x39, 0x5f, 0x8b, 0x29, 0x6a, 0x29, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbf, 0x73, 0x9e, 0x6f, 0xdf, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xff, 0x77, 0xb4, 0x4e, 0x0f, 0x3a, 0xcd, 0x31, 0x8c, 0x2d, 0x9c, 0x6f, 0xbd, 0x73, 0xde, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 
-	0xd6, 0x52, 0x8d, 0x2d, 0x4a, 0x25, 0x11, 0x3a, 0xb6, 0x52, 0x7b, 0x6b, 0xde, 0x77, 0xdd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x73, 0x4a, 0xed, 0x35, 0xe6, 0x14, 0x9c, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0x8f, 0x2d, 0x4e, 0x25, 0x4b, 0x08, 0x07, 0x00, 0x8d, 0x2d, 0xb4, 0x52, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0x39, 0x63, 0x93, 0x4a, 0xad, 0x31, 0xad, 0x31, 0xbd, 0x73, 0xdd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xdf, 0x73, 0x7b, 0x67, 0x74, 0x4a, 0x4b, 0x25, 
-	0xf0, 0x39, 0x94, 0x4e, 0x7b, 0x6b, 0xde, 0x77, 0xde, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x6b, 0x29, 0xcc, 0x2d, 0x4a, 0x25, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbf, 0x73, 0x36, 0x42, 
-	0x30, 0x08, 0x31, 0x08, 0x30, 0x04, 0x2f, 0x04, 0x06, 0x00, 0xb5, 0x52, 0xbd, 0x73, 0xde, 0x73, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x5a, 0x67, 0x39, 0x63, 0xee, 0x35, 0x31, 0x42, 0xdd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0x19, 0x5f, 0xae, 0x31, 0x29, 0x21, 0x10, 0x3e, 0x39, 0x63, 
-	0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xdf, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x77, 
-	0xbe, 0x73, 0xde, 0x73, 0x18, 0x5f, 0x49, 0x21, 0x8b, 0x29, 0xf6, 0x56, 0xbd, 0x73, 0xde, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x9e, 0x6f, 0x2c, 0x04, 
-	0x32, 0x08, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x4c, 0x08, 0x32, 0x42, 0xdf, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0x5a, 0x67, 0x39, 0x63, 0x8c, 0x2d, 0x73, 0x4a, 
-	0xde, 0x77, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xbd, 0x73, 0x73, 0x4a, 0xa5, 0x10, 0xef, 0x39, 0x39, 0x63, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x77, 0xdd, 0x77, 0xdf, 0x77, 
-	0x3d, 0x63, 0xfb, 0x5a, 0x2d, 0x25, 0x5b, 0x67, 0xef, 0x39, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xf9, 0x5e, 0x2c, 0x04, 
-	0x31, 0x08, 0x31, 0x04, 0x11, 0x04, 0x34, 0x08, 0x2e, 0x08, 0xf8, 0x5a, 0xbd, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0x5a, 0x67, 0x31, 0x42, 0x4b, 0x29, 0x85, 0x10, 0x2a, 0x25, 0x31, 0x42, 
-	0x5b, 0x67, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xde, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xad, 0x31, 0x95, 0x4e, 
-	0x9c, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x93, 0x4a, 0x39, 0x63, 0xa5, 0x10, 
-	0x18, 0x5f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x94, 0x4e, 
-	0xad, 0x31, 0xd6, 0x5a, 0x7b, 0x6b, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xdd, 0x73, 0x9d, 0x6b, 0xf7, 0x35, 
-	0x18, 0x1d, 0xf9, 0x1c, 0x94, 0x31, 0x7d, 0x6b, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x9e, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0x12, 0x3e, 0x2b, 0x00, 
-	0x30, 0x04, 0x31, 0x04, 0x31, 0x04, 0x31, 0x04, 0x4d, 0x08, 0x3a, 0x63, 0xbd, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x3a, 0x63, 0x21, 0x04, 0x53, 0x4a, 0x5b, 0x67, 0x7c, 0x6b, 0x5a, 0x67, 0x31, 0x42, 
-	0x85, 0x10, 0x7b, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xde, 0x73, 0x39, 0x63, 
-	0x7c, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0x8c, 0x31, 0x7b, 0x6b, 0x7b, 0x6b, 0x5b, 0x67, 0xf7, 0x5a, 0x8c, 0x31, 
-	0x08, 0x1d, 0x5a, 0x67, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xf8, 0x5a, 0x73, 0x4a, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x39, 0x63, 0x10, 0x3e, 0x52, 0x42, 
-	0x9c, 0x6b, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbd, 0x73, 0xf8, 0x5a, 0x8d, 0x2d, 0x18, 0x5f, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xdf, 0x77, 0x9e, 0x6f, 0x9d, 0x6f, 0xff, 0x7b, 0xde, 0x77, 0x15, 0x3a, 0xde, 0x31, 
-	0x5f, 0x21, 0xfc, 0x1c, 0x51, 0x08, 0xb2, 0x31, 0x3b, 0x63, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xde, 0x73, 
-	0xbd, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdd, 0x73, 0x7c, 0x67, 0x3d, 0x63, 
-	0xb4, 0x35, 0x70, 0x0c, 0x50, 0x08, 0x50, 0x08, 0xf2, 0x39, 0xde, 0x73, 0xbd, 0x73, 0xbf, 0x73, 
-	0xde, 0x73, 0x52, 0x46, 0x8d, 0x31, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0x52, 0x46, 0x19, 0x5f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xf0, 0x3d, 0x29, 0x25, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x73, 0x4a, 0x73, 0x4a, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7c, 0x6b, 0xd6, 0x56, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0x9c, 0x6b, 0x9c, 0x6b, 0xde, 0x73, 0x3a, 0x63, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0x9d, 0x6b, 0x39, 0x5f, 
-	0xd7, 0x56, 0xd1, 0x2d, 0xba, 0x46, 0xba, 0x46, 0xda, 0x52, 0x9e, 0x6b, 0xb9, 0x29, 0xbf, 0x2d, 
-	0x5e, 0x1d, 0xfd, 0x1c, 0x53, 0x08, 0xb5, 0x14, 0x0c, 0x00, 0x55, 0x46, 0x9e, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x18, 0x5b, 0x19, 0x5f, 
-	0x5a, 0x63, 0x7c, 0x6b, 0x5a, 0x63, 0xb6, 0x52, 0x54, 0x46, 0x3a, 0x5f, 0x5a, 0x67, 0x9d, 0x6f, 
-	0xdf, 0x77, 0xbf, 0x73, 0xd7, 0x56, 0x72, 0x46, 0xbd, 0x6f, 0x9c, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x52, 0x46, 0xef, 0x39, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xb6, 0x56, 0x6b, 0x29, 0x85, 0x10, 
-	0x8c, 0x2d, 0xf7, 0x5a, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x29, 0x25, 0xf8, 0x5a, 0xd6, 0x56, 
-	0x2a, 0x25, 0xe7, 0x1c, 0x31, 0x42, 0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0x9d, 0x6f, 0x31, 0x42, 
-	0xa5, 0x14, 0x29, 0x25, 0xb6, 0x52, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x29, 0x25, 0xf7, 0x5a, 0xd6, 0x56, 0x2a, 0x25, 0xe7, 0x1c, 
-	0x31, 0x42, 0x9d, 0x6f, 0xde, 0x73, 0xde, 0x73, 0x9c, 0x6f, 0x31, 0x42, 0xc6, 0x14, 0x4a, 0x29, 
-	0xf7, 0x5a, 0xb6, 0x52, 0x8c, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0x7c, 0x6b, 0x21, 0x04, 0xf8, 0x5a, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x52, 0x46, 0x29, 0x25, 
-	0xa5, 0x14, 0x8c, 0x31, 0xf7, 0x5a, 0xde, 0x73, 0xde, 0x73, 0xf0, 0x3d, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7b, 0x6b, 0x9c, 0x6f, 0x52, 0x46, 0x29, 0x25, 0xa5, 0x14, 0x8c, 0x31, 0xf7, 0x5a, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x9d, 0x6f, 
-	0xb6, 0x52, 0xf0, 0x39, 0x8d, 0x2d, 0x9c, 0x6b, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xf8, 0x56, 0xf9, 0x52, 0xfa, 0x52, 
-	0x13, 0x36, 0x5f, 0x5b, 0xfd, 0x46, 0xfe, 0x4a, 0x99, 0x42, 0x16, 0x3a, 0x9c, 0x25, 0xbf, 0x29, 
-	0x5f, 0x1d, 0xfe, 0x1c, 0xbd, 0x14, 0x9d, 0x10, 0xbd, 0x18, 0x75, 0x10, 0x98, 0x4e, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xf7, 0x56, 0xd7, 0x56, 0x9c, 0x6b, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0x7b, 0x6b, 0x19, 0x5b, 
-	0x95, 0x4e, 0x19, 0x5f, 0xde, 0x73, 0xdf, 0x73, 0x9e, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x39, 0x63, 0x00, 0x00, 0x94, 0x4e, 0x9c, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xb6, 0x52, 0xe7, 0x18, 0x39, 0x63, 0x9d, 0x6f, 
-	0x19, 0x5f, 0xa5, 0x14, 0xf8, 0x5a, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xad, 0x35, 0xb5, 0x52, 
-	0x7c, 0x6b, 0x5a, 0x67, 0x29, 0x21, 0x94, 0x4e, 0xbe, 0x73, 0xbe, 0x73, 0x10, 0x3e, 0x6b, 0x2d, 
-	0x5b, 0x67, 0x9c, 0x6f, 0xb5, 0x52, 0x2a, 0x25, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0xad, 0x35, 0xb5, 0x52, 0x7c, 0x6b, 0x5a, 0x67, 
-	0x29, 0x21, 0x94, 0x4e, 0xde, 0x73, 0xde, 0x73, 0x10, 0x3e, 0x6b, 0x2d, 0x5b, 0x67, 0x9c, 0x6f, 
-	0x52, 0x46, 0x8c, 0x2d, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0x8d, 0x31, 0x52, 0x46, 0xbe, 0x73, 0xbe, 0x73, 0x31, 0x42, 0xce, 0x39, 0x7b, 0x6b, 
-	0x9d, 0x6f, 0xd7, 0x5a, 0x00, 0x00, 0x3a, 0x63, 0xde, 0x73, 0xbe, 0x73, 0xcf, 0x39, 0x53, 0x4a, 
-	0xbe, 0x73, 0xbe, 0x73, 0x31, 0x42, 0xce, 0x35, 0x7b, 0x6b, 0x9d, 0x6f, 0xd7, 0x56, 0x00, 0x00, 
-	0x39, 0x63, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9d, 0x6f, 0xde, 0x77, 0x9d, 0x6f, 0xb5, 0x52, 0xae, 0x2d, 
-	0x11, 0x3e, 0x10, 0x3e, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x96, 0x4a, 0x7e, 0x63, 0x5d, 0x5f, 
-	0x5e, 0x5f, 0x3d, 0x53, 0x1d, 0x4b, 0xfe, 0x4a, 0xdd, 0x4a, 0xd2, 0x0c, 0x9d, 0x25, 0xdf, 0x25, 
-	0x7f, 0x21, 0x5e, 0x21, 0xdf, 0x14, 0x7d, 0x0c, 0x9e, 0x14, 0xbb, 0x14, 0x32, 0x25, 0xdf, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0x7c, 0x6b, 0xb4, 0x4e, 0x7c, 0x6b, 0xbe, 0x73, 0x9d, 0x6b, 0xbe, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0xbe, 0x73, 
-	0xde, 0x73, 0x9c, 0x6b, 0xf8, 0x5a, 0xd6, 0x52, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0x18, 0x5f, 0x4b, 0x29, 0x00, 0x00, 0x8c, 0x31, 0x74, 0x4e, 0x3a, 0x63, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xc7, 0x18, 0xd6, 0x56, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x94, 0x4e, 0x8c, 0x2d, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xef, 0x39, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0xcf, 0x39, 0xbe, 0x73, 0x9c, 0x6f, 0x00, 0x00, 0x18, 0x5f, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x6c, 0x2d, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x09, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xef, 0x39, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0x73, 0x4a, 0xcf, 0x39, 0xde, 0x73, 0x9d, 0x6f, 0x00, 0x00, 0x18, 0x5f, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x29, 0x21, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x11, 0x42, 0xef, 0x39, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0x6b, 0x29, 0x94, 0x4e, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x6b, 0x29, 
-	0x94, 0x4e, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x9d, 0x6f, 0x94, 0x4e, 0x2a, 0x21, 0x8c, 0x29, 0xad, 0x2d, 
-	0x32, 0x42, 0xde, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xb6, 0x4e, 0x7e, 0x63, 0x5e, 0x5f, 
-	0x1c, 0x4f, 0xfd, 0x46, 0xde, 0x46, 0xff, 0x46, 0x9c, 0x3a, 0xf3, 0x0c, 0x3e, 0x36, 0xdf, 0x2d, 
-	0x9f, 0x29, 0xfd, 0x18, 0xff, 0x14, 0xff, 0x1c, 0x5d, 0x10, 0x78, 0x10, 0x11, 0x21, 0xbf, 0x77, 
-	0xbe, 0x73, 0xbd, 0x73, 0x94, 0x4e, 0xde, 0x73, 0x9d, 0x6f, 0x9d, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 
-	0x9d, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0x73, 0x46, 0x7b, 0x67, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x7b, 0x6b, 0xd7, 0x56, 0x11, 0x42, 0x63, 0x0c, 
-	0xad, 0x31, 0x9c, 0x6f, 0xde, 0x73, 0x7b, 0x6b, 0x00, 0x00, 0x5a, 0x67, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x19, 0x5f, 0x00, 0x00, 0x9d, 0x6f, 0xde, 0x73, 0x4a, 0x29, 0x95, 0x4e, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0x5a, 0x67, 0x00, 0x00, 0x7b, 0x67, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x52, 0x46, 0xad, 0x31, 0xbe, 0x73, 0xde, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0x95, 0x4e, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xb5, 0x52, 0x8c, 0x2d, 0xde, 0x73, 0x5a, 0x67, 0x00, 0x00, 0x7b, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x52, 0x46, 0xad, 0x31, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xf0, 0x3d, 0x10, 0x3e, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x52, 0x46, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 
-	0x52, 0x46, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xde, 0x77, 0x9d, 0x6f, 0x11, 0x42, 0x4a, 0x21, 0x49, 0x25, 0x08, 0x1d, 0xf7, 0x5a, 0xbd, 0x6f, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0x9c, 0x6b, 0x9d, 0x67, 0x5d, 0x5f, 
-	0x3d, 0x53, 0x1e, 0x4f, 0xde, 0x46, 0xff, 0x4a, 0x9c, 0x3e, 0x95, 0x1d, 0x1d, 0x2e, 0xbf, 0x29, 
-	0x5f, 0x25, 0xff, 0x18, 0x9e, 0x0c, 0x9d, 0x0c, 0x5d, 0x10, 0x96, 0x14, 0x96, 0x4e, 0xbf, 0x77, 
-	0xde, 0x77, 0xf6, 0x5a, 0x9d, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0x9d, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x9c, 0x6b, 0xbe, 0x73, 0xf7, 0x56, 0x19, 0x5f, 0xbd, 0x6f, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x7c, 0x6b, 
-	0x4a, 0x29, 0x32, 0x46, 0xde, 0x73, 0x3a, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x6b, 0xde, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0x39, 0x63, 0x00, 0x00, 0x7c, 0x6b, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x74, 0x4a, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0x8c, 0x2d, 0xde, 0x73, 0x39, 0x63, 0x00, 0x00, 0x9c, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x94, 0x4e, 0xad, 0x31, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x4a, 0x25, 0x73, 0x4a, 0xde, 0x73, 0xde, 0x73, 0x7b, 0x67, 0x31, 0x42, 0x4a, 0x29, 
-	0xa5, 0x14, 0x64, 0x0c, 0x00, 0x00, 0x52, 0x46, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 
-	0xde, 0x73, 0xde, 0x73, 0x7b, 0x67, 0x31, 0x42, 0x4a, 0x29, 0xa5, 0x14, 0x64, 0x0c, 0x00, 0x00, 
-	0x52, 0x46, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9d, 0x6f, 0xde, 0x77, 0xbd, 0x73, 
-	0x94, 0x4e, 0x4b, 0x25, 0xad, 0x31, 0x0f, 0x3a, 0xac, 0x31, 0x29, 0x21, 0xde, 0x77, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0x9d, 0x6f, 0x3a, 0x5f, 0x97, 0x4a, 0x97, 0x4a, 0x7e, 0x63, 
-	0x3c, 0x57, 0x5e, 0x57, 0x3e, 0x53, 0x3f, 0x4f, 0xdd, 0x46, 0x7c, 0x3a, 0x1e, 0x2e, 0x1f, 0x2e, 
-	0x7d, 0x21, 0xfd, 0x14, 0xde, 0x10, 0x7d, 0x0c, 0xfd, 0x20, 0xf5, 0x39, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xf7, 0x56, 0xbe, 0x73, 0x9d, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0x5a, 0x67, 0xd6, 0x52, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0x94, 0x4e, 0x4a, 0x29, 0xde, 0x73, 0x5b, 0x67, 0x00, 0x00, 0x5a, 0x67, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0x3a, 0x63, 0x00, 0x00, 0x7b, 0x67, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x52, 0x46, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x09, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0x3a, 0x63, 0x00, 0x00, 0x7c, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0x52, 0x46, 0xad, 0x31, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0x5b, 0x67, 0x00, 0x00, 0x39, 0x5f, 0xde, 0x73, 0xbd, 0x6f, 0x08, 0x21, 0x32, 0x46, 0x9c, 0x6b, 
-	0xbe, 0x73, 0xde, 0x73, 0xef, 0x39, 0x52, 0x46, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 
-	0xde, 0x73, 0xbd, 0x6f, 0x08, 0x21, 0x32, 0x46, 0x7c, 0x6b, 0xbe, 0x73, 0xde, 0x73, 0xef, 0x39, 
-	0x52, 0x46, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0x3a, 0x63, 0x52, 0x42, 0x8c, 0x29, 
-	0xf0, 0x39, 0xf7, 0x56, 0x9c, 0x6b, 0xac, 0x2d, 0x30, 0x42, 0x73, 0x4a, 0xde, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0x9c, 0x6f, 0xcf, 0x31, 0xfa, 0x52, 0x7e, 0x5f, 0x3c, 0x57, 0xd9, 0x4a, 
-	0xda, 0x4e, 0x5e, 0x5b, 0x1d, 0x4f, 0xde, 0x42, 0x1f, 0x4f, 0xde, 0x46, 0x3d, 0x2e, 0x1f, 0x2a, 
-	0x7f, 0x1d, 0xff, 0x18, 0x9d, 0x14, 0xba, 0x14, 0x36, 0x42, 0xff, 0x7b, 0xde, 0x77, 0xbf, 0x77, 
-	0xde, 0x77, 0xd6, 0x52, 0x9c, 0x6b, 0x9d, 0x6b, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0x9c, 0x6b, 
-	0x9d, 0x6f, 0x08, 0x1d, 0xd7, 0x5a, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xef, 0x39, 0xce, 0x35, 0xde, 0x73, 0xbd, 0x73, 0xa5, 0x14, 0xf8, 0x5a, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0x9c, 0x6f, 0x00, 0x00, 0xf8, 0x5a, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x25, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x09, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0x9c, 0x6b, 0x00, 0x00, 0x19, 0x5f, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x29, 0x25, 0xad, 0x31, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xce, 0x35, 0x8c, 0x31, 0xbe, 0x73, 0xde, 0x73, 0x5a, 0x67, 0x00, 0x00, 0x7c, 0x6b, 0xde, 0x73, 
-	0xde, 0x73, 0xbd, 0x73, 0xe7, 0x1c, 0x52, 0x46, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 
-	0xde, 0x73, 0x5a, 0x67, 0x00, 0x00, 0x7c, 0x6b, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xe7, 0x1c, 
-	0x52, 0x46, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0x7b, 0x6b, 0x73, 0x4a, 0x4b, 0x25, 0x6b, 0x25, 0x94, 0x4a, 0x5a, 0x67, 
-	0xde, 0x73, 0xbe, 0x73, 0xbc, 0x6f, 0xac, 0x2d, 0x8b, 0x2d, 0x39, 0x63, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0x9c, 0x6f, 0x74, 0x46, 0x9e, 0x67, 0x5c, 0x5b, 0x7c, 0x5b, 0x9d, 0x5f, 0x5d, 0x5b, 
-	0xd9, 0x4a, 0xb0, 0x29, 0xfb, 0x4e, 0xbe, 0x46, 0x3a, 0x3a, 0x3b, 0x36, 0x5f, 0x32, 0x1f, 0x32, 
-	0xbf, 0x2d, 0xd9, 0x14, 0x72, 0x0c, 0x0b, 0x00, 0x72, 0x29, 0xf4, 0x3d, 0xda, 0x5a, 0xbf, 0x77, 
-	0xbd, 0x77, 0x9c, 0x6f, 0xb5, 0x4e, 0xde, 0x73, 0x9d, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0x9d, 0x6f, 
-	0xde, 0x73, 0x94, 0x4e, 0x63, 0x0c, 0x95, 0x52, 0x5a, 0x67, 0x7b, 0x6b, 0x3a, 0x63, 0x32, 0x46, 
-	0x21, 0x04, 0x19, 0x63, 0xde, 0x73, 0xde, 0x73, 0x95, 0x4e, 0x29, 0x25, 0x39, 0x63, 0x9d, 0x6f, 
-	0x7b, 0x6b, 0x31, 0x42, 0x73, 0x4a, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0xbe, 0x73, 0xef, 0x39, 0x6b, 0x29, 
-	0x5a, 0x67, 0x7b, 0x6b, 0x74, 0x4a, 0x6b, 0x29, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0xde, 0x73, 0xce, 0x35, 0x8d, 0x31, 0x7b, 0x6b, 0x9c, 0x6f, 
-	0x53, 0x4a, 0xad, 0x31, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x32, 0x46, 0x8c, 0x31, 0x7b, 0x6b, 0x7b, 0x6b, 0x5b, 0x67, 0xf8, 0x5a, 0x8c, 0x2d, 
-	0x29, 0x21, 0x7b, 0x67, 0xde, 0x73, 0xde, 0x77, 0x9c, 0x6f, 0x21, 0x04, 0xb6, 0x52, 0x9d, 0x6f, 
-	0x5b, 0x67, 0x31, 0x42, 0xf0, 0x3d, 0xef, 0x39, 0xde, 0x73, 0xde, 0x73, 0x31, 0x42, 0xce, 0x35, 
-	0x7c, 0x6b, 0x7b, 0x67, 0x21, 0x04, 0xb6, 0x52, 0x9d, 0x6f, 0x5b, 0x67, 0x31, 0x42, 0xf0, 0x3d, 
-	0xef, 0x39, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xb5, 0x52, 0x63, 0x0c, 0xde, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0x63, 0x0c, 0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x63, 0x0c, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x77, 0x7c, 0x6b, 
-	0xb5, 0x4e, 0xcf, 0x35, 0xcf, 0x35, 0x52, 0x42, 0xf7, 0x56, 0xbd, 0x6f, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x17, 0x5b, 0x0f, 0x3e, 0x28, 0x1d, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xff, 0x7b, 0x73, 0x46, 0x9e, 0x6b, 0x7d, 0x5f, 0x7d, 0x5f, 0x7d, 0x5f, 0x5e, 0x5f, 0x7f, 0x5f, 
-	0x5d, 0x5f, 0x96, 0x46, 0x77, 0x3a, 0x58, 0x3a, 0x49, 0x00, 0x5c, 0x36, 0xfd, 0x2d, 0x5c, 0x21, 
-	0x17, 0x19, 0xb5, 0x14, 0xb9, 0x14, 0x5b, 0x10, 0x7d, 0x14, 0x5a, 0x0c, 0x56, 0x0c, 0x37, 0x42, 
-	0xde, 0x73, 0xbe, 0x73, 0x9c, 0x6b, 0x52, 0x46, 0x9c, 0x6b, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0x9d, 0x6f, 0x9d, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xde, 0x73, 0xde, 0x73, 0x18, 0x5f, 0xef, 0x39, 0x29, 0x25, 0x85, 0x10, 0x6b, 0x2d, 0x52, 0x46, 
-	0x5b, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xd6, 0x56, 0x6b, 0x2d, 0x64, 0x0c, 
-	0x2a, 0x25, 0x73, 0x4a, 0x9d, 0x6f, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x8c, 0x2d, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x10, 0x3e, 
-	0xa5, 0x14, 0x29, 0x25, 0xb6, 0x52, 0xb6, 0x52, 0x8c, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x29, 0x21, 
-	0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0xb6, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0x8c, 0x2d, 0xde, 0x73, 0xde, 0x73, 0x7c, 0x6b, 0xef, 0x39, 0x85, 0x10, 0x6b, 0x2d, 
-	0xf8, 0x5a, 0x94, 0x4e, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x32, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x0c, 0x6c, 0x2d, 0x94, 0x4e, 
-	0x9c, 0x6f, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xf7, 0x5a, 0x4a, 0x29, 0xa5, 0x14, 
-	0xef, 0x39, 0x7b, 0x6b, 0x3a, 0x63, 0x08, 0x1d, 0xad, 0x31, 0xde, 0x73, 0x5a, 0x67, 0x29, 0x21, 
-	0x29, 0x21, 0x5a, 0x63, 0xf7, 0x5a, 0x4a, 0x29, 0xa5, 0x14, 0xef, 0x39, 0x7b, 0x6b, 0x3a, 0x63, 
-	0x08, 0x1d, 0xad, 0x31, 0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x63, 0x0c, 0xde, 0x73, 0xde, 0x73, 
-	0xb5, 0x52, 0x63, 0x0c, 0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0x63, 0x0c, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x5a, 0x67, 0xef, 0x35, 0xce, 0x31, 
-	0xae, 0x31, 0x52, 0x42, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xdf, 0x77, 0x52, 0x46, 0xac, 0x31, 0xb4, 0x52, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xdf, 0x77, 
-	0xbe, 0x73, 0x94, 0x46, 0x9e, 0x67, 0x7e, 0x5f, 0x7e, 0x5f, 0x7e, 0x63, 0x5e, 0x5b, 0x3d, 0x57, 
-	0x5d, 0x5b, 0x3e, 0x57, 0xfe, 0x4e, 0x9c, 0x42, 0x94, 0x25, 0x9e, 0x3e, 0x3c, 0x36, 0xd2, 0x10, 
-	0xb2, 0x10, 0xfd, 0x1c, 0x7f, 0x14, 0x5c, 0x08, 0x3b, 0x04, 0x3a, 0x08, 0x58, 0x0c, 0x2e, 0x04, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xdf, 0x7b, 0x19, 0x5f, 0x11, 0x3e, 0x18, 0x5b, 0x5b, 0x67, 
-	0x9c, 0x6b, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0x9d, 0x6f, 0x7c, 0x6b, 0x5a, 0x63, 0x7c, 0x67, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x7c, 0x6b, 0x9c, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x10, 0x3e, 0x52, 0x46, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x9c, 0x6f, 0x10, 0x3e, 0x08, 0x1d, 0xad, 0x31, 0x11, 0x3e, 
-	0x5b, 0x67, 0xde, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbf, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x7b, 0x6b, 0x6a, 0x29, 0x48, 0x21, 0xbc, 0x6f, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x6f, 0x3a, 0x5f, 0x5c, 0x5f, 0x7e, 0x5f, 0x5e, 0x5b, 0x5d, 0x5f, 0x5d, 0x5f, 0x3d, 0x5b, 
-	0xb8, 0x46, 0x96, 0x42, 0x99, 0x46, 0xbd, 0x46, 0x58, 0x3e, 0xed, 0x10, 0x8d, 0x0c, 0x79, 0x25, 
-	0x1c, 0x1d, 0x1e, 0x21, 0x7d, 0x10, 0x7d, 0x10, 0x5c, 0x0c, 0x3b, 0x08, 0x9c, 0x18, 0x70, 0x0c, 
-	0xf9, 0x5a, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdf, 0x77, 0x9c, 0x6f, 0x39, 0x63, 
-	0x39, 0x63, 0x7b, 0x67, 0x39, 0x63, 0x5a, 0x67, 0xf8, 0x5a, 0xf8, 0x5a, 0x18, 0x5f, 0x39, 0x63, 
-	0x39, 0x63, 0x5a, 0x67, 0x5a, 0x67, 0xf7, 0x5e, 0xb5, 0x52, 0x52, 0x42, 0x52, 0x46, 0x18, 0x5f, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x31, 0x42, 0x8c, 0x2d, 0x5b, 0x67, 0x9c, 0x6f, 
-	0xf7, 0x5a, 0x21, 0x04, 0x3a, 0x63, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0x9d, 0x6f, 0xb5, 0x52, 0xae, 0x31, 0x4b, 0x25, 0x53, 0x46, 0x5a, 0x67, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbc, 0x73, 
-	0xde, 0x77, 0xef, 0x39, 0xaa, 0x29, 0x31, 0x42, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0x95, 0x4a, 0x7d, 0x67, 0x7d, 0x5f, 0x7e, 0x63, 0x5d, 0x5b, 0x7f, 0x63, 0x5d, 0x5f, 
-	0xfb, 0x52, 0x90, 0x25, 0x76, 0x3e, 0xdd, 0x46, 0x7c, 0x36, 0x5b, 0x36, 0xdc, 0x2d, 0xbd, 0x29, 
-	0xbf, 0x29, 0xbd, 0x14, 0x5d, 0x0c, 0x9f, 0x10, 0x5d, 0x0c, 0x3b, 0x08, 0x57, 0x08, 0x2a, 0x00, 
-	0xf8, 0x5a, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0x9d, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0x9c, 0x6f, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0x73, 0x4a, 0x29, 0x25, 0xc6, 0x18, 
-	0xae, 0x35, 0x18, 0x5f, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x7c, 0x6b, 
-	0x52, 0x46, 0x2a, 0x21, 0x4b, 0x25, 0xb5, 0x52, 0x7c, 0x6b, 0xbe, 0x73, 0xbd, 0x73, 0xbc, 0x6f, 
-	0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xdd, 0x77, 0xfe, 0x7b, 
-	0xd7, 0x56, 0xad, 0x31, 0x6a, 0x29, 0x9c, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xff, 0x7b, 0xd7, 0x56, 0x5c, 0x63, 0x5c, 0x5f, 0x7d, 0x63, 0x7e, 0x5f, 0x5d, 0x5b, 0x7e, 0x5f, 
-	0x3d, 0x5b, 0x3d, 0x57, 0xfa, 0x4e, 0xb3, 0x29, 0xba, 0x4a, 0x0d, 0x15, 0xb0, 0x0c, 0x9d, 0x2d, 
-	0x1e, 0x1d, 0xbf, 0x1c, 0x7f, 0x14, 0xbf, 0x14, 0x9d, 0x14, 0x5b, 0x08, 0x9b, 0x14, 0x72, 0x10, 
-	0x9f, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdf, 0x77, 0xbe, 0x73, 0x5a, 0x67, 0xf0, 0x39, 0x08, 0x1d, 
-	0x31, 0x42, 0x5a, 0x67, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xbe, 0x6f, 0xde, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xde, 0x77, 0x5b, 0x6b, 0x54, 0x4a, 0x4b, 0x25, 
-	0x49, 0x25, 0x6b, 0x2d, 0xd6, 0x5a, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xff, 0x7b, 0x95, 0x4e, 0xf8, 0x52, 0x3b, 0x5f, 0x7c, 0x63, 0x7d, 0x5f, 0xda, 0x4e, 
-	0xd9, 0x4a, 0x5d, 0x5b, 0x1d, 0x53, 0x35, 0x3e, 0x15, 0x36, 0xf7, 0x31, 0xb9, 0x2d, 0xdf, 0x31, 
-	0x5f, 0x25, 0xbe, 0x18, 0x7c, 0x0c, 0x9e, 0x10, 0x3d, 0x08, 0x3c, 0x08, 0x58, 0x08, 0x0b, 0x00, 
-	0x3b, 0x67, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0x3a, 0x63, 0x74, 0x4a, 0x6c, 0x29, 0x11, 0x3e, 0x18, 0x5f, 0xbd, 0x73, 
-	0xdf, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x5a, 0x63, 0x0a, 0x1d, 0x28, 0x04, 0xac, 0x14, 0x4d, 0x25, 
-	0xad, 0x31, 0xc3, 0x10, 0x9c, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xf8, 0x56, 0xd0, 0x29, 0x98, 0x46, 
-	0x5d, 0x5b, 0x5d, 0x57, 0x1d, 0x53, 0x2d, 0x19, 0x37, 0x3a, 0x52, 0x21, 0x79, 0x25, 0xdf, 0x2d, 
-	0xbf, 0x2d, 0xff, 0x1c, 0x5c, 0x0c, 0x7e, 0x10, 0x3d, 0x08, 0x7c, 0x10, 0x9a, 0x10, 0x4e, 0x08, 
-	0x5c, 0x67, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xdf, 0x77, 0x9c, 0x6f, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xb6, 0x52, 0x52, 0x46, 0xb6, 0x52, 0x39, 0x63, 0x9c, 0x6f, 
-	0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xff, 0x77, 0xbd, 0x73, 0x5a, 0x67, 0x93, 0x4e, 
-	0xce, 0x35, 0xe8, 0x18, 0xf0, 0x39, 0xf7, 0x5a, 0x7b, 0x6b, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x7d, 0x67, 0x6c, 0x08, 0x2f, 0x08, 0x30, 0x08, 0x2e, 0x08, 
-	0x0e, 0x21, 0x2a, 0x21, 0x7b, 0x6b, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x11, 0x3e, 0x3a, 0x57, 0x7e, 0x63, 0x3c, 0x57, 
-	0x3d, 0x57, 0x3e, 0x57, 0x5e, 0x57, 0xfb, 0x4a, 0xfb, 0x4e, 0x8a, 0x0c, 0x3c, 0x46, 0x9d, 0x2d, 
-	0x5f, 0x25, 0xbd, 0x14, 0x9f, 0x14, 0x9e, 0x10, 0x7d, 0x0c, 0x7d, 0x10, 0x9b, 0x14, 0x2f, 0x08, 
-	0x9f, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0x39, 0x63, 0x94, 0x4a, 0x29, 0x21, 0xad, 0x2d, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x6f, 0xf7, 0x5a, 0x94, 0x4e, 0xcf, 0x35, 
-	0xcf, 0x35, 0xcf, 0x35, 0x31, 0x42, 0x53, 0x46, 0xf7, 0x5a, 0x5a, 0x67, 0x7b, 0x6f, 0x7b, 0x6f, 
-	0xff, 0x7b, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 0xde, 0x77, 
-	0xdf, 0x7b, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0x9c, 0x6f, 0x7b, 0x6b, 0x5a, 0x67, 
-	0x5a, 0x67, 0xf8, 0x5a, 0xb5, 0x52, 0xf0, 0x39, 0x6b, 0x29, 0x29, 0x21, 0xe6, 0x18, 0x4a, 0x25, 
-	0x8b, 0x2d, 0x7b, 0x6b, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x91, 0x2d, 0x52, 0x0c, 0x12, 0x04, 0x12, 0x04, 0x72, 0x0c, 
-	0x0a, 0x04, 0xf2, 0x39, 0x39, 0x63, 0xbd, 0x6f, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0x5a, 0x67, 0xf8, 0x52, 0x3c, 0x57, 0x5e, 0x5b, 0x5d, 0x57, 
-	0x3e, 0x57, 0x1d, 0x57, 0x5e, 0x57, 0x1e, 0x53, 0xfd, 0x4e, 0xd3, 0x2d, 0x75, 0x25, 0xfe, 0x39, 
-	0x9f, 0x2d, 0xbe, 0x14, 0x7e, 0x10, 0x7e, 0x10, 0xbf, 0x18, 0x7c, 0x10, 0xb4, 0x14, 0x97, 0x4e, 
-	0xde, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0x9d, 0x6f, 0xb5, 0x4e, 0xd6, 0x52, 0x39, 0x5f, 0x17, 0x5b, 0x73, 0x46, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xdf, 0x77, 
-	0xdf, 0x77, 0xbe, 0x73, 0x7b, 0x67, 0x3a, 0x63, 0xf7, 0x5a, 0x31, 0x42, 0x8c, 0x2d, 0x08, 0x1d, 
-	0xef, 0x39, 0x94, 0x4e, 0xd6, 0x5a, 0x18, 0x5f, 0x39, 0x67, 0x39, 0x63, 0xd6, 0x56, 0x74, 0x4a, 
-	0x33, 0x42, 0xf1, 0x39, 0xb0, 0x31, 0x0c, 0x1d, 0xc9, 0x14, 0xc7, 0x14, 0xe7, 0x18, 0xe8, 0x18, 
-	0x4a, 0x25, 0xcf, 0x35, 0xce, 0x35, 0xef, 0x39, 0xd6, 0x56, 0xcd, 0x31, 0x8b, 0x29, 0x29, 0x21, 
-	0x18, 0x5f, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbf, 0x73, 0xbc, 0x6f, 0x7d, 0x6b, 0x2d, 0x04, 0x34, 0x08, 0x13, 0x04, 0x32, 0x04, 0x2c, 0x04, 
-	0x96, 0x4e, 0x30, 0x42, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x7b, 0xbe, 0x77, 0xde, 0x73, 0xf1, 0x35, 0x7d, 0x63, 0x5c, 0x5b, 0x5e, 0x57, 
-	0x3e, 0x57, 0x3d, 0x57, 0x3e, 0x57, 0xbc, 0x42, 0xff, 0x4a, 0x9a, 0x42, 0x97, 0x4a, 0x35, 0x21, 
-	0x5e, 0x29, 0xde, 0x18, 0x9e, 0x14, 0xbe, 0x18, 0xbb, 0x18, 0x94, 0x10, 0x55, 0x46, 0xdf, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x5a, 0x67, 0x74, 0x4a, 0x7b, 0x67, 0xf7, 0x56, 0xef, 0x35, 0x8c, 0x29, 0x4a, 0x21, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xff, 0x7b, 0x7c, 0x6f, 
-	0x39, 0x67, 0xb5, 0x52, 0x94, 0x4e, 0x72, 0x4a, 0xb4, 0x52, 0x09, 0x1d, 0x35, 0x3e, 0x38, 0x3e, 
-	0xd8, 0x31, 0xba, 0x31, 0x58, 0x25, 0x59, 0x29, 0x93, 0x14, 0x7a, 0x4a, 0x7c, 0x6b, 0xbd, 0x77, 
-	0xde, 0x77, 0xfe, 0x73, 0xde, 0x77, 0xff, 0x7b, 0x93, 0x4e, 0xcc, 0x31, 0xac, 0x31, 0x10, 0x42, 
-	0xde, 0x7b, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xbd, 0x73, 0x18, 0x5b, 0x4e, 0x08, 0x12, 0x04, 0x12, 0x04, 0x33, 0x08, 0x4d, 0x08, 
-	0x5c, 0x67, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xff, 0x7b, 0x53, 0x46, 0x3b, 0x5f, 0x5d, 0x5f, 0x5d, 0x5b, 
-	0x5e, 0x57, 0x3d, 0x57, 0x3f, 0x57, 0x1e, 0x4f, 0xff, 0x4e, 0xfd, 0x4e, 0xd7, 0x56, 0xb7, 0x52, 
-	0xd3, 0x18, 0xf8, 0x1c, 0x96, 0x14, 0x93, 0x10, 0x70, 0x29, 0xf8, 0x5a, 0xdf, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0x9c, 0x6f, 0x11, 0x3a, 0x5a, 0x63, 0xef, 0x35, 0xac, 0x2d, 0xcc, 0x31, 0xab, 0x2d, 0x28, 0x21, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0x18, 0x5f, 
-	0xef, 0x39, 0xb5, 0x4e, 0x5b, 0x67, 0xde, 0x7b, 0xde, 0x77, 0xc7, 0x10, 0x3d, 0x5f, 0x1f, 0x57, 
-	0xff, 0x52, 0xbf, 0x4a, 0x9f, 0x46, 0x5f, 0x42, 0x37, 0x25, 0xd1, 0x18, 0x7f, 0x6f, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0x9d, 0x73, 0xad, 0x31, 0x72, 0x46, 0xce, 0x35, 0x9d, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0x9d, 0x6f, 0x16, 0x3e, 0x52, 0x08, 0x33, 0x04, 0x73, 0x0c, 0xcf, 0x18, 
-	0xbf, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0x9d, 0x6f, 0xd7, 0x4e, 0x7e, 0x63, 0x5e, 0x5b, 
-	0x5e, 0x5b, 0x3d, 0x57, 0x3d, 0x57, 0xdb, 0x4a, 0x1d, 0x4f, 0xfb, 0x4e, 0xf8, 0x5e, 0xbe, 0x77, 
-	0x9d, 0x6f, 0x3a, 0x5f, 0x3b, 0x67, 0x9e, 0x73, 0xff, 0x7b, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xff, 0x7b, 
-	0x10, 0x3e, 0x5b, 0x67, 0xce, 0x31, 0x69, 0x21, 0x48, 0x21, 0x48, 0x21, 0x69, 0x25, 0x0f, 0x3a, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xcf, 0x35, 0xb6, 0x52, 
-	0x7c, 0x63, 0x7c, 0x63, 0x95, 0x4a, 0x74, 0x4e, 0xff, 0x7f, 0x3b, 0x63, 0x77, 0x42, 0x3f, 0x57, 
-	0xff, 0x4e, 0xdf, 0x4a, 0xbf, 0x4a, 0x5f, 0x3e, 0xfd, 0x39, 0x93, 0x0c, 0x1e, 0x5f, 0xde, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xcd, 0x31, 0x70, 0x42, 0xcd, 0x31, 0x7b, 0x6b, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x75, 0x4a, 0x74, 0x2d, 0xf3, 0x1c, 0xaf, 0x14, 0x3c, 0x63, 
-	0xbd, 0x73, 0xbc, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xdf, 0x7b, 0x74, 0x4e, 0x32, 0x3e, 0x1b, 0x57, 0x5e, 0x5b, 
-	0x5e, 0x5b, 0x3d, 0x57, 0x5d, 0x57, 0x1d, 0x53, 0x5e, 0x5b, 0xd0, 0x2d, 0xde, 0x73, 0xde, 0x77, 
-	0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xf8, 0x5e, 
-	0xf7, 0x56, 0xb5, 0x4e, 0x6a, 0x25, 0x8a, 0x25, 0x48, 0x21, 0x48, 0x21, 0x28, 0x1d, 0x39, 0x63, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xb5, 0x52, 0x75, 0x4a, 0x7d, 0x67, 
-	0x9d, 0x67, 0x7d, 0x63, 0x7d, 0x67, 0xf8, 0x56, 0xaf, 0x31, 0x3b, 0x5f, 0x5e, 0x63, 0x3e, 0x53, 
-	0xfe, 0x4a, 0xbe, 0x42, 0x9f, 0x42, 0x7f, 0x42, 0xde, 0x35, 0xb6, 0x18, 0x1d, 0x5f, 0xde, 0x77, 
-	0xbe, 0x77, 0x7b, 0x6f, 0x6b, 0x29, 0x10, 0x3a, 0xcb, 0x2d, 0x39, 0x63, 0xdd, 0x73, 0xdd, 0x73, 
-	0xde, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x5b, 0x67, 0x3b, 0x63, 0xbe, 0x6f, 0xde, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x9d, 0x67, 0x7d, 0x63, 
-	0x3d, 0x57, 0x3e, 0x57, 0x5e, 0x57, 0xfc, 0x4e, 0x98, 0x46, 0x3a, 0x63, 0xde, 0x77, 0xde, 0x77, 
-	0xbf, 0x73, 0xbf, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x7b, 0x32, 0x42, 
-	0x5a, 0x63, 0x6a, 0x25, 0x69, 0x25, 0x68, 0x21, 0x47, 0x21, 0x49, 0x25, 0xee, 0x39, 0xde, 0x73, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x8d, 0x2d, 0x33, 0x42, 0x9d, 0x67, 
-	0x9d, 0x67, 0x7d, 0x67, 0x7d, 0x63, 0xbf, 0x6b, 0x75, 0x42, 0x96, 0x46, 0xfd, 0x52, 0x3f, 0x57, 
-	0xfe, 0x4a, 0x9e, 0x46, 0x5f, 0x3e, 0x3f, 0x42, 0xff, 0x39, 0xd2, 0x18, 0xdf, 0x77, 0xde, 0x77, 
-	0xd6, 0x56, 0x48, 0x21, 0x0d, 0x3a, 0x6b, 0x29, 0x7a, 0x6b, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbf, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x6f, 0x32, 0x3e, 
-	0x3c, 0x5f, 0x3d, 0x57, 0x5d, 0x5b, 0xfa, 0x52, 0x95, 0x4e, 0xdf, 0x77, 0xdf, 0x77, 0xbe, 0x73, 
-	0xbe, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0x18, 0x5f, 0xd7, 0x56, 
-	0xd6, 0x52, 0x69, 0x25, 0x48, 0x21, 0x47, 0x21, 0x48, 0x21, 0x6a, 0x25, 0x9b, 0x6b, 0xbd, 0x73, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9d, 0x6b, 0x7d, 0x67, 0x7d, 0x67, 
-	0x7d, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0x7e, 0x5f, 0x9f, 0x63, 0x5e, 0x5f, 0x78, 0x42, 
-	0x9a, 0x42, 0x5f, 0x42, 0x1f, 0x3e, 0x1e, 0x3e, 0x35, 0x21, 0x3c, 0x63, 0xdf, 0x77, 0xbe, 0x73, 
-	0xf9, 0x5a, 0x1b, 0x5f, 0x95, 0x4a, 0x9c, 0x6f, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x7c, 0x6f, 
-	0x32, 0x42, 0x4d, 0x1d, 0x2c, 0x1d, 0xb5, 0x52, 0xff, 0x7b, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x10, 0x3a, 0x7b, 0x67, 
-	0x30, 0x3a, 0xab, 0x29, 0x48, 0x21, 0x47, 0x21, 0x6a, 0x25, 0x73, 0x4a, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x7c, 0x67, 0x5c, 0x63, 0x5c, 0x63, 
-	0x9d, 0x67, 0x9d, 0x6b, 0x9d, 0x67, 0x9e, 0x67, 0x7f, 0x63, 0x7f, 0x63, 0xd9, 0x4e, 0x4e, 0x1d, 
-	0x3f, 0x57, 0x7f, 0x46, 0x3c, 0x3e, 0xef, 0x14, 0xba, 0x52, 0x7d, 0x6b, 0x75, 0x4e, 0x8d, 0x10, 
-	0x73, 0x0c, 0x35, 0x04, 0xf8, 0x1c, 0x37, 0x25, 0xfd, 0x5a, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xde, 0x73, 0xbd, 0x73, 
-	0xdf, 0x77, 0xbe, 0x73, 0xdf, 0x77, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9c, 0x6f, 0x53, 0x42, 0x39, 0x5f, 
-	0x69, 0x25, 0xaa, 0x2d, 0x69, 0x25, 0x49, 0x25, 0xef, 0x39, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x7c, 0x6b, 0x5c, 0x63, 0x5d, 0x63, 
-	0x9d, 0x67, 0x9d, 0x67, 0x7d, 0x67, 0x7d, 0x67, 0x3c, 0x5b, 0xf2, 0x35, 0x5d, 0x63, 0xfe, 0x52, 
-	0xdf, 0x4e, 0x3b, 0x3e, 0x33, 0x21, 0xd4, 0x18, 0xda, 0x3d, 0x0c, 0x00, 0x55, 0x10, 0x7d, 0x14, 
-	0x1b, 0x04, 0x5c, 0x0c, 0xbe, 0x18, 0x59, 0x0c, 0x74, 0x10, 0x5f, 0x6b, 0xde, 0x73, 0xdf, 0x77, 
-	0xbf, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbf, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xd6, 0x56, 0xf8, 0x56, 0x73, 0x46, 
-	0x27, 0x1d, 0x68, 0x25, 0x69, 0x25, 0xad, 0x31, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0x31, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x25, 0x10, 0x42, 
-	0x5a, 0x6b, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x32, 0x46, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x6b, 0x29, 0x73, 0x4a, 0x9c, 0x6f, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x5b, 0x67, 0x97, 0x4a, 0x5e, 0x63, 
-	0x7e, 0x63, 0x9e, 0x67, 0x7d, 0x67, 0x9e, 0x67, 0x33, 0x3e, 0x6e, 0x25, 0xd8, 0x4e, 0xfc, 0x56, 
-	0xdc, 0x52, 0x69, 0x00, 0x53, 0x25, 0x1f, 0x42, 0x3f, 0x2d, 0x9e, 0x18, 0x5c, 0x0c, 0x5e, 0x10, 
-	0x1c, 0x08, 0x3d, 0x0c, 0x7e, 0x14, 0x9c, 0x10, 0x12, 0x00, 0x1e, 0x63, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x6f, 0xbe, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x10, 0x3e, 0x7a, 0x67, 0xee, 0x35, 
-	0xac, 0x2d, 0x8b, 0x2d, 0x8c, 0x2d, 0x9c, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0x32, 0x46, 0x8c, 0x31, 0x7b, 0x6b, 0x5a, 0x67, 0x7b, 0x6f, 0x39, 0x63, 0x31, 0x42, 
-	0x42, 0x08, 0x5a, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x32, 0x46, 0x8c, 0x31, 
-	0x7b, 0x6b, 0x7b, 0x6b, 0x5b, 0x67, 0x18, 0x5f, 0x4a, 0x29, 0x8d, 0x31, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xf8, 0x5a, 0x73, 0x4a, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0x39, 0x63, 0x7c, 0x6b, 0xbe, 0x73, 0xbe, 0x73, 0xf7, 0x5a, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9d, 0x6f, 0x6d, 0x25, 0x3c, 0x5f, 
-	0x7d, 0x67, 0x9d, 0x6b, 0x9e, 0x6b, 0x7d, 0x67, 0x54, 0x42, 0x9e, 0x6b, 0x1c, 0x57, 0xdb, 0x52, 
-	0x92, 0x2d, 0x3d, 0x42, 0x1f, 0x42, 0x9f, 0x31, 0x1f, 0x25, 0x9e, 0x14, 0x3d, 0x0c, 0x3e, 0x10, 
-	0x1b, 0x0c, 0x7c, 0x14, 0x3d, 0x0c, 0x7c, 0x14, 0x2f, 0x04, 0x1a, 0x5f, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xcf, 0x35, 0x18, 0x5b, 0x8c, 0x2d, 
-	0x8b, 0x2d, 0x8c, 0x2d, 0x9c, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0x32, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 
-	0x6b, 0x29, 0x31, 0x46, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x32, 0x46, 0xce, 0x35, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x18, 0x5f, 0x00, 0x00, 0x9c, 0x6f, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x73, 0x4a, 0x73, 0x4a, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x95, 0x4e, 0xcf, 0x35, 
-	0xb6, 0x52, 0x74, 0x4a, 0x53, 0x42, 0x6d, 0x25, 0x7e, 0x67, 0x7e, 0x63, 0x55, 0x3e, 0x3e, 0x5b, 
-	0xd4, 0x31, 0xce, 0x10, 0x1c, 0x3a, 0xdf, 0x35, 0x3f, 0x2d, 0xbe, 0x1c, 0x3c, 0x08, 0x3c, 0x08, 
-	0x3b, 0x0c, 0x5c, 0x0c, 0x5d, 0x10, 0x56, 0x10, 0x71, 0x29, 0xdf, 0x77, 0xff, 0x7b, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0x10, 0x3e, 0x94, 0x4e, 0x6b, 0x29, 
-	0x6b, 0x29, 0x9c, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0x31, 0x46, 0xce, 0x35, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0x31, 0x42, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0x08, 0x21, 0xf7, 0x5a, 0x31, 0x46, 0xc6, 0x18, 
-	0xbd, 0x73, 0xbe, 0x77, 0xb6, 0x56, 0x6b, 0x2d, 0x85, 0x10, 0x8c, 0x2d, 0xf7, 0x5a, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0x5a, 0x67, 0xef, 0x3d, 0x08, 0x1d, 0xe7, 0x18, 0xef, 0x3d, 0x5a, 0x67, 
-	0xde, 0x77, 0xde, 0x77, 0x5b, 0x67, 0xf0, 0x3d, 0x08, 0x1d, 0xe7, 0x18, 0xef, 0x39, 0x5a, 0x67, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x32, 0x46, 0xce, 0x35, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xf7, 0x5a, 0x84, 0x10, 0xbd, 0x6f, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x10, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x7b, 0x6b, 0xbe, 0x73, 0xb5, 0x52, 0x4b, 0x29, 0x84, 0x10, 0x6b, 0x29, 0xb5, 0x52, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x9d, 0x6f, 0x31, 0x42, 
-	0xa5, 0x14, 0x29, 0x25, 0xb6, 0x52, 0xb5, 0x52, 0x8c, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xc6, 0x18, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x09, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xf0, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x6b, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 
-	0x39, 0x67, 0xb6, 0x52, 0xf8, 0x56, 0xbf, 0x6f, 0x7d, 0x63, 0x7f, 0x63, 0x91, 0x29, 0xbb, 0x4a, 
-	0xde, 0x4e, 0xbd, 0x4a, 0x37, 0x21, 0x7f, 0x35, 0xfc, 0x20, 0xbd, 0x1c, 0x5d, 0x0c, 0x5e, 0x10, 
-	0x3e, 0x0c, 0x5e, 0x0c, 0x5d, 0x0c, 0x54, 0x10, 0xcf, 0x18, 0xbf, 0x77, 0xbe, 0x77, 0xdf, 0x7b, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0x7c, 0x67, 0xd8, 0x56, 0x34, 0x3e, 0xf4, 0x39, 0x58, 0x46, 0x5e, 0x67, 
-	0xbf, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9d, 0x6f, 0x7b, 0x6b, 0x52, 0x42, 0x6b, 0x25, 0xac, 0x31, 
-	0x9c, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0x31, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xad, 0x31, 0x31, 0x42, 0xde, 0x73, 0xde, 0x73, 0x2a, 0x25, 0xce, 0x35, 0x73, 0x4e, 0x39, 0x63, 
-	0xbe, 0x77, 0xb5, 0x56, 0xe7, 0x1c, 0x39, 0x63, 0x9c, 0x73, 0x18, 0x63, 0xa5, 0x14, 0xf7, 0x5e, 
-	0xde, 0x73, 0xbd, 0x73, 0xe7, 0x1c, 0x94, 0x52, 0x9c, 0x6f, 0x9c, 0x6f, 0xb5, 0x52, 0xa5, 0x14, 
-	0xbd, 0x73, 0xbe, 0x73, 0xe7, 0x1c, 0x94, 0x4e, 0x9d, 0x6f, 0x9d, 0x6f, 0xb5, 0x52, 0xa5, 0x14, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x32, 0x46, 0x8c, 0x2d, 
-	0x5b, 0x67, 0x5b, 0x67, 0x5a, 0x67, 0xf7, 0x5a, 0x08, 0x21, 0xd7, 0x56, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xcf, 0x39, 0x73, 0x4a, 0xbe, 0x73, 
-	0xde, 0x73, 0x74, 0x4a, 0x09, 0x21, 0x3a, 0x63, 0x9d, 0x6f, 0x39, 0x63, 0xe7, 0x1c, 0x95, 0x52, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x10, 0x3e, 0x6b, 0x29, 
-	0x5b, 0x67, 0x9c, 0x6f, 0x95, 0x4e, 0x4a, 0x29, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xc6, 0x18, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x09, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xcf, 0x39, 0x53, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0x53, 0x42, 0x9e, 0x67, 0x7d, 0x63, 0x5c, 0x5f, 0x5e, 0x5f, 0x3e, 0x5b, 0xdd, 0x4e, 
-	0xdf, 0x4e, 0x9d, 0x46, 0x8f, 0x10, 0x5a, 0x46, 0x4c, 0x08, 0xdc, 0x18, 0x5e, 0x10, 0x7d, 0x14, 
-	0x3b, 0x10, 0x5c, 0x0c, 0x9f, 0x14, 0x99, 0x14, 0xaf, 0x18, 0x9f, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xdd, 0x77, 
-	0xbd, 0x73, 0x19, 0x5f, 0xd2, 0x31, 0x79, 0x42, 0xbd, 0x4a, 0x3c, 0x3a, 0xfc, 0x35, 0xd1, 0x10, 
-	0x99, 0x4e, 0xbf, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xf8, 0x5a, 0xd7, 0x56, 0x6b, 0x25, 0x9c, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0x31, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0x9d, 0x73, 0xb5, 0x56, 
-	0x00, 0x00, 0x39, 0x63, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xad, 0x35, 0xde, 0x73, 0xde, 0x73, 
-	0xbd, 0x73, 0xc6, 0x18, 0xd6, 0x56, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0x94, 0x4e, 0x8c, 0x2d, 
-	0xde, 0x73, 0x7b, 0x6b, 0x00, 0x00, 0x5a, 0x67, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0x7c, 0x6b, 
-	0xbe, 0x77, 0x7c, 0x6b, 0x00, 0x00, 0x5b, 0x67, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0x7c, 0x6b, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0x32, 0x46, 0x63, 0x0c, 
-	0x29, 0x21, 0x29, 0x21, 0x08, 0x21, 0x00, 0x00, 0x11, 0x42, 0x7b, 0x6b, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xde, 0x73, 
-	0xbd, 0x6f, 0x63, 0x0c, 0xd7, 0x56, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xb5, 0x52, 0xc7, 0x18, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x9d, 0x6f, 0x00, 0x00, 0xf8, 0x5a, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x6b, 0x2d, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xc6, 0x18, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x77, 
-	0x39, 0x67, 0xd8, 0x52, 0x5c, 0x5f, 0x5d, 0x63, 0x7e, 0x63, 0x7d, 0x5f, 0x5e, 0x5b, 0x1f, 0x53, 
-	0x9e, 0x46, 0x7e, 0x42, 0xb5, 0x31, 0x1b, 0x5f, 0x13, 0x3e, 0x5a, 0x2d, 0x7e, 0x14, 0x7d, 0x10, 
-	0x7e, 0x14, 0x5e, 0x0c, 0x9d, 0x14, 0x75, 0x14, 0xb9, 0x56, 0xde, 0x77, 0xff, 0x7b, 0xde, 0x77, 
-	0xdd, 0x77, 0xde, 0x77, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0x7b, 0x67, 0xaf, 0x2d, 0x1d, 0x57, 0xbc, 0x46, 0xbd, 0x42, 0x3c, 0x36, 0xfe, 0x31, 0x9c, 0x2d, 
-	0x4f, 0x08, 0xfc, 0x5e, 0xbe, 0x73, 0xbe, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xb6, 0x52, 0xce, 0x35, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0x32, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x25, 
-	0x18, 0x5f, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0x94, 0x4e, 0xde, 0x73, 0xde, 0x77, 
-	0x7b, 0x6b, 0x00, 0x00, 0x5a, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0x19, 0x63, 0x00, 0x00, 
-	0x9d, 0x73, 0xbd, 0x77, 0x8c, 0x31, 0x4b, 0x29, 0xd6, 0x56, 0x7b, 0x6b, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0x8c, 0x31, 0x4b, 0x29, 0xd7, 0x56, 0x7b, 0x6b, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xb6, 0x56, 0xa5, 0x14, 0x7b, 0x67, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xde, 0x73, 
-	0x5a, 0x67, 0x00, 0x00, 0x5b, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x39, 0x63, 0x00, 0x00, 
-	0x7c, 0x6b, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x5a, 0x67, 0x00, 0x00, 0x5b, 0x67, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x52, 0x46, 0xad, 0x31, 0xde, 0x73, 0xde, 0x73, 0xc7, 0x18, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x77, 
-	0xf8, 0x5e, 0x53, 0x42, 0x5c, 0x63, 0x5d, 0x5f, 0x3d, 0x5f, 0x5d, 0x5f, 0x5d, 0x5f, 0xfd, 0x52, 
-	0xbe, 0x46, 0x7e, 0x3e, 0x3c, 0x3e, 0x15, 0x42, 0xbd, 0x73, 0x71, 0x2d, 0x53, 0x0c, 0xba, 0x18, 
-	0x7b, 0x10, 0x5a, 0x0c, 0x94, 0x10, 0x76, 0x4e, 0xff, 0x7b, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x94, 0x4a, 
-	0xe8, 0x14, 0xb8, 0x4a, 0xfc, 0x4e, 0xfd, 0x4a, 0x9d, 0x42, 0x7d, 0x3e, 0x1f, 0x36, 0x7c, 0x25, 
-	0xf5, 0x1c, 0xda, 0x56, 0xbd, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xef, 0x39, 0x9d, 0x73, 0xbd, 0x6f, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0x32, 0x46, 0x8c, 0x31, 0x7b, 0x6f, 0x7b, 0x6b, 0x7b, 0x6b, 0x9c, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb5, 0x56, 0xde, 0x77, 0xde, 0x77, 
-	0x39, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x7c, 0x6f, 0xde, 0x73, 0x9d, 0x73, 0xb5, 0x52, 0x6b, 0x2d, 0x00, 0x00, 0x6b, 0x29, 0x19, 0x63, 
-	0xde, 0x77, 0xde, 0x77, 0x9d, 0x6f, 0xb5, 0x52, 0x6b, 0x2d, 0x00, 0x00, 0x6b, 0x29, 0x19, 0x63, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xad, 0x31, 0x52, 0x46, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xde, 0x73, 
-	0x39, 0x63, 0x00, 0x00, 0x7c, 0x6b, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x5a, 0x67, 0x00, 0x00, 
-	0x5b, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x39, 0x63, 0x00, 0x00, 0x7c, 0x6b, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x74, 0x4a, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xc6, 0x18, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x73, 0x4a, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x77, 
-	0xbe, 0x73, 0x5b, 0x63, 0xf8, 0x52, 0x3c, 0x5f, 0x5d, 0x63, 0x3e, 0x5f, 0x3d, 0x5b, 0x1d, 0x57, 
-	0xdf, 0x4e, 0x5d, 0x3a, 0x1d, 0x3a, 0x93, 0x2d, 0xdf, 0x77, 0xde, 0x77, 0x19, 0x5f, 0xfa, 0x5a, 
-	0x97, 0x52, 0x3b, 0x63, 0xbf, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xdf, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xf7, 0x5a, 0x3a, 0x5f, 
-	0x8d, 0x25, 0xfa, 0x52, 0xfd, 0x52, 0xde, 0x4e, 0x9d, 0x42, 0x9d, 0x42, 0x1e, 0x3a, 0xdf, 0x35, 
-	0x37, 0x21, 0xb8, 0x52, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xd6, 0x56, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x31, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb5, 0x56, 0xde, 0x77, 0xde, 0x77, 
-	0x5a, 0x67, 0x00, 0x00, 0x5a, 0x67, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0x7c, 0x6f, 0x74, 0x4e, 0x21, 0x04, 
-	0x7b, 0x6b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7c, 0x6f, 0x74, 0x4e, 0x21, 0x04, 
-	0x7b, 0x6b, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x31, 0x42, 0xce, 0x35, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xde, 0x73, 
-	0x5a, 0x67, 0x00, 0x00, 0x5b, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x19, 0x5f, 0x00, 0x00, 
-	0x7c, 0x6b, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x5a, 0x67, 0x00, 0x00, 0x7b, 0x6b, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x52, 0x46, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xe7, 0x18, 
-	0xd7, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x52, 0x46, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xd7, 0x56, 0x3b, 0x5f, 0x5c, 0x5f, 0x5c, 0x5f, 0x5c, 0x5f, 0x3d, 0x5f, 0xfd, 0x56, 
-	0xbe, 0x4a, 0x9f, 0x46, 0xfc, 0x31, 0xb2, 0x0c, 0x5f, 0x67, 0xdd, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xff, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xf8, 0x56, 0xf9, 0x56, 
-	0xb8, 0x4a, 0x1c, 0x57, 0x1c, 0x53, 0xdd, 0x4a, 0x9d, 0x3e, 0x5c, 0x3a, 0xfe, 0x31, 0x9f, 0x29, 
-	0x79, 0x29, 0xf8, 0x5a, 0xbd, 0x73, 0xde, 0x7b, 0xde, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x77, 0xbe, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0x31, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x4a, 0x29, 0xb5, 0x56, 0xde, 0x73, 0xde, 0x73, 
-	0xbd, 0x73, 0xa5, 0x14, 0xf7, 0x5e, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0x9c, 0x73, 0x5a, 0x67, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0x84, 0x10, 
-	0x18, 0x5f, 0x9d, 0x6f, 0x5b, 0x67, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0x84, 0x10, 
-	0x18, 0x5f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x32, 0x46, 0xce, 0x35, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x4a, 0x29, 0x52, 0x46, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x73, 0x4a, 0xde, 0x73, 
-	0xbd, 0x6f, 0x84, 0x10, 0xd7, 0x56, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x95, 0x4e, 0x08, 0x1d, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x9c, 0x6f, 0x00, 0x00, 0x18, 0x5f, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x29, 0x25, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x4b, 0x29, 
-	0xb5, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x6c, 0x2d, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x09, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0xcf, 0x39, 0x73, 0x4a, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xde, 0x73, 0xbe, 0x6f, 0x3b, 0x5f, 0x5c, 0x5f, 0x5c, 0x5f, 0x3c, 0x5b, 0x3c, 0x5b, 0x1d, 0x53, 
-	0xdd, 0x4a, 0x9d, 0x46, 0x7c, 0x42, 0xd5, 0x35, 0xbf, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7b, 0x67, 0xb7, 0x4e, 
-	0x1b, 0x57, 0x3d, 0x57, 0x3d, 0x57, 0xfe, 0x4e, 0xff, 0x4e, 0x9f, 0x46, 0xbc, 0x29, 0x7e, 0x29, 
-	0xf7, 0x1c, 0xf9, 0x5e, 0x9e, 0x6f, 0x97, 0x52, 0xb4, 0x35, 0x95, 0x31, 0x1d, 0x5f, 0xbf, 0x77, 
-	0xbf, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x73, 0xbe, 0x73, 0xdf, 0x77, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xbe, 0x77, 0x31, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb5, 0x56, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0x95, 0x52, 0x29, 0x25, 0x39, 0x63, 0x9d, 0x73, 0x7b, 0x6b, 0x31, 0x42, 0x73, 0x4a, 
-	0xde, 0x77, 0x5a, 0x67, 0x63, 0x0c, 0xf7, 0x5e, 0x9c, 0x6f, 0x9c, 0x6f, 0xd7, 0x56, 0x84, 0x10, 
-	0x7c, 0x6f, 0x5a, 0x67, 0x64, 0x0c, 0xf8, 0x5a, 0x9c, 0x6f, 0x9c, 0x6f, 0xd6, 0x56, 0x84, 0x10, 
-	0x7c, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x32, 0x46, 0x8c, 0x31, 
-	0x7b, 0x6b, 0x7b, 0x6b, 0x7b, 0x6b, 0x39, 0x63, 0x11, 0x42, 0x84, 0x10, 0x5b, 0x67, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x31, 0x42, 0xce, 0x35, 0x7c, 0x6b, 
-	0xbd, 0x6f, 0x74, 0x4e, 0x29, 0x21, 0x3a, 0x63, 0x9d, 0x6f, 0x19, 0x5f, 0xc7, 0x18, 0xd6, 0x56, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0x6b, 0x29, 
-	0x5a, 0x67, 0x7c, 0x6b, 0x73, 0x4a, 0x6b, 0x29, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x32, 0x46, 
-	0x6b, 0x2d, 0x5b, 0x67, 0x7b, 0x6b, 0x74, 0x4a, 0x8c, 0x2d, 0xce, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x11, 0x42, 0xae, 0x35, 0x7c, 0x6b, 0x9d, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0x9d, 0x6f, 0x5b, 0x63, 0xf9, 0x56, 0xb8, 0x4e, 0x1c, 0x57, 0xfa, 0x52, 0xfc, 0x4e, 
-	0xdd, 0x4a, 0xbd, 0x4a, 0xd4, 0x2d, 0x1a, 0x5b, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0x9d, 0x73, 0x33, 0x42, 0x54, 0x46, 0xd7, 0x52, 0xd6, 0x52, 0x7c, 0x6b, 0x74, 0x46, 
-	0x7e, 0x63, 0x1c, 0x57, 0x3d, 0x57, 0xfe, 0x4e, 0xdc, 0x46, 0xdf, 0x4a, 0xff, 0x31, 0x1f, 0x3a, 
-	0xd3, 0x18, 0x13, 0x3e, 0x6d, 0x08, 0x57, 0x0c, 0x38, 0x0c, 0x77, 0x0c, 0x31, 0x04, 0x76, 0x2d, 
-	0x5e, 0x6b, 0xbf, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xdd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0x32, 0x46, 0xce, 0x35, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x4a, 0x29, 0xb5, 0x56, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x77, 0xd6, 0x56, 0x6b, 0x2d, 0x63, 0x0c, 0x2a, 0x25, 0x73, 0x4a, 0x9c, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0x18, 0x63, 0xce, 0x35, 0xc6, 0x18, 0xe7, 0x1c, 0xef, 0x39, 0x3a, 0x67, 
-	0xde, 0x77, 0xde, 0x77, 0x19, 0x5f, 0xce, 0x35, 0xc7, 0x18, 0xe7, 0x1c, 0xef, 0x39, 0x3a, 0x67, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x32, 0x46, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x25, 0x31, 0x42, 0x7b, 0x67, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x3a, 0x63, 0x29, 0x21, 0x29, 0x21, 
-	0x5a, 0x63, 0xbe, 0x73, 0xb5, 0x52, 0x4a, 0x29, 0x64, 0x0c, 0x6c, 0x2d, 0xd7, 0x56, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0x9c, 0x6f, 0x10, 0x3e, 
-	0xa5, 0x14, 0x29, 0x25, 0xb6, 0x52, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6b, 
-	0x10, 0x3e, 0xc6, 0x18, 0x4a, 0x25, 0xd7, 0x56, 0xb5, 0x52, 0xae, 0x35, 0xbe, 0x73, 0xbe, 0x73, 
-	0x29, 0x21, 0xd6, 0x56, 0xbe, 0x73, 0xbe, 0x73, 0x3a, 0x63, 0x09, 0x21, 0x09, 0x21, 0x3a, 0x63, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x73, 0xf8, 0x5a, 0xd7, 0x56, 0x95, 0x4a, 0x76, 0x46, 0x3c, 0x5f, 0x3e, 0x5b, 
-	0xfd, 0x4e, 0x38, 0x3e, 0x97, 0x4e, 0xdf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xdf, 0x77, 0x32, 0x42, 0x5b, 0x63, 0x7d, 0x63, 0x7d, 0x63, 0x9e, 0x67, 0xb6, 0x4e, 0x54, 0x3e, 
-	0x56, 0x3e, 0x3e, 0x57, 0x3e, 0x53, 0xfd, 0x4a, 0xbe, 0x46, 0x5f, 0x3e, 0x9e, 0x25, 0xbd, 0x2d, 
-	0x8e, 0x0c, 0x94, 0x14, 0x7a, 0x10, 0x3c, 0x08, 0x5e, 0x0c, 0x5b, 0x0c, 0x5b, 0x0c, 0x7a, 0x10, 
-	0x4f, 0x0c, 0xdd, 0x5a, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0x5f, 0x67, 
-	0x7e, 0x67, 0x9e, 0x73, 0xdf, 0x7b, 0x9d, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x7b, 0x67, 0x74, 0x4a, 0x12, 0x3a, 
-	0xd9, 0x56, 0x5c, 0x63, 0xdf, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 
-	0x18, 0x5f, 0x19, 0x5b, 0x3b, 0x5f, 0x5c, 0x5f, 0x5d, 0x5f, 0x5d, 0x5f, 0x7d, 0x63, 0xf9, 0x52, 
-	0xb2, 0x29, 0x9a, 0x46, 0x1e, 0x57, 0xfe, 0x4a, 0xbc, 0x46, 0x32, 0x1d, 0x9b, 0x25, 0x78, 0x25, 
-	0xb3, 0x14, 0xdc, 0x1c, 0x9d, 0x14, 0x5b, 0x08, 0x3c, 0x08, 0x5d, 0x0c, 0x5e, 0x0c, 0x5d, 0x0c, 
-	0x56, 0x0c, 0x6e, 0x10, 0x7e, 0x6f, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0x7c, 0x6b, 0xd4, 0x2d, 0x7e, 0x42, 
-	0x1b, 0x36, 0x8a, 0x08, 0xcd, 0x1c, 0xb7, 0x35, 0x09, 0x00, 0x13, 0x42, 0x3a, 0x63, 0xdf, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x94, 0x4e, 0xad, 0x31, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xdf, 0x7b, 
-	0x2a, 0x25, 0xf8, 0x5a, 0x7c, 0x67, 0x7d, 0x67, 0x7d, 0x67, 0x7d, 0x67, 0x7e, 0x63, 0x9e, 0x63, 
-	0x7e, 0x63, 0x3e, 0x5b, 0x1d, 0x57, 0x15, 0x2e, 0x77, 0x3e, 0xf9, 0x35, 0xfe, 0x31, 0xde, 0x2d, 
-	0x5f, 0x29, 0x9e, 0x14, 0x7e, 0x0c, 0x3d, 0x08, 0x3d, 0x08, 0x3c, 0x08, 0x5d, 0x08, 0x7d, 0x10, 
-	0xb8, 0x14, 0x0a, 0x00, 0x5c, 0x67, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0x11, 0x42, 0xba, 0x46, 0xbf, 0x42, 
-	0x5f, 0x3a, 0xdc, 0x35, 0x3c, 0x2d, 0x1f, 0x29, 0x9c, 0x14, 0xda, 0x1c, 0x70, 0x0c, 0x57, 0x4a, 
-	0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0x7c, 0x6b, 0x9d, 0x6b, 0x7c, 0x63, 0x7d, 0x67, 0x9d, 0x67, 0x9e, 0x67, 0x7e, 0x67, 0x7e, 0x63, 
-	0x5d, 0x5f, 0x5e, 0x5f, 0xf2, 0x31, 0xca, 0x10, 0x5a, 0x3a, 0xba, 0x29, 0xd2, 0x0c, 0x17, 0x15, 
-	0x9f, 0x29, 0xfe, 0x14, 0xbe, 0x10, 0x5d, 0x0c, 0x3b, 0x08, 0x3d, 0x0c, 0x3c, 0x08, 0x5b, 0x0c, 
-	0x0f, 0x04, 0x55, 0x4a, 0xdf, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x7b, 0xb8, 0x52, 0xdd, 0x4e, 0x9e, 0x42, 
-	0xdf, 0x4e, 0x7c, 0x25, 0x3f, 0x29, 0x3f, 0x29, 0x9f, 0x10, 0x9d, 0x14, 0x99, 0x14, 0x0b, 0x00, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0x5a, 0x67, 0x18, 0x57, 0x7d, 0x67, 0x7c, 0x67, 0x7d, 0x67, 0x7d, 0x63, 0x7e, 0x67, 0x9f, 0x67, 
-	0x9f, 0x63, 0x5e, 0x5b, 0x7e, 0x63, 0xfb, 0x52, 0x18, 0x36, 0xd9, 0x29, 0x77, 0x25, 0xbd, 0x2d, 
-	0x9f, 0x29, 0x5f, 0x1d, 0xbd, 0x14, 0x5d, 0x10, 0x3c, 0x08, 0x1b, 0x04, 0x1c, 0x04, 0x5a, 0x0c, 
-	0x4d, 0x04, 0xb1, 0x35, 0xdf, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xfe, 0x77, 0xf9, 0x5a, 0x9b, 0x42, 0x7f, 0x3e, 
-	0x7f, 0x3e, 0xff, 0x31, 0xdf, 0x31, 0x3e, 0x1d, 0xbe, 0x14, 0x9e, 0x14, 0xbe, 0x1c, 0x0f, 0x00, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x7b, 
-	0x8d, 0x2d, 0xbd, 0x6f, 0x7c, 0x67, 0x7d, 0x67, 0x7d, 0x67, 0x7c, 0x63, 0x5c, 0x63, 0x3b, 0x5b, 
-	0x6e, 0x21, 0x5e, 0x5b, 0xd1, 0x31, 0x7e, 0x63, 0x37, 0x36, 0x54, 0x21, 0x57, 0x21, 0xdc, 0x31, 
-	0x9d, 0x25, 0x3f, 0x21, 0xdd, 0x18, 0x5b, 0x0c, 0x1b, 0x08, 0x3d, 0x0c, 0x5d, 0x0c, 0x3c, 0x04, 
-	0xba, 0x14, 0x0a, 0x00, 0x7f, 0x6b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 
-	0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7b, 0x67, 0x99, 0x42, 0x9f, 0x42, 
-	0x5f, 0x3e, 0xbe, 0x2d, 0x9f, 0x29, 0x1f, 0x1d, 0xdf, 0x18, 0xdf, 0x18, 0x9d, 0x14, 0x0f, 0x00, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xdf, 0x77, 0xde, 0x73, 0x9c, 0x6f, 0xf8, 0x5a, 0xf7, 0x56, 0x94, 0x4e, 0x53, 0x46, 0x73, 0x4a, 
-	0x52, 0x46, 0x32, 0x42, 0x53, 0x46, 0x73, 0x46, 0xb6, 0x52, 0xf7, 0x56, 0x19, 0x5f, 0x94, 0x4e, 
-	0xf8, 0x5a, 0x3a, 0x63, 0x7b, 0x6b, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0xff, 0x7b, 
-	0xb5, 0x52, 0x9c, 0x6b, 0x9d, 0x6b, 0x9d, 0x67, 0x7d, 0x63, 0x5d, 0x5f, 0x7e, 0x67, 0x75, 0x46, 
-	0x1b, 0x57, 0x97, 0x46, 0x54, 0x3e, 0x9f, 0x67, 0x2e, 0x19, 0xdb, 0x4e, 0x29, 0x00, 0x54, 0x25, 
-	0x33, 0x19, 0x0b, 0x00, 0xb5, 0x14, 0x3b, 0x29, 0x19, 0x00, 0x3b, 0x04, 0x5d, 0x08, 0x5e, 0x10, 
-	0xf9, 0x20, 0x2f, 0x25, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0x9c, 0x6f, 0xbd, 0x73, 0xff, 0x7b, 0xde, 0x7b, 0xdf, 0x7b, 0x56, 0x42, 0x7f, 0x3e, 
-	0x5f, 0x3a, 0xbf, 0x2d, 0x5f, 0x21, 0xff, 0x18, 0x9f, 0x14, 0x7e, 0x14, 0x5b, 0x10, 0xcf, 0x18, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0x7b, 0x6b, 0x39, 0x63, 0xd7, 0x56, 
-	0x52, 0x42, 0xcf, 0x35, 0x2a, 0x21, 0x6c, 0x29, 0x2a, 0x21, 0xad, 0x31, 0x8d, 0x2d, 0x6b, 0x29, 
-	0xc6, 0x14, 0x08, 0x1d, 0x6b, 0x29, 0x10, 0x3e, 0x10, 0x3a, 0x11, 0x3e, 0x6b, 0x25, 0xce, 0x31, 
-	0xae, 0x31, 0xcf, 0x35, 0xf0, 0x39, 0xef, 0x39, 0x10, 0x3a, 0x53, 0x46, 0x95, 0x4e, 0x3a, 0x63, 
-	0x9c, 0x6f, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0x9c, 0x6f, 0x11, 0x3e, 0x7c, 0x67, 0x9d, 0x6b, 0x7d, 0x63, 0x5c, 0x5f, 0x75, 0x46, 0xb5, 0x4a, 
-	0x5d, 0x5b, 0xfc, 0x4e, 0x3d, 0x57, 0x3c, 0x5b, 0xa9, 0x08, 0x9d, 0x46, 0x3f, 0x3a, 0xbe, 0x31, 
-	0xde, 0x35, 0x59, 0x29, 0x29, 0x04, 0x36, 0x42, 0x1c, 0x3e, 0x99, 0x10, 0x3a, 0x08, 0x79, 0x10, 
-	0x0f, 0x21, 0x9d, 0x6f, 0xbe, 0x73, 0xfe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x53, 0x46, 
-	0x54, 0x42, 0xb7, 0x4e, 0x76, 0x42, 0x14, 0x3a, 0x96, 0x4e, 0xde, 0x77, 0x19, 0x5f, 0xf8, 0x2d, 
-	0x1f, 0x2e, 0x7f, 0x25, 0x1f, 0x1d, 0x9e, 0x14, 0xbf, 0x18, 0x9e, 0x14, 0x78, 0x10, 0xf9, 0x5a, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0x5b, 0x67, 0xd7, 0x56, 0x10, 0x3e, 0x6c, 0x29, 0x4b, 0x25, 0x2a, 0x21, 0x6b, 0x25, 
-	0xce, 0x35, 0xcf, 0x35, 0x8c, 0x29, 0x32, 0x42, 0x53, 0x46, 0xb6, 0x52, 0x7c, 0x6b, 0xf7, 0x5a, 
-	0xcd, 0x31, 0xee, 0x35, 0x94, 0x4e, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x9d, 0x6f, 0x7b, 0x6b, 
-	0x7b, 0x6b, 0x5b, 0x67, 0x3a, 0x63, 0x19, 0x5f, 0xd7, 0x56, 0x95, 0x4e, 0x53, 0x46, 0xcf, 0x35, 
-	0xcf, 0x35, 0xcf, 0x35, 0x53, 0x46, 0xd7, 0x56, 0x7b, 0x6b, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xde, 0x7b, 
-	0xde, 0x77, 0x9d, 0x6f, 0x19, 0x5f, 0x74, 0x4a, 0xb6, 0x52, 0xaf, 0x2d, 0x5b, 0x63, 0x9d, 0x67, 
-	0x5d, 0x5f, 0x1d, 0x53, 0x5e, 0x5b, 0x3d, 0x5b, 0x3e, 0x5b, 0xdf, 0x4e, 0x1f, 0x36, 0xff, 0x2d, 
-	0xdf, 0x29, 0x5f, 0x25, 0xd6, 0x18, 0x32, 0x25, 0xda, 0x5a, 0xf4, 0x35, 0x6f, 0x29, 0x96, 0x4e, 
-	0xbd, 0x73, 0xdd, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 
-	0xdf, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0x9c, 0x6f, 0xf0, 0x35, 0x3c, 0x5b, 
-	0x5d, 0x5f, 0x5d, 0x5b, 0x3e, 0x57, 0x5e, 0x57, 0xfc, 0x4e, 0xd1, 0x35, 0xdf, 0x77, 0x92, 0x25, 
-	0x1f, 0x36, 0x3e, 0x21, 0x9f, 0x31, 0x7d, 0x10, 0x5e, 0x08, 0x7c, 0x10, 0x94, 0x2d, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x77, 0xbd, 0x73, 0x7c, 0x6b, 0x39, 0x63, 0x74, 0x4a, 
-	0xad, 0x31, 0x6b, 0x25, 0xae, 0x31, 0xcf, 0x35, 0x73, 0x4a, 0xf7, 0x5a, 0x19, 0x5f, 0x5a, 0x67, 
-	0x7c, 0x6b, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x49, 0x25, 
-	0x51, 0x46, 0xc5, 0x10, 0x7b, 0x6b, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xdf, 0x77, 0xbe, 0x73, 0x7c, 0x6b, 0x19, 0x5f, 0x95, 0x4e, 0xcf, 0x39, 0x11, 0x42, 0xf7, 0x5a, 
-	0x7b, 0x6b, 0xdf, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0x9d, 0x6f, 0xb6, 0x4e, 0x7d, 0x63, 0x7e, 0x63, 
-	0x5d, 0x5f, 0x5e, 0x5b, 0x3d, 0x57, 0x3e, 0x5b, 0x5e, 0x5b, 0x1e, 0x53, 0x9f, 0x46, 0xde, 0x2d, 
-	0x5f, 0x3e, 0x9e, 0x29, 0x1b, 0x1d, 0xb1, 0x10, 0xbf, 0x77, 0xdf, 0x7b, 0xff, 0x7b, 0xdf, 0x7b, 
-	0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9e, 0x6f, 0xd9, 0x56, 
-	0xd9, 0x5a, 0x5d, 0x67, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0x32, 0x3e, 0x7d, 0x63, 0x3c, 0x5b, 
-	0x5d, 0x5b, 0x5e, 0x5b, 0x3d, 0x57, 0x3e, 0x53, 0x1e, 0x4f, 0xb9, 0x46, 0x31, 0x42, 0xcd, 0x14, 
-	0xfd, 0x31, 0x5e, 0x25, 0x1f, 0x25, 0xbe, 0x18, 0xbc, 0x18, 0xb1, 0x10, 0xbc, 0x52, 0x32, 0x21, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0x7b, 0x6b, 0x95, 0x4e, 0xcf, 0x35, 0x4b, 0x25, 0x08, 0x19, 0xce, 0x35, 0x53, 0x46, 
-	0xf7, 0x56, 0x3a, 0x63, 0x9d, 0x6f, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0x9d, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xac, 0x31, 
-	0xee, 0x39, 0xe7, 0x18, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xff, 0x7b, 0xbd, 0x73, 0x39, 0x63, 
-	0xb5, 0x52, 0xce, 0x35, 0x74, 0x4e, 0x39, 0x63, 0xbd, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xd6, 0x56, 0xf9, 0x56, 0x7e, 0x63, 0x5d, 0x5f, 
-	0x5c, 0x5f, 0x5d, 0x5f, 0x5d, 0x5f, 0x3d, 0x5b, 0x92, 0x25, 0xff, 0x52, 0xbf, 0x46, 0x3f, 0x3a, 
-	0x1f, 0x36, 0xdf, 0x31, 0x9d, 0x29, 0xf4, 0x1c, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xfe, 0x7b, 
-	0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0x0c, 0x21, 0x2b, 0x04, 
-	0x2c, 0x04, 0x09, 0x00, 0x0d, 0x21, 0x9e, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbd, 0x6f, 0x9d, 0x6f, 0xd7, 0x52, 0x5d, 0x5f, 0x3d, 0x5b, 
-	0x3d, 0x5b, 0x5d, 0x5b, 0x3d, 0x57, 0x3f, 0x57, 0x1f, 0x4f, 0xbc, 0x46, 0xae, 0x10, 0xfb, 0x35, 
-	0xbd, 0x2d, 0x7e, 0x29, 0x98, 0x14, 0x9c, 0x18, 0x53, 0x0c, 0x6f, 0x0c, 0x56, 0x0c, 0x39, 0x08, 
-	0xbd, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x77, 0xbd, 0x6f, 0xf7, 0x5a, 
-	0x10, 0x3e, 0x6c, 0x29, 0x10, 0x3a, 0x74, 0x4a, 0x39, 0x63, 0x9c, 0x6b, 0xdf, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x6a, 0x25, 
-	0x0f, 0x3e, 0x10, 0x3e, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xff, 0x7b, 0x9c, 0x6f, 0x39, 0x63, 0x94, 0x4e, 0x31, 0x42, 0xb5, 0x52, 0x39, 0x67, 
-	0xbd, 0x73, 0xde, 0x77, 0xbd, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0x9e, 0x6b, 0x5d, 0x5f, 0x7e, 0x67, 
-	0x7d, 0x67, 0x5e, 0x63, 0x5d, 0x5f, 0x7e, 0x67, 0x0c, 0x1d, 0x7b, 0x46, 0x9f, 0x46, 0x5e, 0x3a, 
-	0x1f, 0x36, 0xbf, 0x31, 0x16, 0x1d, 0x35, 0x46, 0xbf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x19, 0x5f, 0x6e, 0x0c, 0x30, 0x04, 
-	0x11, 0x00, 0x2f, 0x04, 0x0c, 0x04, 0xeb, 0x1c, 0x5c, 0x67, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0x53, 0x46, 0x5c, 0x5f, 0x5d, 0x5b, 
-	0x5e, 0x5b, 0x5e, 0x5f, 0x3e, 0x53, 0xbb, 0x3e, 0xfe, 0x46, 0xff, 0x4a, 0x3d, 0x36, 0x97, 0x25, 
-	0x77, 0x21, 0xba, 0x2d, 0x4d, 0x04, 0xf6, 0x1c, 0x0f, 0x00, 0x5b, 0x10, 0x1b, 0x04, 0x39, 0x04, 
-	0xde, 0x77, 0xbd, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xdf, 0x77, 0x9c, 0x6b, 0x94, 0x4a, 0x6c, 0x29, 0xce, 0x35, 
-	0x94, 0x4e, 0x7b, 0x67, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0x6a, 0x25, 
-	0xcc, 0x31, 0xd6, 0x56, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0x39, 0x63, 
-	0x94, 0x4e, 0x10, 0x3e, 0xf7, 0x5a, 0x7b, 0x6b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x74, 0x46, 0x7e, 0x67, 0x7d, 0x67, 
-	0x7d, 0x67, 0x5d, 0x5f, 0x5d, 0x5f, 0x3c, 0x5f, 0xb6, 0x52, 0x13, 0x3e, 0x18, 0x36, 0x7e, 0x3e, 
-	0x7f, 0x42, 0x1d, 0x3e, 0x52, 0x25, 0x9e, 0x6f, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x19, 0x5f, 0x4f, 0x08, 0x13, 0x00, 
-	0x13, 0x00, 0x11, 0x00, 0x2f, 0x08, 0x07, 0x00, 0xc9, 0x18, 0x7d, 0x6f, 0x9e, 0x6f, 0xde, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x11, 0x3e, 0x3b, 0x5b, 0x5d, 0x5f, 
-	0x5d, 0x5f, 0x5c, 0x5b, 0x5d, 0x5b, 0x3e, 0x53, 0xfd, 0x4a, 0x1f, 0x4f, 0x1b, 0x32, 0x3c, 0x36, 
-	0x9b, 0x29, 0x9f, 0x2d, 0x99, 0x14, 0xba, 0x18, 0x16, 0x04, 0x3a, 0x08, 0x19, 0x00, 0x19, 0x00, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0x9c, 0x73, 0xf7, 0x5a, 0xad, 0x31, 0x31, 0x42, 0x19, 0x5f, 0xbd, 0x6f, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xf7, 0x5a, 0x8b, 0x29, 
-	0x6b, 0x29, 0x5a, 0x67, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xff, 0x7b, 0xde, 0x77, 0x9c, 0x73, 0x10, 0x3e, 0x4a, 0x25, 0xee, 0x39, 0xb5, 0x52, 0x18, 0x5f, 
-	0xbd, 0x6f, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xf8, 0x5a, 0x3a, 0x5f, 0x9d, 0x6b, 
-	0x9e, 0x67, 0x9e, 0x67, 0x7c, 0x67, 0x12, 0x3e, 0xbe, 0x73, 0x7b, 0x6b, 0x08, 0x19, 0xcb, 0x14, 
-	0xb6, 0x35, 0x70, 0x2d, 0x7d, 0x6b, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x9c, 0x6f, 0x4f, 0x0c, 0x14, 0x00, 
-	0x12, 0x00, 0x0e, 0x00, 0x0d, 0x04, 0x0b, 0x00, 0x4d, 0x08, 0xab, 0x14, 0x3a, 0x63, 0xde, 0x73, 
-	0xbd, 0x6f, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7b, 0x6b, 0xd7, 0x52, 0x5c, 0x5f, 0x5d, 0x5f, 
-	0x5d, 0x5f, 0x5d, 0x5b, 0x3d, 0x57, 0x3e, 0x57, 0xfd, 0x4a, 0xbc, 0x46, 0x27, 0x00, 0x32, 0x1d, 
-	0x1d, 0x3a, 0x7e, 0x25, 0x3c, 0x21, 0x91, 0x10, 0x35, 0x08, 0x1b, 0x08, 0x1a, 0x00, 0x19, 0x00, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x5a, 0x67, 
-	0x52, 0x46, 0xe7, 0x18, 0xe6, 0x18, 0x7b, 0x6b, 0xdf, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xef, 0x39, 0x0f, 0x3e, 
-	0x6a, 0x25, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0x49, 0x21, 0xb4, 0x52, 0xee, 0x35, 0xce, 0x35, 0x51, 0x46, 0x4a, 0x25, 
-	0x10, 0x3a, 0x73, 0x4a, 0xbd, 0x73, 0xb6, 0x52, 0xae, 0x31, 0x94, 0x4e, 0x5a, 0x67, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xff, 0x7b, 0xf7, 0x5a, 0x95, 0x4a, 
-	0xb7, 0x4e, 0x33, 0x3e, 0x74, 0x46, 0xbd, 0x6f, 0xdf, 0x77, 0x49, 0x25, 0x38, 0x63, 0xc5, 0x10, 
-	0xb6, 0x4e, 0xdf, 0x77, 0xde, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xb1, 0x35, 0x32, 0x04, 
-	0x10, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x4a, 0x08, 0x2a, 0x04, 0xa8, 0x10, 0xf6, 0x56, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x33, 0x42, 0x9e, 0x6b, 0x5e, 0x5f, 
-	0x5e, 0x5b, 0x3d, 0x57, 0x3d, 0x57, 0x7e, 0x5f, 0x5e, 0x57, 0xff, 0x46, 0x7d, 0x3e, 0x5a, 0x3e, 
-	0x6c, 0x04, 0xf7, 0x18, 0x54, 0x08, 0xfc, 0x20, 0x3b, 0x0c, 0x1a, 0x04, 0x19, 0x00, 0x1a, 0x04, 
-	0xbd, 0x73, 0xbd, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xbd, 0x73, 0xd7, 0x56, 0x4b, 0x25, 0x94, 0x4e, 
-	0xac, 0x31, 0x6a, 0x29, 0x52, 0x46, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x9b, 0x6f, 0x6a, 0x29, 0xcd, 0x35, 
-	0xb5, 0x52, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0x18, 0x5b, 0xb3, 0x4e, 0x69, 0x25, 0xc6, 0x14, 0x7b, 0x6b, 0x7b, 0x6b, 
-	0xb5, 0x52, 0x52, 0x46, 0xce, 0x35, 0x19, 0x5f, 0x4b, 0x25, 0xce, 0x35, 0x10, 0x3e, 0xce, 0x35, 
-	0x73, 0x4a, 0xd6, 0x56, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0x5a, 0x67, 0x39, 0x63, 0x0e, 0x3a, 
-	0x48, 0x21, 0xbc, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdf, 0x77, 0xde, 0x77, 0x5a, 0x67, 0x2b, 0x04, 
-	0x33, 0x08, 0x0f, 0x04, 0x2c, 0x21, 0x85, 0x10, 0x64, 0x08, 0x28, 0x21, 0xd5, 0x56, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xd7, 0x5a, 0xaf, 0x2d, 0xd9, 0x52, 
-	0x1b, 0x57, 0x1c, 0x53, 0x3c, 0x57, 0x76, 0x42, 0xb3, 0x25, 0xde, 0x46, 0xdf, 0x46, 0x72, 0x21, 
-	0x32, 0x21, 0xb0, 0x18, 0x71, 0x10, 0x2b, 0x04, 0x52, 0x08, 0x3a, 0x08, 0x3c, 0x08, 0x3b, 0x04, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0x7b, 0x67, 0x11, 0x3e, 0x4b, 0x25, 0xf7, 0x5a, 0xde, 0x77, 0xb4, 0x52, 
-	0xcd, 0x35, 0xa4, 0x10, 0x7b, 0x6b, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x72, 0x4a, 0xac, 0x31, 0x49, 0x21, 
-	0xbc, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x3a, 0x63, 0x2f, 0x3e, 0x69, 0x25, 0xad, 0x31, 0xde, 0x77, 0xbd, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xf7, 0x5a, 0xb5, 0x52, 0xef, 0x35, 
-	0x10, 0x3e, 0xce, 0x35, 0xce, 0x35, 0xb5, 0x52, 0x9c, 0x6f, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xd6, 0x56, 0x9c, 0x6f, 
-	0x06, 0x19, 0x18, 0x5f, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xdf, 0x7b, 0xf2, 0x39, 
-	0x4f, 0x08, 0x4e, 0x0c, 0x2b, 0x21, 0x6b, 0x29, 0x69, 0x25, 0xcd, 0x31, 0x52, 0x4a, 0xdf, 0x77, 
-	0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xff, 0x77, 0xde, 0x77, 
-	0x3a, 0x63, 0x8e, 0x29, 0xd0, 0x2d, 0xfa, 0x52, 0x3e, 0x57, 0xfe, 0x4a, 0xff, 0x4a, 0xdb, 0x2d, 
-	0x5d, 0x29, 0x31, 0x00, 0xda, 0x1c, 0xba, 0x18, 0x0a, 0x00, 0x2f, 0x04, 0x58, 0x0c, 0x3a, 0x08, 
-	0xbd, 0x73, 0xbd, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x73, 
-	0xd7, 0x56, 0x4a, 0x25, 0xce, 0x35, 0x19, 0x5f, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xe5, 0x14, 
-	0x50, 0x42, 0x4a, 0x25, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x9d, 0x6f, 0x9d, 0x6f, 0x7b, 0x6b, 0x6a, 0x29, 0xcc, 0x31, 0xb4, 0x4e, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0x94, 0x4a, 0xcc, 0x31, 0x69, 0x21, 0xd6, 0x56, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xdf, 0x77, 
-	0xbd, 0x73, 0x19, 0x5f, 0x52, 0x46, 0x8c, 0x2d, 0x8c, 0x29, 0x10, 0x3e, 0x18, 0x5f, 0xbd, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x38, 0x63, 
-	0xcc, 0x35, 0x6a, 0x29, 0xbc, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0x9d, 0x6f, 
-	0xb0, 0x35, 0xcf, 0x35, 0xc6, 0x10, 0x6a, 0x25, 0x8b, 0x29, 0xad, 0x31, 0x32, 0x46, 0xde, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x7b, 0xde, 0x7b, 
-	0x5a, 0x67, 0x19, 0x57, 0x7e, 0x63, 0x7e, 0x5f, 0x5d, 0x57, 0x3f, 0x57, 0xdf, 0x4a, 0x5f, 0x3e, 
-	0x5f, 0x21, 0x7d, 0x21, 0x7e, 0x25, 0x7d, 0x10, 0x57, 0x0c, 0x2e, 0x08, 0x10, 0x00, 0x14, 0x04, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0x7b, 0x6b, 0xd6, 0x56, 0x10, 0x3e, 0x73, 0x4a, 
-	0x3a, 0x63, 0xbe, 0x73, 0xff, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x9c, 0x6f, 0xac, 0x31, 
-	0x0f, 0x3e, 0x73, 0x4a, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xef, 0x39, 0xed, 0x35, 0x49, 0x25, 0x9c, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0x72, 0x46, 0xed, 0x31, 0x27, 0x1d, 0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x6f, 0x18, 0x5f, 0xef, 0x39, 0xe7, 0x18, 0x4a, 0x25, 
-	0x53, 0x4a, 0x5a, 0x67, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xb4, 0x52, 
-	0x38, 0x63, 0x48, 0x21, 0xd5, 0x52, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x73, 0xbd, 0x73, 0xdd, 0x73, 
-	0xf7, 0x5a, 0x94, 0x4e, 0xd6, 0x56, 0x30, 0x3e, 0xed, 0x35, 0x29, 0x21, 0x18, 0x5f, 0xde, 0x77, 
-	0xbe, 0x73, 0xbf, 0x73, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 
-	0x95, 0x4a, 0x9e, 0x67, 0x7e, 0x63, 0x7e, 0x5f, 0x7f, 0x5f, 0x3e, 0x57, 0xff, 0x4e, 0xff, 0x35, 
-	0x9d, 0x29, 0x7e, 0x29, 0x1f, 0x21, 0xbf, 0x18, 0x5d, 0x0c, 0x3a, 0x0c, 0x51, 0x08, 0x0c, 0x00, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 
-	0xbd, 0x73, 0x19, 0x5f, 0x73, 0x4a, 0x8d, 0x2d, 0xb5, 0x52, 0x5b, 0x67, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xb4, 0x4e, 0xee, 0x39, 
-	0x8c, 0x2d, 0x7b, 0x6b, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xb5, 0x52, 0xed, 0x35, 0xac, 0x31, 0xb5, 0x52, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x7b, 0x6b, 0x8a, 0x29, 0xaa, 0x2d, 0xb4, 0x4e, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x7b, 0x6b, 0xb5, 0x52, 
-	0xef, 0x39, 0x6b, 0x29, 0xad, 0x31, 0xf7, 0x5e, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 
-	0x3a, 0x63, 0x8b, 0x29, 0xac, 0x31, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbf, 0x77, 0xde, 0x77, 0xf6, 0x56, 0x8c, 0x29, 0x52, 0x42, 0x28, 0x1d, 0x93, 0x4e, 0xde, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0x3b, 0x5f, 0x7e, 0x63, 0x7e, 0x5f, 0x7e, 0x63, 0x3f, 0x5b, 0x3e, 0x4f, 0xff, 0x46, 0x3f, 0x3a, 
-	0x15, 0x19, 0xdd, 0x31, 0xfe, 0x20, 0x9f, 0x18, 0x5c, 0x08, 0x3c, 0x08, 0x3c, 0x08, 0x59, 0x0c, 
-	0xbd, 0x73, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x5b, 0x67, 0xd7, 0x56, 0xef, 0x35, 
-	0xef, 0x35, 0xf7, 0x56, 0x9c, 0x6f, 0xdf, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xdf, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x9c, 0x6f, 0xad, 0x31, 0x10, 0x3e, 
-	0xae, 0x31, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0x18, 0x5f, 0x6a, 0x25, 0xcd, 0x31, 0x29, 0x21, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xef, 0x39, 0xac, 0x31, 0x8a, 0x29, 0x9c, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xde, 0x77, 0x39, 0x63, 0x73, 0x4a, 0x8c, 0x2d, 0x4a, 0x25, 0xb6, 0x52, 0xbd, 0x73, 0xde, 0x77, 
-	0x10, 0x3e, 0xee, 0x35, 0x6a, 0x25, 0x38, 0x5f, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x31, 0x42, 0xd5, 0x52, 0x08, 0x1d, 0x9c, 0x6f, 
-	0xbd, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xdf, 0x7b, 
-	0x95, 0x4a, 0x3b, 0x5b, 0x5d, 0x5f, 0x5d, 0x5f, 0x5f, 0x5f, 0x3f, 0x57, 0x1f, 0x4f, 0x1d, 0x36, 
-	0xf5, 0x10, 0xbe, 0x2d, 0x3f, 0x21, 0x7e, 0x10, 0x7e, 0x14, 0x7d, 0x10, 0x3c, 0x04, 0x7d, 0x10, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x18, 0x5f, 0xf8, 0x5a, 0x7b, 0x6b, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xdd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xce, 0x35, 0x30, 0x42, 0x8b, 0x29, 
-	0x5b, 0x67, 0xde, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0x39, 0x63, 0xad, 0x31, 0xe6, 0x18, 0xcd, 0x35, 0xc6, 0x18, 0x5b, 0x67, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbf, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 
-	0x18, 0x5f, 0xac, 0x2d, 0xcd, 0x31, 0x59, 0x67, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x6f, 0xde, 0x77, 0x9d, 0x6f, 0x18, 0x5f, 0x8c, 0x2d, 0x2a, 0x21, 0x52, 0x46, 
-	0x94, 0x4e, 0x18, 0x5f, 0x6a, 0x29, 0xee, 0x35, 0xdd, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x19, 0x5f, 0xf7, 0x5a, 0x6a, 0x29, 0xb4, 0x4e, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 
-	0x9c, 0x6f, 0xb6, 0x52, 0x5b, 0x63, 0x5d, 0x5f, 0x7f, 0x63, 0x7e, 0x5f, 0xff, 0x4a, 0xfa, 0x31, 
-	0xf4, 0x18, 0xdf, 0x31, 0x1f, 0x1d, 0x9f, 0x14, 0x5e, 0x0c, 0x5d, 0x0c, 0x3b, 0x04, 0x7d, 0x10, 
-	0xbd, 0x73, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x6f, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xdf, 0x77, 0xbe, 0x73, 0xbd, 0x6f, 0xbe, 0x77, 0x94, 0x4e, 0xce, 0x35, 0x0f, 0x3e, 0x10, 0x3e, 
-	0xdf, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0x53, 0x4a, 
-	0x46, 0x21, 0xeb, 0x35, 0xec, 0x35, 0x69, 0x25, 0xd6, 0x56, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x6f, 
-	0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xdd, 0x73, 0xdf, 0x77, 0xbe, 0x73, 
-	0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0x7b, 0x6b, 
-	0x6a, 0x29, 0xcd, 0x31, 0x94, 0x4e, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x39, 0x63, 0x73, 0x4a, 
-	0x6b, 0x29, 0x8b, 0x2d, 0xac, 0x31, 0x9c, 0x6f, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdf, 0x77, 0x51, 0x42, 0x93, 0x4a, 0x28, 0x1d, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0x7c, 0x6b, 0x1a, 0x5b, 0x3d, 0x5b, 0x7e, 0x5f, 0x5e, 0x5b, 0x1e, 0x53, 0xf6, 0x39, 
-	0x53, 0x25, 0x5e, 0x25, 0xff, 0x1c, 0x7d, 0x10, 0x7d, 0x0c, 0x5d, 0x0c, 0x3c, 0x08, 0x5d, 0x10, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0x54, 0x42, 0x7f, 0x67, 
-	0xf4, 0x39, 0x1b, 0x5b, 0xbf, 0x73, 0x7c, 0x6b, 0x17, 0x5f, 0x51, 0x42, 0x4a, 0x29, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xef, 0x39, 0xce, 0x35, 
-	0x31, 0x42, 0xac, 0x2d, 0x50, 0x3e, 0xab, 0x2d, 0xf7, 0x5a, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xf8, 0x5a, 0xb6, 0x52, 
-	0xf0, 0x39, 0x5a, 0x67, 0xff, 0x7b, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0x95, 0x4e, 0x7b, 0x6b, 
-	0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbc, 0x6f, 0x8b, 0x2d, 
-	0xcd, 0x31, 0xac, 0x2d, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xff, 0x7b, 
-	0xcd, 0x35, 0x69, 0x25, 0xc4, 0x10, 0x29, 0x21, 0x53, 0x46, 0x39, 0x63, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xf7, 0x5a, 0xf7, 0x5a, 0x28, 0x1d, 
-	0xf7, 0x5a, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x7b, 
-	0xde, 0x7b, 0xbe, 0x73, 0xd9, 0x52, 0x5e, 0x5f, 0x7f, 0x5f, 0x7e, 0x5f, 0x14, 0x3a, 0x9d, 0x6f, 
-	0xbb, 0x52, 0x7c, 0x29, 0x1f, 0x1d, 0x1e, 0x1d, 0xfe, 0x1c, 0x5c, 0x0c, 0x5d, 0x0c, 0x3c, 0x08, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x56, 0x46, 0x1e, 0x57, 0x7e, 0x42, 
-	0x1d, 0x3e, 0x8d, 0x0c, 0x4c, 0x08, 0x1c, 0x5b, 0xde, 0x73, 0x5a, 0x63, 0x7b, 0x6b, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7b, 0x6b, 0x2a, 0x21, 0xc9, 0x14, 
-	0x8b, 0x10, 0x07, 0x00, 0xcf, 0x31, 0xcd, 0x35, 0x39, 0x63, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xd7, 0x56, 0x9d, 0x6b, 
-	0x7d, 0x6b, 0x74, 0x46, 0x95, 0x4e, 0xde, 0x77, 0xbd, 0x73, 0x33, 0x42, 0x7c, 0x6b, 0x13, 0x3a, 
-	0x7d, 0x6b, 0x6e, 0x29, 0xd7, 0x52, 0xdf, 0x77, 0x9c, 0x6f, 0xdd, 0x73, 0xcd, 0x35, 0xcc, 0x31, 
-	0xac, 0x2d, 0x9c, 0x6b, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0x5a, 0x67, 0xee, 0x35, 
-	0xaa, 0x29, 0xab, 0x2d, 0x38, 0x5f, 0x7c, 0x6f, 0x95, 0x52, 0x8c, 0x2d, 0xef, 0x35, 0x18, 0x5f, 
-	0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x6f, 0xbd, 0x73, 0x93, 0x4a, 0x51, 0x46, 
-	0xcd, 0x31, 0xff, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0x9e, 0x6b, 0x3b, 0x5b, 0x13, 0x36, 0xb8, 0x4e, 0x9d, 0x6f, 0xde, 0x77, 
-	0xb7, 0x56, 0xbb, 0x2d, 0x1f, 0x1d, 0x1f, 0x1d, 0xbd, 0x14, 0x7d, 0x14, 0x7e, 0x10, 0x7c, 0x10, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xb6, 0x52, 0x1e, 0x5b, 0xbf, 0x46, 0x7f, 0x3e, 
-	0x5f, 0x42, 0x17, 0x25, 0x9e, 0x39, 0xf7, 0x20, 0xba, 0x52, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0x9e, 0x6f, 0xab, 0x10, 0x72, 0x10, 
-	0x74, 0x10, 0x2d, 0x04, 0xea, 0x14, 0xee, 0x35, 0xb5, 0x52, 0xff, 0x7b, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdf, 0x77, 0x9c, 0x6f, 0x95, 0x4e, 0x9e, 0x6b, 
-	0x7d, 0x67, 0x9e, 0x67, 0xf8, 0x56, 0x5b, 0x63, 0xf9, 0x56, 0x9d, 0x67, 0x7e, 0x63, 0x92, 0x29, 
-	0xd7, 0x31, 0x1f, 0x57, 0x35, 0x3a, 0x5c, 0x5f, 0x7b, 0x67, 0xe6, 0x14, 0x50, 0x42, 0x8b, 0x29, 
-	0x9c, 0x6f, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0x49, 0x21, 0xcc, 0x31, 
-	0x27, 0x1d, 0x72, 0x4a, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0x94, 0x4e, 0x29, 0x21, 
-	0x8c, 0x2d, 0xb5, 0x52, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x52, 0x46, 0x17, 0x5b, 
-	0x08, 0x1d, 0x9b, 0x6b, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xff, 0x7b, 0xdf, 0x77, 0xdd, 0x77, 0xde, 0x77, 
-	0xbf, 0x73, 0x95, 0x29, 0x3b, 0x21, 0xfc, 0x1c, 0xd8, 0x18, 0x31, 0x04, 0x74, 0x0c, 0x50, 0x08, 
-	0xbd, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xdd, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xff, 0x77, 0x78, 0x46, 0xbf, 0x4e, 0xbf, 0x4a, 0x1e, 0x3a, 
-	0xff, 0x3d, 0x9f, 0x35, 0x3f, 0x2d, 0xd8, 0x1c, 0x6c, 0x08, 0x1d, 0x5f, 0xbf, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x1a, 0x63, 0x4f, 0x0c, 0x34, 0x08, 
-	0x34, 0x04, 0x53, 0x08, 0x29, 0x00, 0x4c, 0x25, 0x18, 0x63, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x73, 0x46, 0x53, 0x46, 0x19, 0x5b, 0x9e, 0x6b, 
-	0x7d, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0xf8, 0x56, 0x96, 0x4a, 0x9e, 0x67, 0x7d, 0x63, 0x9f, 0x67, 
-	0x1f, 0x5b, 0x3f, 0x57, 0x3e, 0x5b, 0xf5, 0x35, 0xb1, 0x31, 0x0e, 0x3a, 0x8b, 0x2d, 0x7b, 0x6b, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0x18, 0x5f, 0x0e, 0x3a, 0x2e, 0x3e, 
-	0x0f, 0x3e, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 
-	0xd6, 0x56, 0x29, 0x21, 0x6b, 0x29, 0xb5, 0x52, 0x9c, 0x6f, 0xde, 0x77, 0xbd, 0x6f, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xf7, 0x5a, 0xf7, 0x5a, 
-	0xef, 0x39, 0xd6, 0x56, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xbf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 
-	0xde, 0x73, 0x9d, 0x6f, 0xf9, 0x56, 0x77, 0x4a, 0xf9, 0x5a, 0x5b, 0x67, 0x3b, 0x63, 0xd7, 0x56, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0x18, 0x5b, 
-	0x12, 0x3e, 0x9d, 0x6f, 0xdf, 0x73, 0x9d, 0x6b, 0xfb, 0x4e, 0xdf, 0x4a, 0x5f, 0x42, 0xff, 0x3d, 
-	0x9f, 0x31, 0x5f, 0x31, 0x1f, 0x29, 0x5f, 0x31, 0x19, 0x25, 0xf0, 0x1c, 0xbf, 0x73, 0xbe, 0x73, 
-	0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0x90, 0x2d, 0x94, 0x10, 0x56, 0x08, 
-	0x15, 0x00, 0x35, 0x04, 0x30, 0x08, 0x2a, 0x25, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x94, 0x4a, 0xbd, 0x6f, 0x9d, 0x6b, 0x9d, 0x67, 
-	0x7d, 0x67, 0x9e, 0x67, 0x9e, 0x67, 0x9e, 0x6b, 0x5d, 0x63, 0x9e, 0x67, 0x9d, 0x67, 0x7d, 0x63, 
-	0x7e, 0x5f, 0x5e, 0x5b, 0x3f, 0x5b, 0x59, 0x42, 0xbf, 0x73, 0x62, 0x08, 0x7b, 0x6b, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x8b, 0x29, 0x71, 0x46, 0xac, 0x31, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 
-	0xde, 0x77, 0xbd, 0x73, 0xb5, 0x52, 0xcf, 0x35, 0x6b, 0x29, 0x52, 0x46, 0x9c, 0x6f, 0xde, 0x77, 
-	0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x9c, 0x6f, 0x52, 0x46, 
-	0xef, 0x39, 0x8b, 0x2d, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xdf, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0x39, 0x67, 0x7a, 0x6b, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x9d, 0x6f, 0xb7, 0x52, 
-	0x9f, 0x6f, 0x13, 0x3a, 0x13, 0x3a, 0xbe, 0x6f, 0xfe, 0x52, 0x9f, 0x42, 0x5f, 0x3e, 0xdf, 0x39, 
-	0x7f, 0x31, 0xff, 0x24, 0xdf, 0x24, 0x1f, 0x29, 0x1c, 0x25, 0xb0, 0x14, 0xbf, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0x9e, 0x6f, 0x6e, 0x0c, 0x56, 0x0c, 0x38, 0x08, 
-	0x37, 0x04, 0x34, 0x04, 0xcf, 0x14, 0x5b, 0x67, 0xde, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xd7, 0x52, 0x9d, 0x6b, 0x7d, 0x67, 0x9e, 0x6b, 
-	0x9e, 0x6b, 0x9e, 0x6b, 0x9e, 0x6b, 0x5d, 0x67, 0x7e, 0x67, 0x7e, 0x67, 0x9f, 0x67, 0x7e, 0x63, 
-	0x7e, 0x5f, 0x5f, 0x5b, 0x3e, 0x5b, 0x36, 0x3a, 0xbe, 0x6f, 0x9c, 0x6f, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0x18, 0x5f, 0xed, 0x35, 0xee, 0x35, 0x9c, 0x6f, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xb6, 0x52, 0x8c, 0x2d, 0xad, 0x31, 0x94, 0x4e, 
-	0x7b, 0x6b, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x10, 0x3e, 
-	0xee, 0x35, 0x69, 0x25, 0x7a, 0x67, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbf, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0x5a, 0x67, 0x52, 0x4a, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x9e, 0x6f, 0x7e, 0x67, 
-	0x1e, 0x5b, 0x7d, 0x46, 0xd6, 0x31, 0x1e, 0x57, 0xdf, 0x4e, 0x5f, 0x3e, 0x1f, 0x3a, 0x9f, 0x31, 
-	0x5f, 0x31, 0xff, 0x28, 0x3f, 0x2d, 0x1f, 0x25, 0x18, 0x25, 0xb9, 0x52, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0x5c, 0x67, 0x90, 0x10, 0x35, 0x08, 0x35, 0x04, 
-	0x15, 0x04, 0x31, 0x08, 0x1a, 0x5f, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x77, 0x95, 0x4e, 0x9d, 0x67, 0x9d, 0x67, 0x7d, 0x67, 
-	0x9e, 0x6b, 0xbf, 0x6f, 0xbf, 0x6b, 0x3a, 0x5f, 0x7d, 0x67, 0x9e, 0x6b, 0x9f, 0x6b, 0x9e, 0x67, 
-	0x7e, 0x5f, 0x3e, 0x57, 0x3f, 0x5b, 0x57, 0x46, 0xdf, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xbf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbd, 0x73, 
-	0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0x9c, 0x6f, 0xac, 0x31, 0x8b, 0x29, 0x9c, 0x6f, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0x39, 0x63, 0x52, 0x46, 
-	0xee, 0x35, 0xef, 0x39, 0x5b, 0x67, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0x52, 0x46, 
-	0x72, 0x46, 0x27, 0x1d, 0x38, 0x63, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xf7, 0x5a, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x7d, 0x67, 
-	0x1d, 0x53, 0xdf, 0x4a, 0xbf, 0x46, 0x7e, 0x3e, 0x9f, 0x42, 0x3f, 0x3a, 0xdf, 0x35, 0x9f, 0x35, 
-	0xff, 0x20, 0xff, 0x20, 0x3f, 0x29, 0x5c, 0x2d, 0xf4, 0x39, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x3a, 0x5f, 0x53, 0x25, 0x75, 0x10, 0x56, 0x0c, 
-	0x74, 0x10, 0xd2, 0x35, 0xde, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0x94, 0x4e, 0x9c, 0x6b, 0x9d, 0x6b, 0xbe, 0x6f, 
-	0x9e, 0x6b, 0xbe, 0x6b, 0xbe, 0x6b, 0x19, 0x5b, 0x5b, 0x63, 0x9e, 0x6f, 0x9f, 0x6f, 0x9f, 0x6b, 
-	0x7f, 0x63, 0x5d, 0x5b, 0xba, 0x4e, 0x3b, 0x5f, 0x7c, 0x67, 0x1b, 0x5f, 0xfb, 0x5e, 0x9f, 0x6f, 
-	0xde, 0x73, 0xdd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 
-	0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xcd, 0x35, 0xcc, 0x31, 0x39, 0x63, 0xbd, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x77, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0x5a, 0x67, 0xb5, 0x4e, 0x6b, 0x29, 0x10, 0x3e, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0x74, 0x4e, 
-	0x50, 0x42, 0x47, 0x21, 0x52, 0x46, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbf, 0x73, 0x9e, 0x67, 
-	0x5e, 0x5b, 0xdf, 0x46, 0x7f, 0x42, 0x7f, 0x42, 0x3f, 0x3a, 0x1f, 0x3a, 0xbf, 0x31, 0x5f, 0x2d, 
-	0x9f, 0x1c, 0xdf, 0x20, 0x1c, 0x25, 0x71, 0x2d, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0x18, 0x5f, 0xb1, 0x31, 0x51, 0x25, 0xaf, 0x10, 
-	0xd3, 0x35, 0x9d, 0x6f, 0xde, 0x77, 0xbf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x7b, 0x94, 0x4e, 0x7c, 0x6b, 0x9d, 0x6b, 
-	0x9e, 0x6b, 0x9e, 0x6b, 0x9e, 0x6b, 0xbe, 0x6b, 0x7d, 0x67, 0xbf, 0x6f, 0xbf, 0x6f, 0x9f, 0x6b, 
-	0x7f, 0x67, 0x3c, 0x5b, 0x0d, 0x15, 0xf7, 0x35, 0x38, 0x3e, 0xfb, 0x39, 0x38, 0x25, 0xf3, 0x1c, 
-	0x5e, 0x6b, 0xbe, 0x73, 0xbf, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0x9c, 0x73, 0xf0, 0x3d, 0xac, 0x31, 0x7b, 0x6b, 0xde, 0x77, 0xdd, 0x77, 0xbe, 0x77, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x6f, 0xde, 0x77, 0x9c, 0x6f, 0xce, 0x35, 0x6b, 0x2d, 0x10, 0x3e, 0x94, 0x4e, 0x18, 0x5f, 
-	0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xd6, 0x56, 
-	0x2f, 0x3e, 0xaa, 0x29, 0xcd, 0x35, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xbf, 0x73, 0x9e, 0x6b, 
-	0x7f, 0x5f, 0xff, 0x52, 0x9f, 0x4a, 0x3f, 0x3e, 0x5f, 0x42, 0x1e, 0x3a, 0xbf, 0x31, 0x1f, 0x25, 
-	0xff, 0x24, 0xb5, 0x18, 0x76, 0x4a, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xbf, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0x9c, 0x6f, 0x19, 0x5f, 
-	0xdf, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xd6, 0x56, 0x95, 0x4e, 0xcf, 0x35, 0x74, 0x46, 
-	0x5b, 0x63, 0xbf, 0x6f, 0xbe, 0x6f, 0xbe, 0x6b, 0x9e, 0x6b, 0x1b, 0x5b, 0x9e, 0x67, 0x7e, 0x67, 
-	0x1b, 0x5b, 0x91, 0x29, 0xfd, 0x4e, 0xbf, 0x4e, 0x5f, 0x42, 0xdf, 0x35, 0xbf, 0x35, 0xbc, 0x39, 
-	0x55, 0x29, 0xbf, 0x77, 0xbf, 0x77, 0xbe, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xdd, 0x73, 0xdd, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7b, 0x6b, 0x94, 0x4a, 
-	0x4a, 0x25, 0x07, 0x1d, 0x49, 0x25, 0x7b, 0x6b, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x77, 
-	0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x7b, 0x6b, 0x94, 0x4e, 0x8c, 0x31, 0xc7, 0x18, 
-	0x4a, 0x25, 0xad, 0x31, 0x73, 0x4a, 0x39, 0x63, 0xbd, 0x73, 0xdf, 0x77, 0xbe, 0x77, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xd7, 0x56, 
-	0x0e, 0x3a, 0xcb, 0x31, 0x6a, 0x29, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbf, 0x73, 0x7f, 0x67, 
-	0x5f, 0x5b, 0xff, 0x4e, 0xfb, 0x35, 0x1b, 0x3a, 0xd1, 0x14, 0x7b, 0x2d, 0x3f, 0x29, 0xfb, 0x20, 
-	0x33, 0x25, 0xdb, 0x5a, 0xb8, 0x52, 0x37, 0x42, 0x38, 0x46, 0x78, 0x4e, 0xfc, 0x5e, 0xbf, 0x73, 
-	0xbe, 0x6f, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0x9c, 0x6f, 0x53, 0x46, 0x9d, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0x9e, 0x6b, 
-	0x3a, 0x5f, 0xb6, 0x4e, 0x9e, 0x6b, 0x5c, 0x63, 0x95, 0x4a, 0xf8, 0x52, 0x9e, 0x6b, 0x3c, 0x5b, 
-	0x4e, 0x21, 0x3e, 0x5b, 0xfe, 0x4e, 0xdf, 0x4a, 0x3f, 0x3e, 0x1f, 0x3a, 0x5d, 0x25, 0x5c, 0x29, 
-	0x74, 0x29, 0xdf, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xdd, 0x73, 0xdf, 0x77, 0x9d, 0x6f, 0x95, 0x4e, 0xac, 0x2d, 0xaa, 0x2d, 0xed, 0x35, 
-	0xcd, 0x31, 0x8b, 0x29, 0x38, 0x63, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xf7, 0x5e, 
-	0x8c, 0x31, 0x6b, 0x29, 0x8b, 0x2d, 0x6a, 0x29, 0x4a, 0x25, 0xad, 0x31, 0x18, 0x5f, 0x5a, 0x67, 
-	0xbd, 0x73, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xb6, 0x52, 
-	0xab, 0x2d, 0xcb, 0x2d, 0x69, 0x25, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbf, 0x73, 0x5d, 0x5f, 
-	0xdc, 0x4e, 0x3a, 0x3a, 0x3c, 0x3e, 0xb9, 0x2d, 0x1e, 0x3e, 0x7f, 0x31, 0xfe, 0x24, 0x32, 0x08, 
-	0x90, 0x10, 0xb7, 0x18, 0x5b, 0x10, 0x7b, 0x10, 0x59, 0x10, 0x57, 0x10, 0x52, 0x08, 0x95, 0x2d, 
-	0x7e, 0x6b, 0xdf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdd, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xb6, 0x4e, 0xbe, 0x73, 0x9d, 0x6b, 0x9d, 0x6b, 0x9e, 0x6b, 0x7d, 0x67, 
-	0x9e, 0x6b, 0xbe, 0x6f, 0xb7, 0x52, 0xd7, 0x52, 0x9e, 0x6b, 0xbe, 0x6f, 0x3b, 0x5f, 0x98, 0x4a, 
-	0x7f, 0x67, 0x5f, 0x5f, 0x1f, 0x57, 0x9f, 0x46, 0x3f, 0x42, 0xbf, 0x35, 0xdf, 0x3d, 0xf8, 0x20, 
-	0x5d, 0x67, 0xdf, 0x77, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0x96, 0x4e, 0xcc, 0x18, 0x8f, 0x2d, 0xad, 0x2d, 0xeb, 0x31, 0x0c, 0x36, 
-	0xee, 0x35, 0xef, 0x39, 0xfe, 0x7b, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xdc, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbc, 0x73, 0x51, 0x46, 0x07, 0x1d, 0xe6, 0x18, 0x6b, 0x25, 0xad, 0x31, 0xad, 0x31, 
-	0xef, 0x39, 0x73, 0x4a, 0x39, 0x63, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xef, 0x39, 
-	0x30, 0x3e, 0xcb, 0x31, 0xac, 0x31, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0x7e, 0x63, 
-	0xf8, 0x31, 0x5e, 0x3e, 0x9f, 0x46, 0x7e, 0x46, 0xbe, 0x35, 0x5f, 0x31, 0xdf, 0x24, 0xbd, 0x20, 
-	0x9c, 0x1c, 0x9f, 0x1c, 0x3f, 0x0c, 0x3e, 0x0c, 0x1d, 0x08, 0x3c, 0x10, 0x39, 0x08, 0x13, 0x04, 
-	0x59, 0x46, 0xdf, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xbf, 0x77, 0xde, 0x73, 
-	0xbe, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0x18, 0x5f, 0x7b, 0x67, 0x9d, 0x6b, 0xbe, 0x6f, 0xbe, 0x6b, 0xbe, 0x6b, 0x7d, 0x67, 
-	0xbf, 0x6f, 0x9e, 0x6b, 0xd8, 0x52, 0x3b, 0x5f, 0x7d, 0x67, 0x3a, 0x5f, 0x55, 0x42, 0x9e, 0x6b, 
-	0x5e, 0x5f, 0x3f, 0x5b, 0xbf, 0x4a, 0x9f, 0x4a, 0xbf, 0x35, 0xbf, 0x39, 0x7e, 0x31, 0x58, 0x2d, 
-	0xbf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0x3b, 0x63, 0x2b, 0x04, 0x6f, 0x0c, 0x29, 0x04, 0xd0, 0x35, 0xad, 0x2d, 0x0e, 0x36, 
-	0x8a, 0x29, 0xf7, 0x5a, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xdd, 0x77, 0xdd, 0x77, 
-	0xbe, 0x77, 0xbe, 0x73, 0xbd, 0x6f, 0xdf, 0x77, 0x5e, 0x67, 0x3d, 0x63, 0xbf, 0x73, 0xbe, 0x73, 
-	0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xdd, 0x73, 0x31, 0x42, 0xac, 0x31, 0xac, 0x31, 0x72, 0x4a, 0x18, 0x5f, 0xf7, 0x56, 0xce, 0x31, 
-	0x31, 0x42, 0xef, 0x39, 0x52, 0x42, 0x52, 0x46, 0x95, 0x4e, 0x39, 0x63, 0xde, 0x77, 0x31, 0x42, 
-	0x0f, 0x3a, 0xaa, 0x2d, 0x28, 0x21, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xbf, 0x6b, 
-	0x1f, 0x57, 0x3e, 0x3a, 0xbf, 0x4a, 0x7f, 0x46, 0x5a, 0x25, 0xdc, 0x20, 0xbf, 0x20, 0x9f, 0x20, 
-	0xdf, 0x24, 0x9f, 0x1c, 0x3e, 0x0c, 0x3e, 0x0c, 0x1e, 0x08, 0x3d, 0x0c, 0x3b, 0x08, 0x17, 0x04, 
-	0x39, 0x42, 0xdf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0x53, 0x46, 0xbe, 0x73, 0xbe, 0x6b, 0xbf, 0x6f, 0xbe, 0x6f, 0xbe, 0x6f, 0x9e, 0x6b, 
-	0x9e, 0x67, 0x7d, 0x67, 0xbf, 0x6b, 0x1a, 0x57, 0x9d, 0x6b, 0xf8, 0x56, 0xd2, 0x31, 0x7f, 0x63, 
-	0x3e, 0x5b, 0x3f, 0x57, 0xdf, 0x4a, 0x9f, 0x4a, 0x1f, 0x42, 0x7f, 0x31, 0x3c, 0x29, 0x0e, 0x04, 
-	0x5e, 0x6b, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xcb, 0x18, 0x71, 0x10, 0x52, 0x08, 0x6d, 0x0c, 0x90, 0x2d, 0x27, 0x04, 0xf1, 0x39, 
-	0x6a, 0x29, 0x59, 0x67, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbd, 0x73, 0x9d, 0x6f, 0x51, 0x29, 0x95, 0x18, 0x71, 0x10, 0x37, 0x46, 0x9e, 0x6f, 
-	0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0x51, 0x46, 0xee, 0x39, 0x07, 0x19, 0xd5, 0x56, 0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 
-	0x9c, 0x6f, 0xb5, 0x52, 0xce, 0x35, 0x6b, 0x29, 0x6b, 0x29, 0x31, 0x42, 0xef, 0x39, 0x8c, 0x2d, 
-	0x0f, 0x3e, 0xed, 0x35, 0x31, 0x42, 0xdf, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x77, 0xdf, 0x77, 0xbf, 0x6b, 
-	0xff, 0x52, 0x9f, 0x42, 0xdf, 0x4a, 0x5f, 0x42, 0x1d, 0x21, 0x9f, 0x1c, 0x9f, 0x20, 0x9f, 0x20, 
-	0xdf, 0x28, 0x5f, 0x14, 0x3f, 0x0c, 0x3f, 0x08, 0x3e, 0x0c, 0x3e, 0x0c, 0x1c, 0x04, 0x37, 0x08, 
-	0x9a, 0x4e, 0xdf, 0x77, 0xdd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x7b, 0x39, 0x63, 0x74, 0x4a, 0xf8, 0x56, 0x9e, 0x6b, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 
-	0x7d, 0x67, 0x7e, 0x67, 0x9e, 0x67, 0x19, 0x5b, 0x95, 0x4e, 0x9e, 0x6b, 0x5d, 0x5f, 0x7d, 0x63, 
-	0x5f, 0x5f, 0x1f, 0x57, 0xdf, 0x52, 0x3f, 0x42, 0xdf, 0x39, 0xff, 0x3d, 0x3e, 0x29, 0xb7, 0x18, 
-	0x1c, 0x63, 0xdd, 0x77, 0xbf, 0x77, 0xbe, 0x73, 0xdd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x73, 
-	0xd8, 0x56, 0x50, 0x0c, 0x55, 0x0c, 0x31, 0x08, 0x0a, 0x00, 0x4f, 0x08, 0x2f, 0x08, 0xb2, 0x31, 
-	0x8c, 0x2d, 0x7b, 0x6f, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xde, 0x77, 0x9d, 0x6f, 0x9d, 0x6f, 0x9e, 0x6f, 0xdf, 0x77, 
-	0xbd, 0x73, 0xde, 0x77, 0x37, 0x42, 0xfb, 0x28, 0x9b, 0x1c, 0x97, 0x18, 0x71, 0x10, 0x6f, 0x0c, 
-	0x17, 0x42, 0x3d, 0x67, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0x17, 0x5f, 
-	0x0e, 0x3a, 0x69, 0x25, 0x38, 0x5f, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x73, 0xdf, 0x77, 0xbe, 0x73, 0x7b, 0x6b, 0x18, 0x5f, 0x73, 0x4a, 0x6b, 0x29, 0x29, 0x21, 
-	0x8c, 0x29, 0x8c, 0x2d, 0xce, 0x35, 0x52, 0x46, 0x18, 0x5f, 0xbd, 0x6f, 0xde, 0x77, 0xbd, 0x73, 
-	0xbd, 0x6f, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xdf, 0x77, 0xdf, 0x77, 0x3e, 0x5f, 
-	0xdf, 0x4e, 0xbf, 0x4a, 0x5f, 0x3e, 0x58, 0x21, 0x5e, 0x29, 0x9e, 0x18, 0x7f, 0x18, 0x5f, 0x14, 
-	0x3f, 0x10, 0x1e, 0x0c, 0x3e, 0x08, 0x1f, 0x08, 0x1f, 0x08, 0x1d, 0x08, 0x5a, 0x0c, 0x0f, 0x00, 
-	0xb7, 0x52, 0xde, 0x77, 0xbf, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x7b, 0xff, 0x77, 0x74, 0x4a, 0xdf, 0x73, 0xbe, 0x73, 0xbe, 0x6f, 0xbf, 0x6f, 
-	0x9e, 0x6b, 0xbe, 0x6b, 0xbe, 0x6f, 0x5c, 0x67, 0x7c, 0x67, 0x9e, 0x6b, 0x3b, 0x5f, 0x6d, 0x21, 
-	0x3d, 0x5b, 0x3f, 0x5b, 0x9f, 0x4a, 0x3f, 0x46, 0xdf, 0x39, 0x5f, 0x2d, 0x3f, 0x29, 0xd6, 0x1c, 
-	0x1b, 0x5f, 0xbe, 0x77, 0xbf, 0x77, 0xbf, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 
-	0xb2, 0x31, 0x93, 0x10, 0x54, 0x08, 0x73, 0x0c, 0x52, 0x08, 0x12, 0x04, 0x52, 0x0c, 0xb2, 0x35, 
-	0x8c, 0x29, 0xde, 0x7b, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xdd, 0x77, 0xde, 0x7b, 0x7c, 0x6b, 0xd9, 0x52, 0xba, 0x4e, 0x37, 0x3e, 0xb8, 0x4e, 
-	0xbf, 0x73, 0x7d, 0x6b, 0xd9, 0x39, 0xdc, 0x20, 0x9c, 0x18, 0xde, 0x20, 0x9c, 0x1c, 0x9b, 0x14, 
-	0x59, 0x0c, 0x34, 0x08, 0x5f, 0x67, 0xbd, 0x77, 0xbe, 0x77, 0xdf, 0x77, 0x5a, 0x67, 0x30, 0x42, 
-	0xce, 0x35, 0x39, 0x63, 0xbd, 0x77, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 0x7b, 0x6b, 
-	0xb5, 0x52, 0x10, 0x3e, 0xad, 0x31, 0x6b, 0x29, 0x8c, 0x2d, 0xef, 0x39, 0x94, 0x4e, 0x18, 0x5f, 
-	0xde, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xdf, 0x73, 0x5f, 0x5b, 
-	0xbe, 0x46, 0xb8, 0x29, 0x1f, 0x3a, 0x17, 0x1d, 0xd7, 0x1c, 0xbd, 0x1c, 0x9f, 0x1c, 0x9f, 0x18, 
-	0x9f, 0x18, 0x3f, 0x0c, 0x1f, 0x0c, 0x1f, 0x08, 0x1e, 0x08, 0x5c, 0x0c, 0x34, 0x08, 0x35, 0x46, 
-	0xdf, 0x7b, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x7b, 0xde, 0x77, 0x19, 0x5f, 0x39, 0x5f, 0xbe, 0x6f, 0xbe, 0x6f, 0xbe, 0x6b, 0x9f, 0x6b, 
-	0x7e, 0x67, 0x5b, 0x63, 0xcf, 0x31, 0x9d, 0x6b, 0x9e, 0x6b, 0x7e, 0x67, 0x9f, 0x67, 0x5d, 0x5f, 
-	0xf3, 0x31, 0x38, 0x3a, 0x9e, 0x4a, 0xfe, 0x3d, 0x7d, 0x31, 0x5d, 0x2d, 0xd9, 0x20, 0x9b, 0x4e, 
-	0xdf, 0x73, 0xbe, 0x73, 0xdc, 0x77, 0xdc, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xdf, 0x77, 
-	0x6c, 0x0c, 0x75, 0x10, 0x34, 0x08, 0x55, 0x0c, 0x36, 0x0c, 0x34, 0x08, 0x6f, 0x0c, 0xd1, 0x35, 
-	0x18, 0x5f, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0x75, 0x46, 0x5e, 0x5f, 0x1e, 0x57, 0x9d, 0x4a, 0x7b, 0x42, 
-	0x73, 0x29, 0x1c, 0x5f, 0x1b, 0x3e, 0xde, 0x20, 0x9c, 0x18, 0xfe, 0x24, 0xbd, 0x1c, 0x3b, 0x0c, 
-	0x3b, 0x08, 0x14, 0x00, 0xfc, 0x5a, 0xde, 0x7b, 0xde, 0x77, 0xb5, 0x4e, 0x2f, 0x3e, 0xed, 0x35, 
-	0x9c, 0x73, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0x7b, 0x6b, 0xf8, 0x5a, 0xce, 0x35, 0xad, 0x31, 0x8c, 0x2d, 0xad, 0x2d, 
-	0xef, 0x35, 0x52, 0x42, 0x94, 0x4a, 0x18, 0x5f, 0x5a, 0x67, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xdf, 0x77, 0xbf, 0x6f, 0x1f, 0x57, 
-	0xda, 0x2d, 0xdd, 0x35, 0x9f, 0x31, 0x3c, 0x29, 0xd8, 0x1c, 0xde, 0x20, 0x5e, 0x14, 0x9f, 0x18, 
-	0x3f, 0x10, 0x3f, 0x0c, 0x3e, 0x08, 0x1e, 0x04, 0x1d, 0x08, 0x3a, 0x08, 0x0f, 0x00, 0x1b, 0x5f, 
-	0xbf, 0x77, 0xdf, 0x77, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x7b, 0xde, 0x7b, 0x18, 0x5f, 0x9d, 0x6f, 0x9d, 0x6f, 0xbe, 0x6b, 0xbf, 0x67, 0x9f, 0x63, 
-	0x7e, 0x63, 0xd1, 0x31, 0x9d, 0x6b, 0xbe, 0x6f, 0x9e, 0x6b, 0x9f, 0x6b, 0x9f, 0x67, 0x5d, 0x5f, 
-	0x7f, 0x63, 0x58, 0x3e, 0x59, 0x3e, 0x9a, 0x4a, 0x16, 0x3e, 0x79, 0x4a, 0x1b, 0x5f, 0xde, 0x77, 
-	0xde, 0x77, 0xbf, 0x77, 0xbe, 0x77, 0xdf, 0x77, 0xbf, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xde, 0x77, 
-	0xeb, 0x18, 0x93, 0x10, 0x35, 0x08, 0x55, 0x0c, 0x55, 0x08, 0x73, 0x0c, 0xf5, 0x39, 0xde, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xdd, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xdd, 0x77, 0xdd, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xd7, 0x56, 0x1b, 0x5b, 0x3f, 0x57, 0xbe, 0x4a, 0x9f, 0x46, 0x7f, 0x42, 
-	0xbb, 0x31, 0xb4, 0x31, 0xfc, 0x39, 0xde, 0x1c, 0x7d, 0x14, 0xbe, 0x1c, 0x5c, 0x10, 0x5d, 0x10, 
-	0x5b, 0x0c, 0x12, 0x04, 0xfb, 0x5e, 0xb5, 0x52, 0xac, 0x2d, 0xee, 0x35, 0xb4, 0x4e, 0xbd, 0x73, 
-	0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbd, 0x73, 0x18, 0x5f, 0xf7, 0x56, 
-	0x10, 0x3e, 0x8c, 0x2d, 0xad, 0x31, 0xad, 0x2d, 0xce, 0x31, 0x31, 0x42, 0x10, 0x3e, 0xb5, 0x52, 
-	0x18, 0x5f, 0x5a, 0x67, 0xbd, 0x73, 0xff, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xdf, 0x73, 0xfe, 0x52, 
-	0x9f, 0x4a, 0xdf, 0x39, 0xff, 0x20, 0x1f, 0x29, 0x1e, 0x29, 0x54, 0x08, 0xfa, 0x20, 0x3e, 0x29, 
-	0x7d, 0x14, 0x5f, 0x14, 0x1d, 0x04, 0x1d, 0x08, 0x1c, 0x04, 0x5b, 0x0c, 0x12, 0x00, 0x5f, 0x6b, 
-	0xde, 0x77, 0xbe, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xd6, 0x56, 0x9d, 0x6f, 0xdf, 0x73, 0x9e, 0x67, 0x9e, 0x67, 
-	0xb7, 0x4a, 0xb7, 0x4e, 0xbf, 0x6f, 0xbf, 0x6f, 0x9e, 0x6b, 0x7e, 0x67, 0x7e, 0x63, 0x7e, 0x63, 
-	0x5f, 0x5f, 0xdd, 0x52, 0x17, 0x3a, 0xdf, 0x73, 0xde, 0x77, 0xdf, 0x77, 0xbf, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0x96, 0x52, 0xcf, 0x14, 0x75, 0x10, 0x55, 0x08, 0x53, 0x08, 0x8f, 0x10, 0x7e, 0x6b, 0xbd, 0x73, 
-	0xbe, 0x73, 0xbf, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xb7, 0x52, 0x3d, 0x5f, 0xff, 0x52, 0x7d, 0x42, 0x7d, 0x3e, 0x3d, 0x3a, 
-	0xdf, 0x39, 0x50, 0x08, 0x7b, 0x31, 0x3b, 0x0c, 0x7c, 0x14, 0xbe, 0x1c, 0x5c, 0x0c, 0x1a, 0x00, 
-	0x5a, 0x0c, 0x0e, 0x00, 0x9f, 0x6f, 0xf6, 0x56, 0xac, 0x2d, 0x7b, 0x6b, 0xdf, 0x77, 0xbe, 0x73, 
-	0xdd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xdf, 0x77, 0xff, 0x77, 0x9c, 0x6f, 0x18, 0x5f, 0xb5, 0x52, 0x10, 0x3e, 0xad, 0x31, 0x08, 0x1d, 
-	0xce, 0x35, 0x8c, 0x2d, 0x4a, 0x25, 0xad, 0x31, 0x94, 0x4e, 0xd7, 0x5a, 0x3a, 0x67, 0xbd, 0x73, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0x9e, 0x6b, 0xff, 0x56, 
-	0x9f, 0x4e, 0x1e, 0x25, 0x1f, 0x29, 0xff, 0x20, 0xdf, 0x24, 0x9a, 0x18, 0xd7, 0x1c, 0xbb, 0x31, 
-	0xbc, 0x4e, 0x3a, 0x0c, 0x1e, 0x08, 0x3c, 0x04, 0x3c, 0x08, 0x9b, 0x14, 0x50, 0x08, 0x7f, 0x6f, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xf8, 0x5a, 0x94, 0x4a, 0x95, 0x4a, 0x96, 0x4a, 
-	0xd8, 0x52, 0x7d, 0x67, 0x9f, 0x6b, 0xbf, 0x6b, 0x9f, 0x6b, 0x7e, 0x67, 0x9f, 0x67, 0x7f, 0x63, 
-	0x1f, 0x57, 0xdf, 0x4e, 0x96, 0x29, 0x9f, 0x6f, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xdd, 0x73, 0xdd, 0x77, 0xbe, 0x73, 
-	0xbe, 0x77, 0x76, 0x4e, 0x54, 0x29, 0xb3, 0x14, 0x96, 0x2d, 0x1c, 0x5f, 0xbe, 0x73, 0xbd, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0x9d, 0x73, 0xd7, 0x56, 0x3d, 0x5b, 0xde, 0x4e, 0xbf, 0x4a, 0xbf, 0x4a, 0x9f, 0x46, 
-	0xbe, 0x31, 0xd3, 0x18, 0xf9, 0x20, 0x3c, 0x10, 0x3d, 0x14, 0x7e, 0x18, 0x3e, 0x0c, 0x1c, 0x04, 
-	0x58, 0x0c, 0xf7, 0x3d, 0x8f, 0x31, 0x18, 0x63, 0xdf, 0x7b, 0xdd, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xff, 0x77, 0xde, 0x73, 0x9c, 0x6f, 
-	0x5a, 0x67, 0xf7, 0x5a, 0x73, 0x4a, 0x10, 0x3e, 0xef, 0x39, 0xcf, 0x35, 0xef, 0x39, 0x52, 0x46, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbf, 0x73, 0xbf, 0x73, 0xfc, 0x56, 0xdf, 0x4e, 
-	0xff, 0x39, 0x7f, 0x31, 0x5f, 0x31, 0x1f, 0x29, 0x9f, 0x1c, 0x9e, 0x14, 0x16, 0x00, 0xfa, 0x35, 
-	0x98, 0x46, 0xd9, 0x35, 0x3b, 0x1d, 0xba, 0x10, 0x56, 0x0c, 0xd7, 0x39, 0x5d, 0x67, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xdf, 0x77, 
-	0x3b, 0x63, 0x7e, 0x67, 0x7e, 0x67, 0x9e, 0x67, 0x9f, 0x67, 0x7f, 0x63, 0x7f, 0x63, 0x5f, 0x63, 
-	0x3f, 0x5b, 0xff, 0x52, 0xd5, 0x2d, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x73, 0x38, 0x63, 0x11, 0x3e, 0xd9, 0x56, 0x9e, 0x6f, 0xde, 0x73, 0xdd, 0x73, 0xbd, 0x77, 
-	0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xfe, 0x77, 0xb6, 0x4e, 0x7d, 0x63, 0xfe, 0x52, 0xbe, 0x46, 0x9e, 0x4a, 0x7f, 0x46, 
-	0x3f, 0x42, 0x38, 0x25, 0x76, 0x10, 0x7d, 0x18, 0x5d, 0x10, 0x5d, 0x14, 0x7c, 0x14, 0x79, 0x10, 
-	0x4f, 0x04, 0x9f, 0x73, 0x5e, 0x6b, 0xbf, 0x73, 0xbf, 0x77, 0xdf, 0x77, 0xdd, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xbd, 0x6f, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7c, 0x6b, 0x3a, 0x67, 0xd6, 0x56, 0x94, 0x4a, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xdf, 0x77, 0x5b, 0x67, 0x9f, 0x67, 0xbf, 0x4a, 
-	0xdf, 0x35, 0x9f, 0x35, 0x5f, 0x31, 0x7f, 0x39, 0x7f, 0x18, 0x5f, 0x10, 0x39, 0x08, 0x19, 0x42, 
-	0xbf, 0x77, 0x7c, 0x6b, 0xf8, 0x5a, 0xfa, 0x5e, 0x7e, 0x6f, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xbf, 0x73, 0xde, 0x77, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xdf, 0x7b, 
-	0x3b, 0x63, 0x5d, 0x63, 0x7e, 0x67, 0x9f, 0x67, 0x9e, 0x67, 0x7e, 0x63, 0x7e, 0x63, 0x3f, 0x5f, 
-	0xff, 0x52, 0xbd, 0x4a, 0xd4, 0x31, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xdf, 0x77, 0xdd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbf, 0x77, 0xbf, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdd, 0x77, 0x9c, 0x6b, 0x3b, 0x5b, 0x1f, 0x57, 0xbf, 0x4a, 0xbf, 0x4e, 0x7e, 0x46, 
-	0xff, 0x39, 0x3e, 0x29, 0xbc, 0x18, 0x58, 0x0c, 0xbc, 0x18, 0x9d, 0x18, 0x59, 0x10, 0x31, 0x08, 
-	0x0e, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x30, 0x04, 0x56, 0x2d, 0xfd, 0x5e, 0xdf, 0x73, 0xbe, 0x73, 
-	0xbf, 0x77, 0xbe, 0x77, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x77, 0x5d, 0x63, 0x9f, 0x63, 0xdf, 0x4a, 
-	0xff, 0x3d, 0xbf, 0x39, 0xdf, 0x39, 0x1f, 0x29, 0xbf, 0x20, 0x5f, 0x10, 0x79, 0x10, 0x59, 0x46, 
-	0xdf, 0x7b, 0xdf, 0x7b, 0xfe, 0x7b, 0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x7b, 
-	0x39, 0x63, 0xb7, 0x4e, 0x5d, 0x63, 0x3d, 0x5b, 0x7f, 0x63, 0x7e, 0x63, 0x5e, 0x5f, 0x3e, 0x5b, 
-	0x1e, 0x5b, 0x36, 0x3e, 0x5c, 0x63, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0xde, 0x7b, 0xde, 0x77, 0xf8, 0x5a, 0x98, 0x4a, 0xd5, 0x2d, 0x39, 0x3a, 0x1a, 0x3a, 0x5e, 0x42, 
-	0xde, 0x39, 0xfd, 0x24, 0x75, 0x10, 0x95, 0x14, 0x7b, 0x10, 0x34, 0x08, 0x54, 0x0c, 0x36, 0x08, 
-	0x3a, 0x08, 0x3c, 0x08, 0x1b, 0x08, 0x7c, 0x10, 0x57, 0x0c, 0x53, 0x0c, 0x7f, 0x6b, 0xbd, 0x73, 
-	0xbe, 0x77, 0xdd, 0x77, 0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0x39, 0x63, 
-	0xbd, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x9e, 0x6b, 0x3f, 0x5b, 0xbf, 0x46, 
-	0x3f, 0x42, 0x9f, 0x35, 0x3f, 0x2d, 0x1f, 0x2d, 0xbf, 0x1c, 0x5f, 0x14, 0x19, 0x08, 0xba, 0x56, 
-	0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0xde, 0x77, 0x7b, 0x6b, 0x33, 0x3e, 0xb8, 0x4e, 0xb0, 0x2d, 0x3c, 0x5f, 0x3d, 0x5f, 0x7d, 0x67, 
-	0x97, 0x4a, 0xb7, 0x52, 0xbe, 0x73, 0xde, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x7b, 
-	0xfe, 0x7b, 0x32, 0x42, 0x5c, 0x63, 0x5f, 0x63, 0xff, 0x52, 0xdf, 0x4e, 0x5a, 0x46, 0x94, 0x29, 
-	0x12, 0x1d, 0x53, 0x0c, 0x95, 0x14, 0xb8, 0x18, 0x9d, 0x1c, 0x59, 0x10, 0x15, 0x04, 0x19, 0x04, 
-	0x3b, 0x08, 0x3a, 0x08, 0x3c, 0x0c, 0x5d, 0x10, 0x7c, 0x14, 0x77, 0x0c, 0x5b, 0x46, 0xde, 0x77, 
-	0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xdd, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xcd, 0x35, 
-	0xbd, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0x7c, 0x6b, 0xfb, 0x56, 0x9d, 0x46, 0x1f, 0x57, 
-	0x1f, 0x3e, 0xbf, 0x35, 0xdf, 0x39, 0x7f, 0x35, 0xdf, 0x20, 0x9f, 0x14, 0x56, 0x0c, 0x1c, 0x5f, 
-	0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xbe, 0x73, 0x5a, 0x67, 0x74, 0x4a, 0xf9, 0x5a, 0x33, 0x42, 
-	0x3a, 0x63, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0xff, 0x7b, 0x75, 0x42, 0x5f, 0x63, 0x5f, 0x63, 0xbd, 0x4a, 0xde, 0x4e, 0x7f, 0x4a, 0xbc, 0x35, 
-	0x19, 0x25, 0x1e, 0x29, 0x7b, 0x14, 0x93, 0x14, 0x0d, 0x00, 0x97, 0x10, 0x7b, 0x10, 0x1b, 0x04, 
-	0x1c, 0x08, 0x3c, 0x08, 0x7d, 0x10, 0x7c, 0x10, 0x7c, 0x10, 0x99, 0x14, 0x35, 0x21, 0xbf, 0x73, 
-	0xbd, 0x73, 0xbf, 0x73, 0xbf, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xb5, 0x52, 0xef, 0x39, 
-	0xbd, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0x7c, 0x67, 0xfc, 0x52, 0xff, 0x52, 0x1f, 0x57, 
-	0x5f, 0x42, 0xdf, 0x35, 0xdf, 0x35, 0x7f, 0x2d, 0xbf, 0x1c, 0xbd, 0x1c, 0xd5, 0x35, 0xdf, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xde, 0x7b, 0xdf, 0x7b, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 
-	0x9c, 0x6f, 0x56, 0x42, 0x7e, 0x63, 0x7f, 0x63, 0xdf, 0x4e, 0xbf, 0x4a, 0x9f, 0x4e, 0xdb, 0x35, 
-	0x38, 0x25, 0xfe, 0x28, 0xbe, 0x20, 0x34, 0x0c, 0xd8, 0x3d, 0x9a, 0x31, 0x3b, 0x0c, 0x3a, 0x04, 
-	0x39, 0x08, 0xbd, 0x18, 0x5c, 0x0c, 0x7c, 0x10, 0x3a, 0x08, 0x1c, 0x21, 0xb1, 0x14, 0x9f, 0x6f, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xf7, 0x5a, 0xee, 0x35, 0x94, 0x4e, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xff, 0x7b, 0x18, 0x5b, 0x5d, 0x63, 0x7a, 0x46, 0x1e, 0x5f, 
-	0xdd, 0x5a, 0x97, 0x31, 0x7b, 0x2d, 0x1e, 0x21, 0xdc, 0x1c, 0x74, 0x29, 0x9e, 0x6f, 0xde, 0x77, 
-	0xdf, 0x7b, 0xdf, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x7b, 0xff, 0x7b, 
-	0x2a, 0x1d, 0x9f, 0x67, 0x5e, 0x5f, 0x3e, 0x5f, 0x3f, 0x5b, 0x9e, 0x4a, 0x5f, 0x42, 0xff, 0x39, 
-	0xdf, 0x39, 0xd8, 0x1c, 0xda, 0x1c, 0x52, 0x0c, 0x10, 0x1d, 0x1e, 0x5f, 0x37, 0x04, 0x1a, 0x04, 
-	0x5c, 0x10, 0x7d, 0x10, 0x3c, 0x0c, 0x7c, 0x14, 0x39, 0x08, 0x98, 0x14, 0xdc, 0x56, 0xbf, 0x77, 
-	0xbf, 0x77, 0xbd, 0x73, 0xdd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0x94, 0x4e, 0x31, 0x42, 0x73, 0x4a, 0xde, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x73, 0xbc, 0x6f, 0x19, 0x5f, 0x9d, 0x6f, 0xdf, 0x77, 
-	0x7c, 0x6b, 0x95, 0x4a, 0xd9, 0x56, 0x38, 0x42, 0x75, 0x46, 0x9d, 0x6f, 0xdd, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xdf, 0x77, 0xbf, 0x73, 0xdf, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 
-	0x18, 0x5f, 0x7e, 0x63, 0x5e, 0x5f, 0x7f, 0x63, 0x1e, 0x57, 0x1f, 0x5b, 0x9e, 0x46, 0x9f, 0x4a, 
-	0x7a, 0x29, 0xb5, 0x14, 0xdc, 0x20, 0x56, 0x10, 0x6f, 0x0c, 0xd6, 0x39, 0xdb, 0x39, 0x17, 0x04, 
-	0x19, 0x04, 0x7a, 0x10, 0xbd, 0x18, 0x5b, 0x10, 0x5a, 0x10, 0x55, 0x10, 0x3b, 0x63, 0xdc, 0x73, 
-	0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xbd, 0x73, 0xde, 0x77, 0x59, 0x67, 0xce, 0x35, 0x0f, 0x3a, 0x72, 0x46, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x7b, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xdd, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x7b, 0xff, 0x7b, 
-	0xf8, 0x5a, 0x3d, 0x5b, 0x7f, 0x63, 0x5d, 0x5b, 0x3e, 0x57, 0xbe, 0x4a, 0x9e, 0x46, 0x5d, 0x46, 
-	0xb2, 0x14, 0x1d, 0x25, 0xbf, 0x20, 0x9a, 0x18, 0x2e, 0x04, 0xb1, 0x10, 0x14, 0x21, 0xd6, 0x18, 
-	0x18, 0x08, 0x5b, 0x10, 0x7b, 0x10, 0x59, 0x0c, 0xdc, 0x1c, 0xb3, 0x14, 0x9f, 0x73, 0xbc, 0x73, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0x9c, 0x6f, 0x94, 0x4e, 0x73, 0x4a, 0x94, 0x4e, 0xf7, 0x5a, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xdf, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xbf, 0x77, 0xbf, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdd, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xf8, 0x5a, 0xdb, 0x52, 0x3d, 0x5b, 0x5e, 0x5f, 0x5f, 0x5f, 0xdf, 0x4a, 0x9d, 0x46, 0x11, 0x21, 
-	0x5c, 0x2d, 0xde, 0x20, 0x9e, 0x18, 0xbe, 0x1c, 0x7a, 0x14, 0x33, 0x08, 0x96, 0x31, 0x78, 0x4a, 
-	0x76, 0x29, 0x57, 0x0c, 0x38, 0x0c, 0x58, 0x0c, 0xb5, 0x10, 0xba, 0x52, 0xdf, 0x77, 0xde, 0x77, 
-	0xdd, 0x77, 0xbf, 0x77, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xf7, 0x5a, 
-	0x73, 0x4a, 0x18, 0x5f, 0xce, 0x35, 0xd5, 0x56, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 
-	0xff, 0x7b, 0xd7, 0x56, 0x97, 0x4a, 0x77, 0x42, 0x17, 0x3a, 0x50, 0x25, 0xb7, 0x52, 0x12, 0x21, 
-	0x9e, 0x35, 0x3f, 0x2d, 0xbd, 0x20, 0xbe, 0x1c, 0x9c, 0x18, 0x58, 0x10, 0x10, 0x04, 0x1c, 0x5f, 
-	0x9d, 0x6f, 0x1c, 0x5f, 0x37, 0x42, 0x98, 0x4e, 0x9e, 0x6f, 0xdf, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x77, 0xbd, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbd, 0x73, 0xde, 0x77, 0x3a, 0x63, 0x31, 0x3e, 0x18, 0x5f, 
-	0xd6, 0x56, 0x10, 0x3e, 0x39, 0x63, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xdf, 0x77, 
-	0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xff, 0x7b, 0xbe, 0x73, 0xbe, 0x73, 0xff, 0x7b, 0x3c, 0x63, 0xba, 0x31, 
-	0xbe, 0x31, 0x1f, 0x25, 0xfe, 0x20, 0xde, 0x24, 0x7c, 0x1c, 0xbc, 0x1c, 0x33, 0x0c, 0x17, 0x42, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x77, 
-	0xbe, 0x77, 0xdd, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbe, 0x77, 0x5b, 0x67, 0x3a, 0x63, 
-	0x39, 0x63, 0xbd, 0x73, 0xdd, 0x77, 0x9c, 0x6f, 0xef, 0x39, 0x94, 0x4e, 0xd6, 0x56, 0x52, 0x46, 
-	0x51, 0x46, 0xbd, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xdf, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x7b, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xfe, 0x7b, 0xbb, 0x52, 0xfe, 0x3d, 
-	0xde, 0x39, 0x1d, 0x25, 0x1e, 0x25, 0x1e, 0x29, 0x7b, 0x14, 0x7b, 0x18, 0x56, 0x10, 0xf5, 0x3d, 
-	0xbf, 0x77, 0xde, 0x77, 0xdd, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbd, 0x77, 0xbd, 0x73, 0xde, 0x77, 0x7e, 0x6f, 0xba, 0x56, 0x8c, 0x0c, 0x10, 0x1d, 
-	0xf3, 0x39, 0xad, 0x31, 0xac, 0x31, 0x52, 0x46, 0x0f, 0x3a, 0xad, 0x31, 0xe7, 0x18, 0xd6, 0x56, 
-	0xff, 0x7b, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xdf, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x7b, 0xde, 0x77, 0xde, 0x77, 0x16, 0x3e, 0xfe, 0x3d, 
-	0xbf, 0x39, 0x3d, 0x2d, 0x1e, 0x29, 0x1e, 0x25, 0x7b, 0x14, 0x7d, 0x18, 0x76, 0x14, 0x35, 0x46, 
-	0xbf, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0x55, 0x46, 0x4b, 0x08, 0x4f, 0x08, 0x72, 0x0c, 0x70, 0x0c, 
-	0x0d, 0x1d, 0x11, 0x3a, 0x74, 0x4a, 0x31, 0x42, 0x27, 0x1d, 0x41, 0x04, 0x5a, 0x6b, 0xbe, 0x77, 
-	0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 
-	0xbd, 0x77, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xde, 0x73, 0xde, 0x7b, 0x9f, 0x6f, 0x1c, 0x3e, 
-	0xbf, 0x39, 0x3c, 0x2d, 0x5d, 0x2d, 0x3f, 0x2d, 0xdd, 0x1c, 0xfd, 0x20, 0x73, 0x14, 0x3b, 0x63, 
-	0xbd, 0x77, 0xdf, 0x77, 0xbf, 0x77, 0xde, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0x1a, 0x63, 0x0a, 0x00, 0x52, 0x0c, 0x53, 0x08, 0x73, 0x0c, 0x6f, 0x0c, 
-	0x51, 0x25, 0x6e, 0x29, 0xb7, 0x52, 0x52, 0x46, 0x83, 0x0c, 0x93, 0x4e, 0xde, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x7b, 0x11, 0x42, 0x5e, 0x67, 
-	0xb9, 0x35, 0x10, 0x1d, 0xb8, 0x35, 0x7e, 0x2d, 0x5d, 0x29, 0xf7, 0x1c, 0x77, 0x4a, 0xde, 0x77, 
-	0xde, 0x77, 0xbf, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xdd, 0x73, 0xdd, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xd7, 0x5a, 0x4f, 0x0c, 0x54, 0x08, 0x33, 0x04, 0x53, 0x08, 0x0d, 0x00, 
-	0x2d, 0x04, 0x4d, 0x0c, 0x0a, 0x1d, 0x4a, 0x25, 0xad, 0x31, 0xde, 0x77, 0xde, 0x73, 0xbe, 0x77, 
-	0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbd, 0x77, 0x74, 0x4a, 
-	0x3c, 0x67, 0xde, 0x77, 0xfa, 0x5a, 0x95, 0x2d, 0x3a, 0x42, 0x3c, 0x63, 0xbe, 0x73, 0xdd, 0x73, 
-	0xde, 0x73, 0xdf, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xbe, 0x73, 0xbd, 0x73, 0xf8, 0x5e, 0x6f, 0x0c, 0x74, 0x0c, 0x54, 0x08, 0x34, 0x08, 0x74, 0x0c, 
-	0x72, 0x0c, 0xb5, 0x35, 0xb1, 0x31, 0xe7, 0x1c, 0x9c, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xbd, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xdf, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xde, 0x77, 0xdf, 0x7b, 0xdf, 0x7b, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xbe, 0x77, 0xdd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xbf, 0x73, 0xbd, 0x77, 0x9d, 0x6f, 0x2b, 0x00, 0x73, 0x0c, 0x32, 0x08, 0x74, 0x0c, 0x53, 0x08, 
-	0x38, 0x42, 0xdf, 0x73, 0x32, 0x42, 0x7b, 0x6f, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xbd, 0x73, 0xbd, 0x73, 0xde, 0x73, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x73, 0xbe, 0x77, 0xbd, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 
-	0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x73, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbd, 0x77, 
-	0xbe, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x77, 
-	0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x77, 
-	0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x77, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 
-	0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xde, 0x77, 0xbe, 0x73, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xdf, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xbe, 0x77, 0xbe, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xbe, 0x73, 0xde, 0x73, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 
-	0xde, 0x73, 0xde, 0x77, 0xdf, 0x77, 0x74, 0x4a, 0xaf, 0x10, 0xb4, 0x10, 0xb2, 0x14, 0xd7, 0x35, 
-	0x5b, 0x63, 0x59, 0x63, 0x7c, 0x6b, 0xbd, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 
-	0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x73, 0xde, 0x73, 0xde, 0x77, 0xde, 0x77
-	
-};
-const int send_screen_size = sizeof(send_screen);
@@ -1,378 +1,105 @@
+#include <stddef.h>
 #include <stdint.h>
-#include <gba_interrupt.h>
-#include <gba_sio.h>
-#include <gba_timers.h>
 
-#include "bios.h"
 #include "common.h"
+#include "si.h"
+#include "timers.h"
+#include "trace.h"
 
-void IWRAM_CODE SISetResponse(const void *buf, unsigned bits)
-{
-	unsigned byte = 0;
-	unsigned bit = 0;
+struct si_timing si_timing;
+struct si_rx si_rx;
 
-	do {
-		if (bit++ % 8 == 0)
-			byte = *(uint8_t *)buf++;
-		byte <<= 1;
+_Static_assert(offsetof(struct si_timing, tx_start) == SI_TIMING_TX_START, "joybus.s stores tx_start at SI_TIMING_TX_START");
+_Static_assert(offsetof(struct si_rx, sum) == SI_RX_SUM, "si_rx layout does not match joybus.s");
+_Static_assert(offsetof(struct si_rx, timeout) == SI_RX_TIMEOUT, "si_rx layout does not match joybus.s");
+_Static_assert(offsetof(struct si_rx, edge) == SI_RX_EDGE, "si_rx layout does not match joybus.s");
+_Static_assert(offsetof(struct si_rx, late) == SI_RX_LATE, "si_rx layout does not match joybus.s");
+
+#ifdef SI_CAPTURE_OVERSAMPLE
+//One entry per bit, bit n set if the nth read saw the line high
+IWRAM_DATA uint8_t si_raw[SI_RAW_BITS];
+
+//High if most of the SI_OVERSAMPLE reads were high
+IWRAM_DATA uint8_t si_majority[1 << SI_OVERSAMPLE];
+
+void si_capture_init()
+{
+	for (unsigned x = 0; x < (1 << SI_OVERSAMPLE); x++) {
+		unsigned high = 0;
 
-		if (byte & 0x100) {
-			asm volatile (
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				:
-				: "r" (GPIO_SO_IO), "r" (GPIO_SO_IO | GPIO_SO),
-				  "m" (REG_RCNT)
-				: "memory"
-			);
-		} else {
-			asm volatile (
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				:
-				: "r" (GPIO_SO_IO), "r" (GPIO_SO_IO | GPIO_SO),
-				  "m" (REG_RCNT)
-				: "memory"
-			);
-		}
-	} while (bit < bits);
+		for (unsigned y = 0; y < SI_OVERSAMPLE; y++)
+			high += (x >> y) & 1;
 
-	asm volatile (
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"strb  %0, %2 \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"strb  %1, %2 \n"
-		:
-		: "r" (GPIO_SO_IO), "r" (GPIO_SO_IO | GPIO_SO),
-		  "m" (REG_RCNT)
-		: "memory"
-	);
+		si_majority[x] = (high * 2) > SI_OVERSAMPLE;
+	}
 }
 
-void IWRAM_CODE SISetResponse8(uint8_t *buf, unsigned bits)
+static void IWRAM_CODE si_decode(uint8_t *buf, unsigned bits)
 {
 	unsigned byte = 0;
 	unsigned bit = 0;
-	unsigned counter = 0;
 
-	do {
-		if (bit++ % 8 == 0)
-			byte = buf[counter++];
+	while (bit < bits) {
 		byte <<= 1;
+		byte |= si_majority[si_raw[bit]];
 
-		if (byte & 0x100) {
-			asm volatile (
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				:
-				: "r" (GPIO_SO_IO), "r" (GPIO_SO_IO | GPIO_SO),
-				  "m" (REG_RCNT)
-				: "memory"
-			);
-		} else {
-			asm volatile (
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %0, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				"strb  %1, %2 \n"
-				"nop \n"
-				"nop \n"
-				"nop \n"
-				:
-				: "r" (GPIO_SO_IO), "r" (GPIO_SO_IO | GPIO_SO),
-				  "m" (REG_RCNT)
-				: "memory"
-			);
-		}
-	} while (bit < bits);
+		if (++bit % 8 == 0)
+			*buf++ = byte;
+	}
+}
+#else
+void si_capture_init()
+{
+}
+#endif
 
-	asm volatile (
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"strb  %0, %2 \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"nop \n"
-		"strb  %1, %2 \n"
-		:
-		: "r" (GPIO_SO_IO), "r" (GPIO_SO_IO | GPIO_SO),
-		  "m" (REG_RCNT)
-		: "memory"
-	);
+void si_timing_reset()
+{
+	si_timing.period = 0;
+	si_timing.period_min = 0xFFFF;
+	si_timing.period_max = 0;
+	si_timing.timeout = SI_BIT_TIMEOUT_MAX;
+	si_timing.rx_end = 0;
+	si_timing.tx_start = 0;
+
+	si_timing.calibrated = 0;
+	si_timing.uncalibrated = 0;
 }
 
 int IWRAM_CODE SIGetCommand(void *buf, unsigned bits)
 {
-	unsigned byte = 0;
-	unsigned bit = 0;
-	unsigned irq;
+	int bit;
+
+#ifdef SI_CAPTURE_OVERSAMPLE
+	if (bits > SI_RAW_BITS)
+		bits = SI_RAW_BITS;
+#endif
+
+	TRACE_BEGIN(TRACE_SI_COMMAND, bits);
 
-	REG_TM2CNT_H = REG_TM0CNT_H = 0;
-	REG_IF = irq = REG_IF;
-	REG_TM2CNT_H = TIMER_START | TIMER_IRQ | 3;
-	IO_H[153] = 0x42;
+	bit = si_receive(buf, bits);
+	TRACE_END(TRACE_SI_COMMAND, bit);
 
-	do {
-		if((IO_H[152] & 0x2) == 0) { return -1; }
+	if (bit < 0)
+		return bit;
 
-		CustomHalt(irq & IRQ_TIMER2 ? STOP : HALT);
-		REG_TM0CNT_H = 0;
-		REG_IF = irq = REG_IF;
-		REG_TM0CNT_H = TIMER_START | TIMER_IRQ;
+	si_timing.rx_end = si_rx.edge;
 
-		if (irq & IRQ_SERIAL) {
-			byte <<= 1;
-			byte |= !!((REG_RCNT | REG_RCNT | REG_RCNT) & GPIO_SI);
+#ifdef SI_CAPTURE_OVERSAMPLE
+	si_decode(buf, bit);
+#endif
 
-			if (++bit % 8 == 0)
-				*(uint8_t *)buf++ = byte;
-		} else if (irq & IRQ_TIMER0)
-			break;
-	} while (bit < bits);
+	//Bookkeeping waits until the line is idle
+	if (bit >= SI_CALIBRATE_LAST) {
+		u16 period = si_rx.sum >> 2;
 
-	IO_H[153] = 0x0;
+		si_timing.period = period;
+		si_timing.timeout = si_rx.timeout;
+		if (period < si_timing.period_min) si_timing.period_min = period;
+		if (period > si_timing.period_max) si_timing.period_max = period;
+		si_timing.calibrated++;
+	} else if (bit > 0)
+		si_timing.uncalibrated++;
 
 	return bit;
 }
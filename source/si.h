@@ -0,0 +1,89 @@
+#ifndef GBA_SI_H
+#define GBA_SI_H
+
+//Shared with joybus.s, everything C-only sits behind __ASSEMBLER__
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+#include <gba_types.h>
+#endif
+
+//SI_CAPTURE_OVERSAMPLE (make SI_CAPTURE=oversample) keeps the line levels seen at each edge
+//and decodes them after the stop bit, instead of deciding every bit on the spot. More tolerant
+//of marginal cables, but the decode runs before the reply and adds to response latency.
+
+//Reads of REG_RCNT per bit in SI_CAPTURE_OVERSAMPLE mode, voted on after the frame
+#define SI_OVERSAMPLE 5
+
+#if SI_OVERSAMPLE != 5
+#error si_receive reads REG_RCNT exactly 5 times per bit
+#endif
+
+//Longest frame SI_CAPTURE_OVERSAMPLE can hold, a full 128 byte command plus stop bit
+#define SI_RAW_BITS ((128 * 8) + 1)
+
+//End-of-command timeout in CPU cycles, used until the bit period is measured
+#define SI_BIT_TIMEOUT_MAX 96
+
+//Bits 2 to 5 close whole bit periods, bit 1 only ends the idle gap
+#define SI_CALIBRATE_FIRST 1
+#define SI_CALIBRATE_LAST  5
+
+//Slack added to the measured bit period for edge jitter and wake latency
+#define SI_BIT_JITTER 8
+
+//si_receive()/SIGetCommand() results other than a bit count: B was pressed, VBlank began before a command did,
+//or a command had already begun when the wait started, so its first bits were missed and the rest were let run out
+#define SI_ABORT  (-1)
+#define SI_VBLANK (-2)
+#define SI_LATE   (-3)
+
+//Field offsets joybus.s writes to, checked against the structs in si.arm.c
+#define SI_TIMING_TX_START 10
+#define SI_RX_SUM     0
+#define SI_RX_TIMEOUT 2
+#define SI_RX_EDGE    4
+#define SI_RX_LATE    6
+
+#ifndef __ASSEMBLER__
+
+//Calibration results for the current send session, in CPU cycles
+struct si_timing
+{
+	u16 period;
+	u16 period_min;
+	u16 period_max;
+	u16 timeout;
+
+	//PROFILE_TIMER at the last sampled bit and at the first edge of the last response
+	u16 rx_end;
+	u16 tx_start;
+
+	u32 calibrated;
+	u32 uncalibrated;
+};
+
+//Raw results of the last si_receive() call
+struct si_rx
+{
+	u16 sum;
+	u16 timeout;
+	u16 edge;
+	u16 late;
+};
+
+extern struct si_timing si_timing;
+extern struct si_rx si_rx;
+
+void si_capture_init();
+void si_timing_reset();
+
+//joybus.s
+void SISetResponse(const void *buf, unsigned bits);
+void SISetResponse8(uint8_t *buf, unsigned bits);
+int si_receive(void *buf, unsigned bits);
+
+int SIGetCommand(void *buf, unsigned bits);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* GBA_SI_H */
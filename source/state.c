@@ -0,0 +1,156 @@
+#include "common.h"
+#include "input.h"
+#include "irq.h"
+#include "state.h"
+#include "trace.h"
+
+#define MAX_STATES 8
+
+u8 program_state = 0;
+struct state_timing state_timing[MAX_STATES];
+struct boot_timing boot_timing;
+
+static const struct state* states;
+static u8 next_state = 0;
+
+static job_func jobs[MAX_JOBS];
+static u8 job_head = 0;
+static u8 job_count = 0;
+static u32 job_step = 0;
+
+bool fade_out_job(u32 step)
+{
+	IO_H[40] = 0x4C4;
+	IO_H[42] = (step / FADE_FRAMES) + 1;
+
+	return (step + 1) >= (16 * FADE_FRAMES);
+}
+
+bool fade_in_job(u32 step)
+{
+	IO_H[40] = 0x4C4;
+	IO_H[42] = 15 - (step / FADE_FRAMES);
+
+	return (step + 1) >= (16 * FADE_FRAMES);
+}
+
+bool switch_state_job(u32 step)
+{
+	TRACE_BEGIN(TRACE_STATE, next_state);
+
+	if(states[program_state].exit) { states[program_state].exit(); }
+
+	program_state = next_state;
+
+	if(states[program_state].enter) { states[program_state].enter(); }
+
+	TRACE_END(TRACE_STATE, program_state);
+	return true;
+}
+
+bool blank_job(u32 step)
+{
+	//Force blank so the next screen is not drawn over the old one in view
+	IO_H[0] |= 0x80;
+	return true;
+}
+
+void schedule_job(job_func job)
+{
+	if(job_count == MAX_JOBS) { return; }
+
+	jobs[(job_head + job_count) % MAX_JOBS] = job;
+	job_count++;
+}
+
+bool jobs_pending()
+{
+	return (job_count != 0);
+}
+
+void change_state(u8 next, bool fade)
+{
+	next_state = next;
+
+#ifdef VIDEO_MODE4
+	//The next screen is composed off screen and flipped in, there is no redraw to hide
+	schedule_job(switch_state_job);
+#else
+	if(fade)
+	{
+		schedule_job(fade_out_job);
+		schedule_job(switch_state_job);
+		schedule_job(fade_in_job);
+	}
+
+	else
+	{
+		schedule_job(blank_job);
+		schedule_job(switch_state_job);
+	}
+#endif
+}
+
+void run_states(const struct state* table, u8 first)
+{
+	states = table;
+	program_state = first;
+
+	TRACE_BEGIN(TRACE_STATE, first);
+	if(states[program_state].enter) { states[program_state].enter(); }
+	TRACE_END(TRACE_STATE, first);
+
+#ifndef BOOT_NO_FADE
+	schedule_job(fade_in_job);
+#endif
+
+	bool vblank_started = false;
+
+	//One tick per frame: latch input, then run either the next job or the current state
+	while(true)
+	{
+		if(!vblank_started) { wait_vblank_irq(); }
+		vblank_started = false;
+
+		video_flip();
+		update_input();
+
+		if(job_count)
+		{
+			TRACE_BEGIN(TRACE_JOB, job_step);
+			bool done = jobs[job_head](job_step++);
+			TRACE_END(TRACE_JOB, done);
+
+			if(done)
+			{
+				job_head = (job_head + 1) % MAX_JOBS;
+				job_count--;
+				job_step = 0;
+			}
+
+			continue;
+		}
+
+		u8 current = program_state;
+		u32 frame = frame_count;
+
+		//At least one VBlank has passed by now, so 0 means not seen yet
+		if(!boot_timing.ready) { boot_timing.ready = frame; }
+		if(!boot_timing.input && input.pressed) { boot_timing.input = (frame > 0xFFFF) ? 0xFFFF : frame; }
+
+		TRACE_BEGIN(TRACE_FRAME, current);
+		states[current].frame();
+		TRACE_END(TRACE_FRAME, current);
+
+		//A paced frame hook is measured from the VBlank it returned at
+		vblank_started = states[current].paced && !job_count;
+		if(vblank_started) { frame = frame_count; }
+
+		//Check how many scanlines past the start of VBlank the frame hook ran
+		u32 lines = ((frame_count - frame) * 228) + ((IO_H[3] + 228 - 160) % 228);
+		if(lines > 0xFFFF) { lines = 0xFFFF; }
+
+		if(lines > state_timing[current].worst) { state_timing[current].worst = lines; }
+		if(states[current].budget && (lines > states[current].budget)) { state_timing[current].overruns++; }
+	}
+}
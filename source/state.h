@@ -0,0 +1,53 @@
+#ifndef GBA_STATE_H
+#define GBA_STATE_H
+
+#include <gba_types.h>
+
+//Frames spent on each brightness level during a transition
+#define FADE_FRAMES 4
+
+//Maximum number of jobs waiting to run
+#define MAX_JOBS 8
+
+struct state
+{
+	void (*enter)();
+	void (*frame)();
+	void (*exit)();
+
+	//Scanlines the frame hook may use before it counts as an overrun, 0 = unbounded
+	u16 budget;
+
+	//The frame hook waits for VBlank itself and returns as it starts, unless it changed state
+	bool paced;
+};
+
+struct state_timing
+{
+	u16 worst;
+	u16 overruns;
+};
+
+//Frames counted from irq_init(), which runs within the first frame after reset
+struct boot_timing
+{
+	//First frame a state's frame hook ran, once the first screen was up and any fade was done
+	u16 ready;
+
+	//First frame a key press reached a frame hook
+	u16 input;
+};
+
+//A job is run once per frame with an increasing step count until it returns true
+typedef bool (*job_func)(u32 step);
+
+extern u8 program_state;
+extern struct state_timing state_timing[];
+extern struct boot_timing boot_timing;
+
+void run_states(const struct state* table, u8 first);
+void change_state(u8 next, bool fade);
+void schedule_job(job_func job);
+bool jobs_pending();
+
+#endif /* GBA_STATE_H */
@@ -0,0 +1,70 @@
+#include "common.h"
+#include "idle.h"
+#include "irq.h"
+#include "stats.h"
+
+//Battery backed SRAM, only reachable 8 bits at a time
+#define SRAM ((vu8*)0x0E000000)
+
+//Lets emulators and flash carts pick the right save type
+const char save_type[] __attribute__((used, aligned(4))) = "SRAM_V113";
+
+struct si_stats stats;
+
+static struct idle_copy save_copy;
+static u32 save_frame;
+
+void stats_clear()
+{
+	u8* dst = (u8*)&stats;
+
+	for(u32 x = 0; x < sizeof(stats); x++) { dst[x] = 0; }
+	stats.magic = STATS_MAGIC;
+	stats.version = STATS_VERSION;
+}
+
+void stats_load()
+{
+	u8* dst = (u8*)&stats;
+
+	for(u32 x = 0; x < sizeof(stats); x++) { dst[x] = SRAM[x]; }
+
+	//Blank or foreign SRAM (or an older layout) starts from zero
+	if((stats.magic != STATS_MAGIC) || (stats.version != STATS_VERSION)) { stats_clear(); }
+}
+
+void stats_save()
+{
+	const u8* src = (const u8*)&stats;
+
+	stats.timing = si_timing;
+	stats.boot = boot_timing;
+
+	for(u32 x = 0; x < sizeof(stats); x++) { SRAM[x] = src[x]; }
+}
+
+bool stats_save_job()
+{
+	//Idle job for send sessions: a fresh copy every STATS_SAVE_FRAMES, written out a few bytes at a time
+	if(save_copy.done == save_copy.length)
+	{
+		if((frame_count - save_frame) < STATS_SAVE_FRAMES) { return false; }
+
+		save_frame = frame_count;
+		stats.timing = si_timing;
+		stats.boot = boot_timing;
+		idle_copy_start(&save_copy, &stats, SRAM, sizeof(stats));
+	}
+
+	return idle_copy_run(&save_copy);
+}
+
+void stats_latency()
+{
+	//PROFILE_TIMER wraps every 65536 cycles, far longer than any response takes to start
+	u16 cycles = si_timing.tx_start - si_timing.rx_end;
+	u32 bin = cycles >> STATS_LATENCY_SHIFT;
+
+	stats.latency[(bin < STATS_LATENCY_BINS) ? bin : (STATS_LATENCY_BINS - 1)]++;
+	if(cycles > stats.latency_max) { stats.latency_max = cycles; }
+}
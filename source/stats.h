@@ -0,0 +1,77 @@
+#ifndef GBA_STATS_H
+#define GBA_STATS_H
+
+#include <gba_types.h>
+
+#include "si.h"
+#include "state.h"
+
+#define STATS_MAGIC 0x53544154
+
+//Bump whenever struct si_stats changes so older SRAM contents are discarded
+#define STATS_VERSION 5
+
+//Hexview tag for the statistics block
+#define STATS_TAG 0x5A
+
+//Frames between the copies stats_save_job() writes to SRAM during a send session
+#define STATS_SAVE_FRAMES 60
+
+//Frame lengths are binned 64 bits (8 bytes) at a time, the last bin takes everything longer
+#define STATS_LENGTH_BINS 16
+#define STATS_LENGTH_SHIFT 6
+
+//Response latency is binned 256 cycles (~15us) at a time, the last bin takes everything longer
+#define STATS_LATENCY_BINS 16
+#define STATS_LATENCY_SHIFT 8
+
+enum
+{
+	STATS_OP_ID,
+	STATS_OP_STATUS,
+	STATS_OP_DATA,
+	STATS_OP_RESET,
+	STATS_OP_UNKNOWN,
+	STATS_OPS
+};
+
+//Every counter is a plain increment in the capture loop, anything heavier waits for stats_save()
+struct si_stats
+{
+	u32 magic;
+	u32 version;
+	u32 sessions;
+	u32 frames;
+	u32 lengths[STATS_LENGTH_BINS];
+	u32 opcodes[STATS_OPS];
+	u32 responses;
+	u32 pings;
+	u32 writes;
+	u32 short_frames;
+	u32 length_mismatch;
+	u32 aborts;
+
+	//Commands that began before the wait for them, usually while an idle job ran, and were dropped
+	u32 late;
+	u32 max_bits;
+
+	//Cycles from the last sampled bit of a command to the first edge of its response
+	u32 latency[STATS_LATENCY_BINS];
+	u32 latency_max;
+
+	//Snapshot of the last session's bit timing
+	struct si_timing timing;
+
+	//Startup time of the boot the last session ran in
+	struct boot_timing boot;
+};
+
+extern struct si_stats stats;
+
+void stats_clear();
+void stats_load();
+void stats_save();
+bool stats_save_job();
+void stats_latency();
+
+#endif /* GBA_STATS_H */
@@ -0,0 +1,99 @@
+#include "common.h"
+#include "hexview.h"
+#include "telemetry.h"
+
+struct telemetry_state telemetry;
+
+void telemetry_reset()
+{
+	telemetry.ids = 0;
+	telemetry.statuses = 0;
+	telemetry.pings = 0;
+	telemetry.writes = 0;
+	telemetry.last_cmd = 0;
+
+	telemetry.rate = 0;
+	telemetry.window_count = 0;
+	telemetry.window_frames = 0;
+
+	//Nothing is on screen yet, so every cell starts out of date
+	for(u8 x = 0; x < TELEMETRY_CELLS; x++) { telemetry.shown[x] = 0xFF; }
+	telemetry.next_cell = 0;
+}
+
+u8 telemetry_digit(u8 cell, u32* sx)
+{
+	//Groups of 4 hex digits for the counters, 8 pixels apart with a 6 pixel gap between groups
+	if(cell < 16)
+	{
+		u32 value = 0;
+
+		switch(cell / 4)
+		{
+			case 0: value = telemetry.ids; break;
+			case 1: value = telemetry.statuses; break;
+			case 2: value = telemetry.pings; break;
+			case 3: value = telemetry.writes; break;
+		}
+
+		*sx = TELEMETRY_X + ((cell / 4) * 38) + ((cell % 4) * 8);
+		return (value >> ((3 - (cell % 4)) * 4)) & 0xF;
+	}
+
+	else if(cell < 18)
+	{
+		*sx = TELEMETRY_X + 152 + ((cell - 16) * 8);
+		return (telemetry.last_cmd >> ((17 - cell) * 4)) & 0xF;
+	}
+
+	else
+	{
+		u32 value = (telemetry.rate > 999) ? 999 : telemetry.rate;
+
+		*sx = TELEMETRY_X + 174 + ((cell - 18) * 8);
+
+		switch(cell)
+		{
+			case 18: return (value / 100);
+			case 19: return ((value / 10) % 10);
+			default: return (value % 10);
+		}
+	}
+}
+
+void telemetry_gap()
+{
+	telemetry.window_count++;
+}
+
+void telemetry_frame()
+{
+	//The LCD runs at 59.73 frames per second, so scale the count over 60 of them to one second
+	if(++telemetry.window_frames < TELEMETRY_WINDOW_FRAMES) { return; }
+
+	telemetry.rate = (telemetry.window_count * 5973) / (TELEMETRY_WINDOW_FRAMES * 100);
+	telemetry.window_count = 0;
+	telemetry.window_frames = 0;
+}
+
+bool telemetry_draw_job()
+{
+	//Redraw at most one out of date glyph per run
+	for(u8 x = 0; x < TELEMETRY_CELLS; x++)
+	{
+		u8 cell = telemetry.next_cell;
+		u32 sx = 0;
+		u8 digit = telemetry_digit(cell, &sx);
+
+		telemetry.next_cell = (cell + 1) % TELEMETRY_CELLS;
+
+		if(digit != telemetry.shown[cell])
+		{
+			draw_hex_digit(digit, sx, TELEMETRY_Y);
+			telemetry.shown[cell] = digit;
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,43 @@
+#ifndef GBA_TELEMETRY_H
+#define GBA_TELEMETRY_H
+
+#include <gba_types.h>
+
+//Overlay strip along the bottom of the send screen
+#define TELEMETRY_X 4
+#define TELEMETRY_Y 148
+
+//4 hex digits each for IDs, statuses, pings and writes, 2 for the last command, 3 decimal for the rate
+#define TELEMETRY_CELLS 21
+
+//Frames the commands per second rate is counted over
+#define TELEMETRY_WINDOW_FRAMES 60
+
+//Worst case cost of one telemetry_draw_job() call
+#define TELEMETRY_DRAW_CYCLES 4096
+
+struct telemetry_state
+{
+	u32 ids;
+	u32 statuses;
+	u32 pings;
+	u32 writes;
+	u8 last_cmd;
+
+	//Commands per second, counted over TELEMETRY_WINDOW_FRAMES send frames
+	u16 rate;
+	u16 window_count;
+	u8 window_frames;
+
+	u8 shown[TELEMETRY_CELLS];
+	u8 next_cell;
+};
+
+extern struct telemetry_state telemetry;
+
+void telemetry_reset();
+void telemetry_gap();
+void telemetry_frame();
+bool telemetry_draw_job();
+
+#endif /* GBA_TELEMETRY_H */
@@ -0,0 +1,61 @@
+#include "common.h"
+#include "timers.h"
+
+u8 timer_owners[TIMERS] = { TIMER_FREE, TIMER_FREE, TIMER_FREE, TIMER_FREE };
+
+void timer_conflict(u8 timer)
+{
+	//Two owners on one timer would silently break Joybus timing, so stop on a red backdrop instead
+	IO_H[0] = 0x80;
+	((vu16*)0x05000000)[0] = 0x001F;
+	IO_H[0] = 0x0;
+
+	while(true) { }
+}
+
+bool timer_reserve(u8 timer, u8 owner)
+{
+	if(timer >= TIMERS) { return false; }
+
+	if((timer_owners[timer] != TIMER_FREE) && (timer_owners[timer] != owner))
+	{
+		timer_conflict(timer);
+		return false;
+	}
+
+	timer_owners[timer] = owner;
+	return true;
+}
+
+bool timer_cascade(u8 timer, u8 owner)
+{
+	//Reserve a timer and the next one up, which counts its overflows
+	if(!timer_reserve(timer, owner)) { return false; }
+
+	if(!timer_reserve(timer + 1, owner))
+	{
+		timer_release(timer, owner);
+		return false;
+	}
+
+	return true;
+}
+
+void timer_release(u8 timer, u8 owner)
+{
+	if((timer >= TIMERS) || (timer_owners[timer] != owner))
+	{
+		timer_conflict(timer);
+		return;
+	}
+
+	TIMER_CNT_H(timer) = 0;
+	timer_owners[timer] = TIMER_FREE;
+}
+
+void timer_start(u8 timer, u16 reload, u16 control)
+{
+	TIMER_CNT_H(timer) = 0;
+	TIMER_CNT_L(timer) = reload;
+	TIMER_CNT_H(timer) = control;
+}
@@ -0,0 +1,46 @@
+#ifndef GBA_TIMERS_H
+#define GBA_TIMERS_H
+
+//Shared with joybus.s, everything C-only sits behind __ASSEMBLER__
+#ifndef __ASSEMBLER__
+#include <gba_types.h>
+#endif
+
+#define TIMER_CNT_L(n) IO_H[128 + ((n) * 2)]
+#define TIMER_CNT_H(n) IO_H[129 + ((n) * 2)]
+#define TIMER_IRQ_MASK(n) (0x8 << (n))
+
+#define TIMERS 4
+
+//Fixed assignment for the Joybus path, see SIGetCommand
+#define SI_TIMER_BIT   0	//End-of-command timeout, restarted on every bit
+#define SI_TIMER_COUNT 1	//Counts SI_TIMER_BIT overflows (cascade)
+#define SI_TIMER_IDLE  2	//Idle timeout before dropping from Halt to Stop
+
+//Free-running CPU clock shared by IRQ accounting and profiling
+#define PROFILE_TIMER  3
+
+#ifndef __ASSEMBLER__
+
+_Static_assert(SI_TIMER_COUNT == (SI_TIMER_BIT + 1), "SI_TIMER_COUNT must cascade from SI_TIMER_BIT");
+_Static_assert((SI_TIMER_IDLE != SI_TIMER_BIT) && (SI_TIMER_IDLE != SI_TIMER_COUNT), "SI timers overlap");
+_Static_assert((PROFILE_TIMER != SI_TIMER_BIT) && (PROFILE_TIMER != SI_TIMER_COUNT) && (PROFILE_TIMER != SI_TIMER_IDLE), "PROFILE_TIMER overlaps the Joybus timers");
+
+enum
+{
+	TIMER_FREE = 0,
+	TIMER_OWNER_JOYBUS,
+	TIMER_OWNER_PROFILER,
+	TIMER_OWNER_UI
+};
+
+extern u8 timer_owners[TIMERS];
+
+bool timer_reserve(u8 timer, u8 owner);
+bool timer_cascade(u8 timer, u8 owner);
+void timer_release(u8 timer, u8 owner);
+void timer_start(u8 timer, u16 reload, u16 control);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* GBA_TIMERS_H */
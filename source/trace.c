@@ -0,0 +1,37 @@
+#include "common.h"
+#include "idle.h"
+#include "stats.h"
+#include "trace.h"
+
+#ifdef TRACE
+#define SRAM ((vu8*)0x0E000000)
+
+_Static_assert(sizeof(struct si_stats) <= TRACE_SRAM_OFFSET, "the statistics block runs into the saved trace");
+_Static_assert((TRACE_EVENTS & (TRACE_EVENTS - 1)) == 0, "TRACE_EVENTS must be a power of two");
+
+IWRAM_DATA struct trace_ring trace = { TRACE_MAGIC, 0 };
+
+static struct idle_copy save_copy;
+static u32 save_frame;
+
+void trace_save()
+{
+	const u8* src = (const u8*)&trace;
+
+	for(u32 x = 0; x < sizeof(trace); x++) { SRAM[TRACE_SRAM_OFFSET + x] = src[x]; }
+}
+
+bool trace_save_job()
+{
+	//Same as stats_save_job(), events recorded while a copy is under way may or may not make it in
+	if(save_copy.done == save_copy.length)
+	{
+		if((frame_count - save_frame) < TRACE_SAVE_FRAMES) { return false; }
+
+		save_frame = frame_count;
+		idle_copy_start(&save_copy, &trace, &SRAM[TRACE_SRAM_OFFSET], sizeof(trace));
+	}
+
+	return idle_copy_run(&save_copy);
+}
+#endif
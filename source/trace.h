@@ -0,0 +1,109 @@
+#ifndef GBA_TRACE_H
+#define GBA_TRACE_H
+
+/*
+  Trace points for the UI and the Joybus path. Built with TRACE=1 in the
+  Makefile, each one stores an 8 byte event in a ring in IWRAM: the event,
+  its phase, PROFILE_TIMER, VCOUNT, frame_count and a 16 bit argument.
+  Otherwise every macro is empty and the ring does not exist.
+
+  A point costs about 20 cycles, so with tracing on a response goes out
+  ~1us later than usual. During a send session trace_save_job() copies
+  the ring into SRAM in idle time every TRACE_SAVE_FRAMES, and
+  trace_save() writes a final copy once it ends. tools/trace2json.c turns
+  a save file (or any memory dump holding the ring) into a Chrome trace.
+*/
+
+//Event name, then the timeline row it goes on. tools/trace2json.c includes this list with TRACE_HOST defined
+#define TRACE_EVENT_LIST(X) \
+	X(TRACE_STATE,        "state",               0) \
+	X(TRACE_JOB,          "job",                 0) \
+	X(TRACE_FRAME,        "frame",               0) \
+	X(TRACE_DRAW_SCREEN,  "draw_screen",         1) \
+	X(TRACE_DRAW_CHANGES, "draw_screen_changes", 1) \
+	X(TRACE_DRAW_BITMAP,  "draw_bitmap",         1) \
+	X(TRACE_DRAW_FONT,    "draw_font",           1) \
+	X(TRACE_DRAW_KANA,    "draw_kana",           1) \
+	X(TRACE_DRAW_NUMBER,  "draw_number",         1) \
+	X(TRACE_SI_COMMAND,   "si_command",          2) \
+	X(TRACE_SI_RESPONSE,  "si_response",         2)
+
+//Phase in the top bits of the event byte
+#define TRACE_MARK_PHASE  0x00
+#define TRACE_BEGIN_PHASE 0x40
+#define TRACE_END_PHASE   0x80
+#define TRACE_ID_MASK     0x3F
+
+//Ring size in events, a power of two
+#define TRACE_EVENTS 256
+
+//Where trace_save() puts the ring, clear of the statistics block
+#define TRACE_SRAM_OFFSET 0x1000
+
+//Frames between the copies trace_save_job() writes during a send session
+#define TRACE_SAVE_FRAMES 60
+
+#define TRACE_MAGIC 0x45435254
+
+#define TRACE_ENUM(id, name, row) id,
+enum
+{
+	TRACE_EVENT_LIST(TRACE_ENUM)
+	TRACE_IDS
+};
+#undef TRACE_ENUM
+
+#ifndef TRACE_HOST
+#include <gba_types.h>
+
+#include "irq.h"
+#include "timers.h"
+
+struct trace_event
+{
+	u8 id;
+	u8 line;
+	u16 time;
+	u16 frame;
+	u16 arg;
+};
+
+//Header and ring are saved as one block, events[next % TRACE_EVENTS] is the oldest once it has wrapped
+struct trace_ring
+{
+	u32 magic;
+	u32 next;
+	struct trace_event events[TRACE_EVENTS];
+};
+
+#ifdef TRACE
+extern struct trace_ring trace;
+
+static inline void trace_write(u8 id, u16 arg)
+{
+	struct trace_event* event = &trace.events[trace.next++ & (TRACE_EVENTS - 1)];
+
+	event->id = id;
+	event->line = IO_H[3];
+	event->time = TIMER_CNT_L(PROFILE_TIMER);
+	event->frame = frame_count;
+	event->arg = arg;
+}
+
+void trace_save();
+bool trace_save_job();
+
+#define TRACE_MARK(id, arg)  trace_write((id) | TRACE_MARK_PHASE, (arg))
+#define TRACE_BEGIN(id, arg) trace_write((id) | TRACE_BEGIN_PHASE, (arg))
+#define TRACE_END(id, arg)   trace_write((id) | TRACE_END_PHASE, (arg))
+#define TRACE_SAVE()         trace_save()
+#else
+#define TRACE_MARK(id, arg)
+#define TRACE_BEGIN(id, arg)
+#define TRACE_END(id, arg)
+#define TRACE_SAVE()
+#endif
+
+#endif /* TRACE_HOST */
+
+#endif /* GBA_TRACE_H */
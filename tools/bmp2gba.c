@@ -0,0 +1,981 @@
+/*
+  bmp2gba - converts BMPs into C arrays for the GBA renderers.
+
+  Usage: bmp2gba <input.bmp> <name> <output.c> <output.h>
+         bmp2gba -t <name> <output.c> <output.h> [-p] <input.bmp>... [-d <input.bmp>...]
+         bmp2gba -g <input.bmp> <name> <output.c> <output.h>
+
+  Reads 1, 4, 8, 24 and 32-bit (BI_RGB or BI_BITFIELDS) bitmaps.
+
+  The first form writes a 4-byte aligned u16 array of BGR555 pixels,
+  row-major from the top left, the layout draw_bitmap() and friends expect.
+  The header carries the width, height, format and byte size so callers
+  don't hardcode them.
+
+  The second form (-t) cuts every input into 8x8 tiles, keeps one copy of
+  each tile shared by all inputs (a tile matching another one flipped
+  counts as the same tile), and writes the tileset plus one map per input
+  named after its file. A report of the saving goes to stdout.
+
+  Inputs after -d are stored as deltas against the input just before it:
+  a list of tile rectangles (x, y, w, h in tiles) where they differ from
+  that base, and the map entries inside them row by row, instead of a full
+  map.
+
+  With -p the tiles hold 8-bit palette indices for Mode 4 instead of
+  BGR555 pixels. Every input gets a 256 colour palette, shared with the
+  inputs stored as deltas against it: indices 0 and 1 are black and white
+  for the overlays, the rest come from a median cut of the input's colours,
+  with Floyd-Steinberg dithering where it has more than fit.
+
+  The third form (-g) reads a black on white font sheet of 16x16 glyphs,
+  20 to a row, addressed by a byte. Only glyphs with ink, plus glyph 0 as
+  the blank, are kept; duplicates are stored once. It writes a 256 entry
+  index map (GLYPH_NONE for unusable indices) and a dense atlas of 1bpp
+  glyphs, one u16 per row with the leftmost pixel in bit 15.
+*/
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BI_RGB       0
+#define BI_BITFIELDS 3
+
+#define TILE_SIZE  8
+#define TILE_AREA  (TILE_SIZE * TILE_SIZE)
+
+//Map entries, matching TILE_* in the generated header
+#define TILE_INDEX_MASK 0x3FFF
+#define TILE_HFLIP      0x4000
+#define TILE_VFLIP      0x8000
+
+#define HASH_SLOTS 16384
+
+#define GLYPH_SIZE    16
+#define GLYPH_COLUMNS 20
+#define GLYPH_INDICES 256
+#define GLYPH_NONE    0xFF
+
+//Palette indices kept for the overlays, which only draw black and white
+#define PALETTE_SIZE  256
+#define PALETTE_BLACK 0
+#define PALETTE_WHITE 1
+#define PALETTE_FIXED 2
+
+struct rect
+{
+	uint8_t x;
+	uint8_t y;
+	uint8_t w;
+	uint8_t h;
+};
+
+struct image
+{
+	int width;
+	int height;
+	uint16_t* pixels;
+};
+
+static uint32_t read_u16(const uint8_t* src) { return src[0] | (src[1] << 8); }
+static uint32_t read_u32(const uint8_t* src) { return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24); }
+
+static void fail(const char* path, const char* reason)
+{
+	fprintf(stderr, "bmp2gba: %s: %s\n", path, reason);
+	exit(1);
+}
+
+static uint8_t* read_file(const char* path, long* size)
+{
+	FILE* file = fopen(path, "rb");
+	if(!file) { fail(path, "cannot open"); }
+
+	fseek(file, 0, SEEK_END);
+	*size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	uint8_t* data = malloc(*size);
+	if(!data || (fread(data, 1, *size, file) != (size_t)*size)) { fail(path, "cannot read"); }
+
+	fclose(file);
+	return data;
+}
+
+//Scales a masked channel to 5 bits, taking the top bits like the original conversion
+static uint16_t channel(uint32_t value, uint32_t mask)
+{
+	if(!mask) { return 0; }
+
+	int shift = 0;
+	int bits = 0;
+
+	while(!(mask & 1)) { mask >>= 1; shift++; }
+	while(mask & 1) { mask >>= 1; bits++; }
+
+	value = (value >> shift) & ((1u << bits) - 1);
+	return (bits >= 5) ? (value >> (bits - 5)) : (value << (5 - bits));
+}
+
+static uint16_t bgr555(uint8_t r, uint8_t g, uint8_t b)
+{
+	return (r >> 3) | ((g >> 3) << 5) | ((b >> 3) << 10);
+}
+
+static struct image load_bmp(const char* path)
+{
+	long size = 0;
+	uint8_t* data = read_file(path, &size);
+
+	if((size < 54) || (data[0] != 'B') || (data[1] != 'M')) { fail(path, "not a BMP"); }
+
+	uint32_t offset = read_u32(data + 10);
+	uint32_t header = read_u32(data + 14);
+	int32_t width = (int32_t)read_u32(data + 18);
+	int32_t height = (int32_t)read_u32(data + 22);
+	uint32_t bpp = read_u16(data + 28);
+	uint32_t compression = read_u32(data + 30);
+	uint32_t colors = read_u32(data + 46);
+
+	//Positive heights are stored bottom-up
+	int bottom_up = (height > 0);
+	if(height < 0) { height = -height; }
+
+	if((width <= 0) || (height == 0)) { fail(path, "bad dimensions"); }
+	if((compression != BI_RGB) && (compression != BI_BITFIELDS)) { fail(path, "compressed BMPs are not supported"); }
+	if((bpp != 1) && (bpp != 4) && (bpp != 8) && (bpp != 24) && (bpp != 32)) { fail(path, "unsupported bit depth"); }
+
+	//Channel masks, either explicit or the BI_RGB defaults
+	uint32_t masks[3] = { 0x00FF0000, 0x0000FF00, 0x000000FF };
+
+	if(compression == BI_BITFIELDS)
+	{
+		//Version 1 headers keep the masks just past the header, later versions inside it
+		const uint8_t* src = data + 14 + ((header >= 52) ? 40 : header);
+		masks[0] = read_u32(src);
+		masks[1] = read_u32(src + 4);
+		masks[2] = read_u32(src + 8);
+	}
+
+	//Palette for indexed formats, stored as BGRx quads after the header
+	uint16_t palette[256] = { 0 };
+
+	if(bpp <= 8)
+	{
+		uint32_t entries = colors ? colors : (1u << bpp);
+		const uint8_t* src = data + 14 + header;
+
+		if(entries > 256) { fail(path, "bad palette size"); }
+
+		for(uint32_t x = 0; x < entries; x++, src += 4) { palette[x] = bgr555(src[2], src[1], src[0]); }
+	}
+
+	uint32_t stride = (((width * bpp) + 31) / 32) * 4;
+	if((offset + (stride * height)) > (uint32_t)size) { fail(path, "truncated pixel data"); }
+
+	struct image image;
+	image.width = width;
+	image.height = height;
+	image.pixels = malloc(width * height * sizeof(uint16_t));
+
+	for(int y = 0; y < height; y++)
+	{
+		const uint8_t* row = data + offset + (stride * (bottom_up ? (height - 1 - y) : y));
+		uint16_t* dst = image.pixels + (y * width);
+
+		for(int x = 0; x < width; x++)
+		{
+			switch(bpp)
+			{
+				case 1: dst[x] = palette[(row[x >> 3] >> (7 - (x & 7))) & 1]; break;
+				case 4: dst[x] = palette[(row[x >> 1] >> ((x & 1) ? 0 : 4)) & 0xF]; break;
+				case 8: dst[x] = palette[row[x]]; break;
+				case 24: dst[x] = bgr555(row[(x * 3) + 2], row[(x * 3) + 1], row[x * 3]); break;
+
+				case 32:
+				{
+					uint32_t value = read_u32(row + (x * 4));
+					dst[x] = channel(value, masks[0]) | (channel(value, masks[1]) << 5) | (channel(value, masks[2]) << 10);
+					break;
+				}
+			}
+		}
+	}
+
+	free(data);
+	return image;
+}
+
+static FILE* create(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if(!file) { fail(path, "cannot create"); }
+	return file;
+}
+
+static const char* file_name(const char* path)
+{
+	const char* base = strrchr(path, '/');
+	return base ? (base + 1) : path;
+}
+
+static void upper_case(char* dst, const char* src, size_t size)
+{
+	size_t length = strlen(src);
+	if(length >= size) { fail(src, "name too long"); }
+	for(size_t x = 0; x <= length; x++) { dst[x] = toupper((unsigned char)src[x]); }
+}
+
+//Array name for an input, its file name without the extension
+static void screen_name(char* dst, const char* path, size_t size)
+{
+	snprintf(dst, size, "%s", file_name(path));
+	char* dot = strrchr(dst, '.');
+	if(dot) { *dot = 0; }
+}
+
+static void write_u16s(FILE* file, const uint16_t* values, uint32_t count, const char* indent)
+{
+	for(uint32_t x = 0; x < count; x++)
+	{
+		if((x % 16) == 0) { fprintf(file, "\n%s", indent); }
+		fprintf(file, "0x%04X,%s", values[x], ((x % 16) == 15) ? "" : " ");
+	}
+}
+
+static void write_u8s(FILE* file, const uint16_t* values, uint32_t count, const char* indent)
+{
+	for(uint32_t x = 0; x < count; x++)
+	{
+		if((x % 16) == 0) { fprintf(file, "\n%s", indent); }
+		fprintf(file, "0x%02X,%s", values[x], ((x % 16) == 15) ? "" : " ");
+	}
+}
+
+static uint32_t hash_tile(const uint16_t* tile)
+{
+	uint32_t hash = 2166136261u;
+
+	for(int x = 0; x < TILE_AREA; x++)
+	{
+		hash = (hash ^ (tile[x] & 0xFF)) * 16777619u;
+		hash = (hash ^ (tile[x] >> 8)) * 16777619u;
+	}
+
+	return hash;
+}
+
+static void flip_tile(uint16_t* dst, const uint16_t* src, uint16_t flags)
+{
+	for(int y = 0; y < TILE_SIZE; y++)
+	{
+		for(int x = 0; x < TILE_SIZE; x++)
+		{
+			int sx = (flags & TILE_HFLIP) ? (TILE_SIZE - 1 - x) : x;
+			int sy = (flags & TILE_VFLIP) ? (TILE_SIZE - 1 - y) : y;
+			dst[(y * TILE_SIZE) + x] = src[(sy * TILE_SIZE) + sx];
+		}
+	}
+}
+
+struct tileset
+{
+	uint16_t* tiles;
+	uint32_t count;
+	uint32_t capacity;
+	int32_t slots[HASH_SLOTS];
+};
+
+//Slot holding an identical tile, or the empty slot it would go in
+static int32_t* find_tile(struct tileset* set, const uint16_t* tile)
+{
+	uint32_t slot = hash_tile(tile) % HASH_SLOTS;
+
+	while(set->slots[slot] >= 0)
+	{
+		if(!memcmp(set->tiles + (set->slots[slot] * TILE_AREA), tile, TILE_AREA * sizeof(uint16_t))) { break; }
+		slot = (slot + 1) % HASH_SLOTS;
+	}
+
+	return &set->slots[slot];
+}
+
+//Returns a map entry for the tile, adding it to the set if no flip of it is there yet
+static uint16_t add_tile(struct tileset* set, const uint16_t* tile)
+{
+	static const uint16_t flips[4] = { 0, TILE_HFLIP, TILE_VFLIP, TILE_HFLIP | TILE_VFLIP };
+	uint16_t flipped[TILE_AREA];
+
+	for(int x = 0; x < 4; x++)
+	{
+		//A flip is its own inverse, so the stored tile flipped the same way gives back this one
+		flip_tile(flipped, tile, flips[x]);
+		int32_t* slot = find_tile(set, flipped);
+		if(*slot >= 0) { return *slot | flips[x]; }
+	}
+
+	if(set->count > TILE_INDEX_MASK) { fail("tileset", "too many unique tiles"); }
+	if(set->count == (HASH_SLOTS / 2)) { fail("tileset", "hash table full"); }
+
+	if(set->count == set->capacity)
+	{
+		set->capacity = set->capacity ? (set->capacity * 2) : 256;
+		set->tiles = realloc(set->tiles, set->capacity * TILE_AREA * sizeof(uint16_t));
+	}
+
+	memcpy(set->tiles + (set->count * TILE_AREA), tile, TILE_AREA * sizeof(uint16_t));
+	*find_tile(set, tile) = set->count;
+
+	return set->count++;
+}
+
+struct color_count
+{
+	uint16_t color;
+	uint32_t count;
+};
+
+static int channel_of(uint16_t color, int c) { return (color >> (c * 5)) & 0x1F; }
+
+static int sort_channel;
+
+static int compare_channel(const void* a, const void* b)
+{
+	return channel_of(((const struct color_count*)a)->color, sort_channel) - channel_of(((const struct color_count*)b)->color, sort_channel);
+}
+
+//Median cut: keep splitting the box with the widest channel at its weighted median until the palette is full
+static int median_cut(uint16_t* palette, struct color_count* colors, int count, int slots)
+{
+	int starts[PALETTE_SIZE + 1] = { 0, count };
+	int boxes = 1;
+
+	while(boxes < slots)
+	{
+		int best = -1;
+		int best_channel = 0;
+		int best_range = 0;
+
+		for(int b = 0; b < boxes; b++)
+		{
+			for(int c = 0; c < 3; c++)
+			{
+				int lo = 31;
+				int hi = 0;
+
+				for(int x = starts[b]; x < starts[b + 1]; x++)
+				{
+					int value = channel_of(colors[x].color, c);
+					if(value < lo) { lo = value; }
+					if(value > hi) { hi = value; }
+				}
+
+				if((hi - lo) > best_range) { best = b; best_channel = c; best_range = hi - lo; }
+			}
+		}
+
+		//Every box is down to a single colour
+		if(best < 0) { break; }
+
+		sort_channel = best_channel;
+		qsort(colors + starts[best], starts[best + 1] - starts[best], sizeof(struct color_count), compare_channel);
+
+		uint64_t weight = 0;
+		uint64_t half = 0;
+		for(int x = starts[best]; x < starts[best + 1]; x++) { weight += colors[x].count; }
+
+		//Split after the colour that reaches half the weight, leaving at least one colour on each side
+		int split = starts[best] + 1;
+		for(int x = starts[best]; x < (starts[best + 1] - 1); x++)
+		{
+			half += colors[x].count;
+			split = x + 1;
+			if((half * 2) >= weight) { break; }
+		}
+
+		memmove(starts + best + 2, starts + best + 1, (boxes - best) * sizeof(int));
+		starts[best + 1] = split;
+		boxes++;
+	}
+
+	for(int b = 0; b < boxes; b++)
+	{
+		uint64_t sum[3] = { 0, 0, 0 };
+		uint64_t weight = 0;
+
+		for(int x = starts[b]; x < starts[b + 1]; x++)
+		{
+			for(int c = 0; c < 3; c++) { sum[c] += (uint64_t)channel_of(colors[x].color, c) * colors[x].count; }
+			weight += colors[x].count;
+		}
+
+		palette[b] = 0;
+		for(int c = 0; c < 3; c++) { palette[b] |= ((sum[c] + (weight / 2)) / weight) << (c * 5); }
+	}
+
+	return boxes;
+}
+
+static uint8_t nearest(const uint16_t* palette, int r, int g, int b)
+{
+	int best = 0;
+	int best_distance = 1 << 30;
+
+	for(int x = 0; x < PALETTE_SIZE; x++)
+	{
+		int dr = channel_of(palette[x], 0) - r;
+		int dg = channel_of(palette[x], 1) - g;
+		int db = channel_of(palette[x], 2) - b;
+		int distance = (dr * dr) + (dg * dg) + (db * db);
+
+		if(distance < best_distance) { best = x; best_distance = distance; }
+	}
+
+	return best;
+}
+
+//Builds one palette for a group of images and replaces their pixels with indices into it
+static uint32_t palettise(uint16_t* palette, struct image** group, int members)
+{
+	static uint32_t histogram[32768];
+	static struct color_count colors[32768];
+	int count = 0;
+
+	memset(histogram, 0, sizeof(histogram));
+
+	for(int m = 0; m < members; m++)
+	{
+		for(int x = 0; x < (group[m]->width * group[m]->height); x++) { histogram[group[m]->pixels[x] & 0x7FFF]++; }
+	}
+
+	for(int x = 1; x < 0x7FFF; x++)
+	{
+		if(histogram[x]) { colors[count++] = (struct color_count){ x, histogram[x] }; }
+	}
+
+	memset(palette, 0, PALETTE_SIZE * sizeof(uint16_t));
+	palette[PALETTE_BLACK] = 0x0000;
+	palette[PALETTE_WHITE] = 0x7FFF;
+
+	//Unused entries stay black, so they never win over PALETTE_BLACK
+	if(count) { median_cut(palette + PALETTE_FIXED, colors, count, PALETTE_SIZE - PALETTE_FIXED); }
+
+	for(int m = 0; m < members; m++)
+	{
+		struct image* image = group[m];
+
+		//Error carried to the next pixel and the row below, in 1/16ths of a 5-bit step
+		int* errors = calloc((image->width + 2) * 2 * 3, sizeof(int));
+
+		for(int y = 0; y < image->height; y++)
+		{
+			int* current = errors + (((y & 1) ? 1 : 0) * (image->width + 2) * 3);
+			int* next = errors + (((y & 1) ? 0 : 1) * (image->width + 2) * 3);
+			memset(next, 0, (image->width + 2) * 3 * sizeof(int));
+
+			for(int x = 0; x < image->width; x++)
+			{
+				uint16_t* pixel = &image->pixels[(y * image->width) + x];
+				int want[3];
+
+				for(int c = 0; c < 3; c++)
+				{
+					want[c] = channel_of(*pixel, c) + (current[((x + 1) * 3) + c] / 16);
+					if(want[c] < 0) { want[c] = 0; }
+					if(want[c] > 31) { want[c] = 31; }
+				}
+
+				uint8_t index = nearest(palette, want[0], want[1], want[2]);
+
+				for(int c = 0; c < 3; c++)
+				{
+					int error = want[c] - channel_of(palette[index], c);
+					current[((x + 2) * 3) + c] += error * 7;
+					next[(x * 3) + c] += error * 3;
+					next[((x + 1) * 3) + c] += error * 5;
+					next[((x + 2) * 3) + c] += error;
+				}
+
+				*pixel = index;
+			}
+		}
+
+		free(errors);
+	}
+
+	return count;
+}
+
+//Runs of changed tiles in each row, a run continuing one of the same span in the row above grows that rectangle
+static uint32_t delta_rects(struct rect* rects, const uint16_t* map, const uint16_t* base, uint32_t columns, uint32_t rows)
+{
+	uint32_t count = 0;
+
+	for(uint32_t y = 0; y < rows; y++)
+	{
+		uint32_t x = 0;
+
+		while(x < columns)
+		{
+			if(map[(y * columns) + x] == base[(y * columns) + x]) { x++; continue; }
+
+			uint32_t start = x;
+			while((x < columns) && (map[(y * columns) + x] != base[(y * columns) + x])) { x++; }
+
+			uint32_t r = 0;
+			while((r < count) && !((rects[r].x == start) && (rects[r].w == (x - start)) && ((rects[r].y + rects[r].h) == y))) { r++; }
+
+			if(r < count) { rects[r].h++; }
+			else { rects[count++] = (struct rect){ start, y, x - start, 1 }; }
+		}
+	}
+
+	return count;
+}
+
+static int tile_main(int argc, char** argv)
+{
+	if(argc < 6)
+	{
+		fprintf(stderr, "usage: bmp2gba -t <name> <output.c> <output.h> <input.bmp>... [-d <input.bmp>...]\n");
+		return 1;
+	}
+
+	const char* name = argv[2];
+	char** inputs = calloc(argc, sizeof(char*));
+	int* bases = calloc(argc, sizeof(int));
+	int screens = 0;
+	int base = -1;
+	int paletted = 0;
+
+	//Everything after -d is a delta against the input before it
+	for(int x = 5; x < argc; x++)
+	{
+		if(!strcmp(argv[x], "-p")) { paletted = 1; continue; }
+
+		if(!strcmp(argv[x], "-d"))
+		{
+			if(!screens || (base >= 0)) { fail(argv[x], "needs exactly one base input before it"); }
+			base = screens - 1;
+			continue;
+		}
+
+		bases[screens] = base;
+		inputs[screens++] = argv[x];
+	}
+
+	static struct tileset set;
+	memset(set.slots, 0xFF, sizeof(set.slots));
+
+	uint16_t** maps = calloc(screens, sizeof(uint16_t*));
+	struct rect** rects = calloc(screens, sizeof(struct rect*));
+	uint32_t* rect_counts = calloc(screens, sizeof(uint32_t));
+	uint16_t** patches = calloc(screens, sizeof(uint16_t*));
+	uint32_t* patch_counts = calloc(screens, sizeof(uint32_t));
+	struct image* images = calloc(screens, sizeof(struct image));
+	uint16_t (*palettes)[PALETTE_SIZE] = calloc(screens, sizeof(*palettes));
+	uint32_t* palette_colors = calloc(screens, sizeof(uint32_t));
+	uint32_t total = 0;
+	uint32_t flipped = 0;
+	uint32_t bitmap_bytes = 0;
+	uint32_t map_bytes = 0;
+
+	for(int s = 0; s < screens; s++) { images[s] = load_bmp(inputs[s]); }
+
+	//Each base input and its deltas share a palette, so tiles they have in common stay identical
+	if(paletted)
+	{
+		struct image** group = calloc(screens, sizeof(struct image*));
+
+		for(int s = 0; s < screens; s++)
+		{
+			if(bases[s] >= 0) { continue; }
+
+			int members = 0;
+			for(int m = 0; m < screens; m++)
+			{
+				if((m == s) || (bases[m] == s)) { group[members++] = &images[m]; }
+			}
+
+			palette_colors[s] = palettise(palettes[s], group, members);
+		}
+
+		free(group);
+	}
+
+	for(int s = 0; s < screens; s++)
+	{
+		struct image* image = &images[s];
+
+		if((image->width % TILE_SIZE) || (image->height % TILE_SIZE)) { fail(inputs[s], "dimensions must be multiples of 8"); }
+
+		uint32_t columns = image->width / TILE_SIZE;
+		uint32_t rows = image->height / TILE_SIZE;
+		maps[s] = malloc(columns * rows * sizeof(uint16_t));
+
+		for(uint32_t ty = 0; ty < rows; ty++)
+		{
+			for(uint32_t tx = 0; tx < columns; tx++)
+			{
+				uint16_t tile[TILE_AREA];
+
+				for(int y = 0; y < TILE_SIZE; y++)
+				{
+					memcpy(tile + (y * TILE_SIZE), image->pixels + ((((ty * TILE_SIZE) + y) * image->width) + (tx * TILE_SIZE)), TILE_SIZE * sizeof(uint16_t));
+				}
+
+				uint16_t entry = add_tile(&set, tile);
+				if(entry & (TILE_HFLIP | TILE_VFLIP)) { flipped++; }
+
+				maps[s][(ty * columns) + tx] = entry;
+				total++;
+			}
+		}
+
+		bitmap_bytes += image->width * image->height * sizeof(uint16_t);
+
+		if(bases[s] < 0)
+		{
+			map_bytes += columns * rows * sizeof(uint16_t);
+			continue;
+		}
+
+		if((image->width != images[bases[s]].width) || (image->height != images[bases[s]].height)) { fail(inputs[s], "size differs from its base"); }
+
+		//At most one rectangle per changed tile
+		rects[s] = malloc(columns * rows * sizeof(struct rect));
+		patches[s] = malloc(columns * rows * sizeof(uint16_t));
+		rect_counts[s] = delta_rects(rects[s], maps[s], maps[bases[s]], columns, rows);
+
+		for(uint32_t r = 0; r < rect_counts[s]; r++)
+		{
+			const struct rect* rect = &rects[s][r];
+
+			for(uint32_t y = rect->y; y < (uint32_t)(rect->y + rect->h); y++)
+			{
+				for(uint32_t x = rect->x; x < (uint32_t)(rect->x + rect->w); x++) { patches[s][patch_counts[s]++] = maps[s][(y * columns) + x]; }
+			}
+		}
+
+		map_bytes += (rect_counts[s] * sizeof(struct rect)) + (patch_counts[s] * sizeof(uint16_t));
+	}
+
+	char upper[256];
+	upper_case(upper, name, sizeof(upper));
+
+	//Paletted tiles hold one byte per pixel
+	const char* pixel_type = paletted ? "u8" : "u16";
+	const char* depth = paletted ? "8" : "16";
+	uint32_t pixel_bytes = paletted ? 1 : 2;
+	uint32_t palette_bytes = 0;
+
+	FILE* header = create(argv[4]);
+	fprintf(header, "/*\n  Generated by bmp2gba from");
+	for(int s = 0; s < screens; s++) { fprintf(header, " %s", file_name(inputs[s])); }
+	fprintf(header, ", do not edit.\n*/\n\n");
+	fprintf(header, "#ifndef _%s_h_\n#define _%s_h_\n\n", name, name);
+	fprintf(header, "#include <gba_types.h>\n\n");
+	fprintf(header, "#ifndef ASSET_FORMAT_TILED%s\n#define ASSET_FORMAT_TILED%s %d\n#endif\n\n", depth, depth, paletted ? 3 : 1);
+	fprintf(header, "#ifndef ASSET_FORMAT_DELTA%s\n#define ASSET_FORMAT_DELTA%s %d\n#endif\n\n", depth, depth, paletted ? 4 : 2);
+	fprintf(header, "//Map entries: tile index plus flips\n");
+	fprintf(header, "#define TILE_INDEX_MASK 0x%04X\n#define TILE_HFLIP 0x%04X\n#define TILE_VFLIP 0x%04X\n\n", TILE_INDEX_MASK, TILE_HFLIP, TILE_VFLIP);
+	fprintf(header, "#define %s_BPP %s\n", upper, depth);
+	fprintf(header, "#define %s_TILES %u\n", upper, set.count);
+	fprintf(header, "#define %s_SIZE %u\n\n", upper, set.count * TILE_AREA * pixel_bytes);
+	fprintf(header, "extern const %s %s_tiles[%s_TILES][%d];\n", pixel_type, name, upper, TILE_AREA);
+
+	for(int s = 0; s < screens; s++)
+	{
+		char screen[256];
+		char screen_upper[256];
+
+		screen_name(screen, inputs[s], sizeof(screen));
+		upper_case(screen_upper, screen, sizeof(screen_upper));
+
+		fprintf(header, "\n#define %s_WIDTH %d\n", screen_upper, images[s].width);
+		fprintf(header, "#define %s_HEIGHT %d\n", screen_upper, images[s].height);
+
+		if(bases[s] >= 0)
+		{
+			char base_screen[256];
+			screen_name(base_screen, inputs[bases[s]], sizeof(base_screen));
+
+			fprintf(header, "#define %s_FORMAT ASSET_FORMAT_DELTA%s\n", screen_upper, depth);
+			fprintf(header, "#define %s_BASE %s\n", screen_upper, base_screen);
+			if(paletted) { fprintf(header, "#define %s_PALETTE %s_palette\n", screen_upper, base_screen); }
+			else { fprintf(header, "#define %s_PALETTE ((const u16*)0)\n", screen_upper); }
+			fprintf(header, "#define %s_RECTS %u\n", screen_upper, rect_counts[s]);
+			fprintf(header, "#define %s_SIZE %u\n", screen_upper, (uint32_t)(patch_counts[s] * sizeof(uint16_t)));
+			fprintf(header, "extern const u8 %s_rects[%s_RECTS][4];\n", screen, screen_upper);
+			fprintf(header, "extern const u16 %s_patch[%s_SIZE / 2];\n", screen, screen_upper);
+			continue;
+		}
+
+		fprintf(header, "#define %s_FORMAT ASSET_FORMAT_TILED%s\n", screen_upper, depth);
+		fprintf(header, "#define %s_SIZE %d\n", screen_upper, (images[s].width / TILE_SIZE) * (images[s].height / TILE_SIZE) * 2);
+		fprintf(header, "extern const u16 %s[%s_WIDTH / 8 * %s_HEIGHT / 8];\n", screen, screen_upper, screen_upper);
+
+		//Direct colour screens have no palette to load
+		if(paletted)
+		{
+			fprintf(header, "#define %s_PALETTE %s_palette\n", screen_upper, screen);
+			fprintf(header, "extern const u16 %s_palette[%d];\n", screen, PALETTE_SIZE);
+		}
+		else { fprintf(header, "#define %s_PALETTE ((const u16*)0)\n", screen_upper); }
+	}
+
+	fprintf(header, "\n#endif //_%s_h_\n", name);
+	fclose(header);
+
+	FILE* source = create(argv[3]);
+	fprintf(source, "/*\n  Generated by bmp2gba, do not edit.\n*/\n\n");
+	fprintf(source, "#include \"%s\"\n\n", file_name(argv[4]));
+	fprintf(source, "const %s %s_tiles[%s_TILES][%d] __attribute__((aligned(4))) =\n{", pixel_type, name, upper, TILE_AREA);
+
+	for(uint32_t t = 0; t < set.count; t++)
+	{
+		fprintf(source, "\n\t{");
+		if(paletted) { write_u8s(source, set.tiles + (t * TILE_AREA), TILE_AREA, "\t\t"); }
+		else { write_u16s(source, set.tiles + (t * TILE_AREA), TILE_AREA, "\t\t"); }
+		fprintf(source, "\n\t},");
+	}
+
+	fprintf(source, "\n};\n");
+
+	for(int s = 0; s < screens; s++)
+	{
+		char screen[256];
+		char screen_upper[256];
+
+		screen_name(screen, inputs[s], sizeof(screen));
+		upper_case(screen_upper, screen, sizeof(screen_upper));
+
+		if(bases[s] >= 0)
+		{
+			fprintf(source, "\nconst u8 %s_rects[%s_RECTS][4] =\n{", screen, screen_upper);
+			for(uint32_t r = 0; r < rect_counts[s]; r++) { fprintf(source, "\n\t{ %u, %u, %u, %u },", rects[s][r].x, rects[s][r].y, rects[s][r].w, rects[s][r].h); }
+			fprintf(source, "\n};\n");
+
+			fprintf(source, "\nconst u16 %s_patch[%s_SIZE / 2] __attribute__((aligned(4))) =\n{", screen, screen_upper);
+			write_u16s(source, patches[s], patch_counts[s], "\t");
+			fprintf(source, "\n};\n");
+			continue;
+		}
+
+		fprintf(source, "\nconst u16 %s[%s_WIDTH / 8 * %s_HEIGHT / 8] __attribute__((aligned(4))) =\n{", screen, screen_upper, screen_upper);
+		write_u16s(source, maps[s], (images[s].width / TILE_SIZE) * (images[s].height / TILE_SIZE), "\t");
+		fprintf(source, "\n};\n");
+
+		if(paletted)
+		{
+			fprintf(source, "\nconst u16 %s_palette[%d] __attribute__((aligned(4))) =\n{", screen, PALETTE_SIZE);
+			write_u16s(source, palettes[s], PALETTE_SIZE, "\t");
+			fprintf(source, "\n};\n");
+			palette_bytes += PALETTE_SIZE * sizeof(uint16_t);
+		}
+	}
+
+	fclose(source);
+
+	//Report
+	uint32_t tile_bytes = set.count * TILE_AREA * pixel_bytes;
+	uint32_t tiled_bytes = tile_bytes + map_bytes + palette_bytes;
+
+	printf("%s: %d screens, %u tiles, %u unique (%u placed flipped)\n", name, screens, total, set.count, flipped);
+	printf("%s: ROM %u bytes tiled (%u tiles + %u maps + %u palettes) vs %u as 16-bit bitmaps, saves %u (%.1f%%)\n",
+		name, tiled_bytes, tile_bytes, map_bytes, palette_bytes, bitmap_bytes, bitmap_bytes - tiled_bytes,
+		(100.0 * (bitmap_bytes - tiled_bytes)) / bitmap_bytes);
+
+	for(int s = 0; s < screens; s++)
+	{
+		if(!paletted || (bases[s] >= 0)) { continue; }
+
+		printf("%s: %s palette from %u colours%s\n", name, file_name(inputs[s]), palette_colors[s],
+			((palette_colors[s] + PALETTE_FIXED) > PALETTE_SIZE) ? ", quantised and dithered" : ", exact");
+	}
+
+	for(int s = 0; s < screens; s++)
+	{
+		if(bases[s] < 0) { continue; }
+
+		uint32_t full = (images[s].width / TILE_SIZE) * (images[s].height / TILE_SIZE);
+		printf("%s: %s differs from %s in %u of %u tiles, %u rects, %u bytes vs %u as a map\n",
+			name, file_name(inputs[s]), file_name(inputs[bases[s]]), patch_counts[s], full, rect_counts[s],
+			(uint32_t)((rect_counts[s] * sizeof(struct rect)) + (patch_counts[s] * sizeof(uint16_t))), (uint32_t)(full * sizeof(uint16_t)));
+	}
+
+	if(paletted) { printf("%s: Mode 4 framebuffers, two %u byte frames\n", name, 240 * 160); }
+	else
+	{
+		printf("%s: VRAM unchanged in Mode 3 (one %u byte frame); 8bpp BG tiles would need %u bytes of charblocks\n",
+			name, (uint32_t)(240 * 160 * sizeof(uint16_t)), set.count * TILE_AREA);
+	}
+
+	return 0;
+}
+
+static int glyph_main(int argc, char** argv)
+{
+	if(argc != 6)
+	{
+		fprintf(stderr, "usage: bmp2gba -g <input.bmp> <name> <output.c> <output.h>\n");
+		return 1;
+	}
+
+	const char* input = argv[2];
+	const char* name = argv[3];
+	struct image image = load_bmp(input);
+
+	if((image.width % (GLYPH_SIZE * GLYPH_COLUMNS)) || (image.height % GLYPH_SIZE)) { fail(input, "not a sheet of 16x16 glyphs, 20 per row"); }
+
+	uint32_t cells = (image.width / GLYPH_SIZE) * (image.height / GLYPH_SIZE);
+	uint32_t per_row = image.width / GLYPH_SIZE;
+	uint8_t map[GLYPH_INDICES];
+	uint16_t (*atlas)[GLYPH_SIZE] = calloc(GLYPH_INDICES, sizeof(*atlas));
+	uint32_t count = 0;
+	uint32_t reachable = 0;
+
+	for(uint32_t index = 0; index < GLYPH_INDICES; index++)
+	{
+		uint16_t rows[GLYPH_SIZE] = { 0 };
+		int ink = 0;
+
+		map[index] = GLYPH_NONE;
+		if(index >= cells) { continue; }
+
+		for(int y = 0; y < GLYPH_SIZE; y++)
+		{
+			for(int x = 0; x < GLYPH_SIZE; x++)
+			{
+				uint16_t color = image.pixels[((((index / per_row) * GLYPH_SIZE) + y) * image.width) + ((index % per_row) * GLYPH_SIZE) + x];
+
+				if((color != 0x0000) && (color != 0x7FFF)) { fail(input, "glyphs must be black on white"); }
+				if(!color) { rows[y] |= 0x8000 >> x; ink = 1; }
+			}
+		}
+
+		//Index 0 is the blank the UI shows for an empty name character
+		if(!ink && index) { continue; }
+
+		uint32_t slot = 0;
+		while((slot < count) && memcmp(atlas[slot], rows, sizeof(rows))) { slot++; }
+
+		if(slot == count)
+		{
+			if(count == GLYPH_NONE) { fail(input, "too many glyphs for a byte index"); }
+			memcpy(atlas[count++], rows, sizeof(rows));
+		}
+
+		map[index] = slot;
+		reachable++;
+	}
+
+	char upper[256];
+	upper_case(upper, name, sizeof(upper));
+
+	uint32_t atlas_bytes = count * GLYPH_SIZE * sizeof(uint16_t);
+
+	FILE* header = create(argv[5]);
+	fprintf(header, "/*\n  Generated by bmp2gba from %s, do not edit.\n*/\n\n", file_name(input));
+	fprintf(header, "#ifndef _%s_h_\n#define _%s_h_\n\n", name, name);
+	fprintf(header, "#include <gba_types.h>\n\n");
+	fprintf(header, "#ifndef ASSET_FORMAT_GLYPH1\n#define ASSET_FORMAT_GLYPH1 5\n#endif\n\n");
+	fprintf(header, "#define %s_FORMAT ASSET_FORMAT_GLYPH1\n", upper);
+	fprintf(header, "#define %s_GLYPHS %u\n", upper, count);
+	fprintf(header, "#define %s_NONE 0x%02X\n", upper, GLYPH_NONE);
+	fprintf(header, "#define %s_SIZE %u\n\n", upper, atlas_bytes + GLYPH_INDICES);
+	fprintf(header, "//Byte index to atlas slot, %s_NONE where the sheet has no glyph\n", upper);
+	fprintf(header, "extern const u8 %s_map[%d];\n\n", name, GLYPH_INDICES);
+	fprintf(header, "//16 rows of 16 pixels, bit 15 leftmost, set bits are ink\n");
+	fprintf(header, "extern const u16 %s_glyphs[%s_GLYPHS][%d];\n\n", name, upper, GLYPH_SIZE);
+	fprintf(header, "#endif //_%s_h_\n", name);
+	fclose(header);
+
+	FILE* source = create(argv[4]);
+	fprintf(source, "/*\n  Generated by bmp2gba from %s, do not edit.\n*/\n\n", file_name(input));
+	fprintf(source, "#include \"%s\"\n\n", file_name(argv[5]));
+	fprintf(source, "const u8 %s_map[%d] =\n{", name, GLYPH_INDICES);
+
+	for(uint32_t x = 0; x < GLYPH_INDICES; x++)
+	{
+		if((x % 16) == 0) { fprintf(source, "\n\t"); }
+		fprintf(source, "0x%02X,%s", map[x], ((x % 16) == 15) ? "" : " ");
+	}
+
+	fprintf(source, "\n};\n\n");
+	fprintf(source, "const u16 %s_glyphs[%s_GLYPHS][%d] __attribute__((aligned(4))) =\n{", name, upper, GLYPH_SIZE);
+
+	for(uint32_t g = 0; g < count; g++)
+	{
+		fprintf(source, "\n\t{");
+		write_u16s(source, atlas[g], GLYPH_SIZE, "\t\t");
+		fprintf(source, "\n\t},");
+	}
+
+	fprintf(source, "\n};\n");
+	fclose(source);
+
+	uint32_t sheet_bytes = image.width * image.height * sizeof(uint16_t);
+
+	printf("%s: %u of %d indices have a glyph, %u unique\n", name, reachable, GLYPH_INDICES, count);
+	printf("%s: ROM %u bytes (%u atlas + %d map) vs %u as a sheet, saves %u (%.1f%%)\n",
+		name, atlas_bytes + GLYPH_INDICES, atlas_bytes, GLYPH_INDICES, sheet_bytes, sheet_bytes - (atlas_bytes + GLYPH_INDICES),
+		(100.0 * (sheet_bytes - (atlas_bytes + GLYPH_INDICES))) / sheet_bytes);
+	printf("%s: lookup is one byte load from the map; a glyph is 16 halfword loads instead of a 256 pixel copy out of the sheet\n", name);
+
+	free(atlas);
+	free(image.pixels);
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	if((argc > 1) && !strcmp(argv[1], "-t")) { return tile_main(argc, argv); }
+	if((argc > 1) && !strcmp(argv[1], "-g")) { return glyph_main(argc, argv); }
+
+	if(argc != 5)
+	{
+		fprintf(stderr, "usage: bmp2gba <input.bmp> <name> <output.c> <output.h>\n");
+		return 1;
+	}
+
+	const char* input = argv[1];
+	const char* name = argv[2];
+	struct image image = load_bmp(input);
+
+	const char* base = file_name(input);
+	const char* header_path = file_name(argv[4]);
+
+	char upper[256];
+	upper_case(upper, name, sizeof(upper));
+
+	uint32_t count = image.width * image.height;
+
+	FILE* header = create(argv[4]);
+	fprintf(header, "/*\n  Generated by bmp2gba from %s, do not edit.\n*/\n\n", base);
+	fprintf(header, "#ifndef _%s_h_\n#define _%s_h_\n\n", name, name);
+	fprintf(header, "#include <gba_types.h>\n\n");
+	fprintf(header, "#ifndef ASSET_FORMAT_RAW16\n#define ASSET_FORMAT_RAW16 0\n#endif\n\n");
+	fprintf(header, "#define %s_WIDTH %d\n", upper, image.width);
+	fprintf(header, "#define %s_HEIGHT %d\n", upper, image.height);
+	fprintf(header, "#define %s_FORMAT ASSET_FORMAT_RAW16\n", upper);
+	fprintf(header, "#define %s_SIZE %u\n\n", upper, count * 2);
+	fprintf(header, "extern const u16 %s[%s_WIDTH * %s_HEIGHT];\n\n", name, upper, upper);
+	fprintf(header, "#endif //_%s_h_\n", name);
+	fclose(header);
+
+	FILE* source = create(argv[3]);
+	fprintf(source, "/*\n  Generated by bmp2gba from %s, do not edit.\n*/\n\n", base);
+	fprintf(source, "#include \"%s\"\n\n", header_path);
+	fprintf(source, "const u16 %s[%s_WIDTH * %s_HEIGHT] __attribute__((aligned(4))) =\n{", name, upper, upper);
+
+	write_u16s(source, image.pixels, count, "\t");
+	fprintf(source, "\n};\n");
+	fclose(source);
+
+	free(image.pixels);
+	return 0;
+}
@@ -0,0 +1,362 @@
+/*
+  mapreport - memory budget report from a GNU ld map file.
+
+  Usage: mapreport <output.map> [budget]...
+
+  Sums every input section in the map into the GBA memory it occupies,
+  by address: ROM (0x08000000), EWRAM (0x02000000) and IWRAM (0x03000000).
+  Sections copied to RAM at boot also count against the memory their load
+  image sits in. Prints the totals, the objects using each memory and the
+  largest symbols, whose sizes are the distance to the next symbol.
+
+  A budget is <memory>=<bytes> or <object>:<memory>=<bytes>, with memory
+  one of rom, ewram or iwram, for example iwram=28672 or
+  si.arm.o:iwram=4096. Exits with 1 if any budget is exceeded.
+
+  Without =<bytes> a budget is measured instead: the report gets a line
+  "suggest: <budget>=<bytes>" with SUGGEST_HEADROOM percent over what the
+  map uses, rounded up to 64 bytes. make budgets collects those.
+*/
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_OBJECTS 512
+#define MAX_SYMBOLS 8192
+#define NAME_SIZE   128
+#define TOP_SYMBOLS 12
+
+#define SUGGEST_HEADROOM 20
+
+enum
+{
+	MEM_ROM,
+	MEM_EWRAM,
+	MEM_IWRAM,
+	MEMS
+};
+
+static const char* mem_names[MEMS] = { "rom", "ewram", "iwram" };
+static const uint32_t mem_sizes[MEMS] = { 32 * 1024 * 1024, 256 * 1024, 32 * 1024 };
+
+struct object
+{
+	char name[NAME_SIZE];
+	uint32_t used[MEMS];
+};
+
+struct symbol
+{
+	char name[NAME_SIZE];
+	uint32_t address;
+	uint32_t size;
+	int object;
+};
+
+static struct object objects[MAX_OBJECTS];
+static int object_count = 0;
+
+static struct symbol symbols[MAX_SYMBOLS];
+static int symbol_count = 0;
+
+static uint32_t totals[MEMS];
+
+static int mem_of(uint32_t address)
+{
+	switch(address >> 24)
+	{
+		case 0x02: return MEM_EWRAM;
+		case 0x03: return MEM_IWRAM;
+		case 0x08: case 0x09: return MEM_ROM;
+	}
+
+	return -1;
+}
+
+//Archive members keep only the archive and member names, other paths only the file name
+static void object_name(char* dst, const char* path)
+{
+	const char* open = strchr(path, '(');
+	const char* start = path;
+
+	for(const char* c = path; *c && (!open || (c < open)); c++)
+	{
+		if(*c == '/') { start = c + 1; }
+	}
+
+	snprintf(dst, NAME_SIZE, "%.*s", NAME_SIZE - 1, start);
+
+	//libc.a(lib_a-vfprintf.o) -> libc.a(vfprintf.o)
+	char* member = strstr(dst, "(lib_a-");
+	if(member) { memmove(member + 1, member + 7, strlen(member + 7) + 1); }
+}
+
+static int find_object(const char* path)
+{
+	char name[NAME_SIZE];
+	object_name(name, path);
+
+	for(int x = 0; x < object_count; x++)
+	{
+		if(!strcmp(objects[x].name, name)) { return x; }
+	}
+
+	if(object_count == MAX_OBJECTS) { fprintf(stderr, "mapreport: too many objects\n"); exit(1); }
+
+	memset(&objects[object_count], 0, sizeof(struct object));
+	snprintf(objects[object_count].name, NAME_SIZE, "%s", name);
+	return object_count++;
+}
+
+static int is_blank(const char* line)
+{
+	while(*line && isspace((unsigned char)*line)) { line++; }
+	return !*line;
+}
+
+//Parses "0xADDR 0xSIZE rest" after a section name, returns the fields found
+static int section_fields(const char* text, uint32_t* address, uint32_t* size, char* rest)
+{
+	unsigned long a = 0;
+	unsigned long s = 0;
+	int used = 0;
+
+	rest[0] = 0;
+	if(sscanf(text, " 0x%lx 0x%lx %n", &a, &s, &used) < 2) { return 0; }
+
+	*address = a;
+	*size = s;
+	snprintf(rest, NAME_SIZE * 2, "%s", text + used);
+	rest[strcspn(rest, "\r\n")] = 0;
+	return 1;
+}
+
+static int compare_symbols(const void* a, const void* b)
+{
+	uint32_t sa = ((const struct symbol*)a)->size;
+	uint32_t sb = ((const struct symbol*)b)->size;
+	return (sa < sb) - (sa > sb);
+}
+
+static int compare_objects_mem;
+
+static int compare_objects(const void* a, const void* b)
+{
+	uint32_t ua = ((const struct object*)a)->used[compare_objects_mem];
+	uint32_t ub = ((const struct object*)b)->used[compare_objects_mem];
+	return (ua < ub) - (ua > ub);
+}
+
+int main(int argc, char** argv)
+{
+	if(argc < 2)
+	{
+		fprintf(stderr, "usage: mapreport <output.map> [budget]...\n");
+		return 1;
+	}
+
+	FILE* file = fopen(argv[1], "r");
+	if(!file) { fprintf(stderr, "mapreport: %s: cannot open\n", argv[1]); return 1; }
+
+	//Room to put a pending section name in front of a full line
+	char line[1024 + NAME_SIZE + 2];
+	char pending[NAME_SIZE + 2] = "";
+	char rest[NAME_SIZE * 2];
+	int in_map = 0;
+
+	//Current output section: where its load image lives if it is copied at boot
+	int load_mem = -1;
+
+	//Current input section, symbols inside it are sized against its end
+	int section_object = -1;
+	uint32_t section_end = 0;
+	int section_first_symbol = 0;
+
+	while(fgets(line, 1024, file))
+	{
+		if(!in_map)
+		{
+			in_map = !strncmp(line, "Linker script and memory map", 28);
+			continue;
+		}
+
+		//A long section name puts its address and size on the next line
+		if(pending[0])
+		{
+			size_t length = strlen(pending);
+			memmove(line + length + 1, line, strlen(line) + 1);
+			memcpy(line, pending, length);
+			line[length] = ' ';
+			pending[0] = 0;
+		}
+
+		uint32_t address = 0;
+		uint32_t size = 0;
+
+		//Output section: ".name 0xADDR 0xSIZE [load address 0xLMA]"
+		if(line[0] == '.')
+		{
+			char name[NAME_SIZE];
+			int used = 0;
+
+			if(sscanf(line, "%127s%n", name, &used) != 1) { continue; }
+			if(is_blank(line + used)) { snprintf(pending, sizeof(pending), "%s", name); continue; }
+
+			load_mem = -1;
+			section_object = -1;
+
+			if(section_fields(line + used, &address, &size, rest))
+			{
+				unsigned long lma = 0;
+				const char* load = strstr(rest, "load address");
+				if(load && (sscanf(load, "load address 0x%lx", &lma) == 1)) { load_mem = mem_of(lma); }
+			}
+
+			continue;
+		}
+
+		//Input section: " .name 0xADDR 0xSIZE object" (COMMON blocks look the same)
+		if((line[0] == ' ') && ((line[1] == '.') || !strncmp(line + 1, "COMMON", 6)))
+		{
+			char name[NAME_SIZE];
+			int used = 0;
+
+			if(sscanf(line, " %127s%n", name, &used) != 1) { continue; }
+			if(is_blank(line + used)) { snprintf(pending, sizeof(pending), " %s", name); continue; }
+
+			section_object = -1;
+			if(!section_fields(line + used, &address, &size, rest) || !size || !rest[0]) { continue; }
+
+			int mem = mem_of(address);
+			if(mem < 0) { continue; }
+
+			int object = find_object(rest);
+			objects[object].used[mem] += size;
+			totals[mem] += size;
+
+			//.data and .iwram also occupy their load image
+			if((load_mem >= 0) && (load_mem != mem))
+			{
+				objects[object].used[load_mem] += size;
+				totals[load_mem] += size;
+			}
+
+			section_object = object;
+			section_end = address + size;
+			section_first_symbol = symbol_count;
+			continue;
+		}
+
+		//Symbol: "                0xADDR                name", skipping assignments
+		if((section_object >= 0) && !strncmp(line, "                0x", 18))
+		{
+			unsigned long a = 0;
+			char name[NAME_SIZE];
+
+			if(sscanf(line, " 0x%lx %127s", &a, name) != 2) { continue; }
+			if(strchr(line, '=') || strchr(name, '(')) { continue; }
+			if(symbol_count == MAX_SYMBOLS) { continue; }
+
+			//The previous symbol in this section ends where this one starts
+			if(symbol_count > section_first_symbol) { symbols[symbol_count - 1].size = a - symbols[symbol_count - 1].address; }
+
+			struct symbol* symbol = &symbols[symbol_count++];
+			snprintf(symbol->name, NAME_SIZE, "%s", name);
+			symbol->address = a;
+			symbol->size = section_end - a;
+			symbol->object = section_object;
+			continue;
+		}
+	}
+
+	fclose(file);
+
+	if(!in_map) { fprintf(stderr, "mapreport: %s: not a GNU ld map\n", argv[1]); return 1; }
+
+	printf("memory: rom %u, ewram %u of %u, iwram %u of %u\n",
+		totals[MEM_ROM], totals[MEM_EWRAM], mem_sizes[MEM_EWRAM], totals[MEM_IWRAM], mem_sizes[MEM_IWRAM]);
+
+	//Symbols keep object indices, so sort a copy of the objects for printing
+	static struct object sorted[MAX_OBJECTS];
+	memcpy(sorted, objects, sizeof(struct object) * object_count);
+
+	for(int mem = 0; mem < MEMS; mem++)
+	{
+		if(!totals[mem]) { continue; }
+
+		compare_objects_mem = mem;
+		qsort(sorted, object_count, sizeof(struct object), compare_objects);
+
+		printf("\n%s by object:\n", mem_names[mem]);
+		for(int x = 0; (x < object_count) && sorted[x].used[mem]; x++) { printf("  %8u  %s\n", sorted[x].used[mem], sorted[x].name); }
+	}
+
+	qsort(symbols, symbol_count, sizeof(struct symbol), compare_symbols);
+
+	for(int mem = 0; mem < MEMS; mem++)
+	{
+		if(!totals[mem]) { continue; }
+
+		printf("\n%s largest symbols:\n", mem_names[mem]);
+
+		for(int x = 0, shown = 0; (x < symbol_count) && (shown < TOP_SYMBOLS); x++)
+		{
+			if(mem_of(symbols[x].address) != mem) { continue; }
+			printf("  %8u  %s (%s)\n", symbols[x].size, symbols[x].name, objects[symbols[x].object].name);
+			shown++;
+		}
+	}
+
+	//Budgets
+	int failed = 0;
+	if(argc > 2) { printf("\n"); }
+
+	for(int x = 2; x < argc; x++)
+	{
+		char target[NAME_SIZE] = "";
+		char mem_name[16] = "";
+		unsigned long limit = 0;
+		const char* spec = argv[x];
+		const char* colon = strchr(spec, ':');
+
+		if(colon)
+		{
+			snprintf(target, sizeof(target), "%.*s", (int)(colon - spec), spec);
+			spec = colon + 1;
+		}
+
+		int fields = sscanf(spec, "%15[a-z]=%lu", mem_name, &limit);
+		int suggest = (fields == 1) && !strchr(spec, '=');
+		if((fields != 2) && !suggest) { fprintf(stderr, "mapreport: bad budget %s\n", argv[x]); return 1; }
+
+		int mem = 0;
+		while((mem < MEMS) && strcmp(mem_names[mem], mem_name)) { mem++; }
+		if(mem == MEMS) { fprintf(stderr, "mapreport: unknown memory in %s\n", argv[x]); return 1; }
+
+		uint32_t used = totals[mem];
+
+		if(target[0])
+		{
+			used = 0;
+			for(int o = 0; o < object_count; o++)
+			{
+				if(!strcmp(objects[o].name, target)) { used = objects[o].used[mem]; }
+			}
+		}
+
+		if(suggest)
+		{
+			printf("suggest: %s=%u\n", argv[x], ((used * (100 + SUGGEST_HEADROOM) / 100) + 63) & ~63u);
+			continue;
+		}
+
+		int over = (used > limit);
+		printf("budget: %s %u of %lu%s\n", argv[x], used, limit, over ? ", EXCEEDED" : "");
+		failed |= over;
+	}
+
+	return failed;
+}
@@ -0,0 +1,160 @@
+/*
+  trace2json - turns a saved trace ring into a Chrome trace.
+
+  Usage: trace2json <dump> [output.json]
+
+  The dump is a save file from a TRACE=1 build, or any memory dump that
+  holds the ring from source/trace.h; the first block starting with
+  TRACE_MAGIC is used. The JSON (stdout without an output name) opens in
+  chrome://tracing or ui.perfetto.dev, one row each for the state machine,
+  drawing and Joybus.
+
+  Each event carries PROFILE_TIMER (cycles, wraps every 65536), VCOUNT and
+  frame_count. The frame and line give a coarse time good to one line,
+  the timer then places the event to the cycle within it. A send session
+  has IRQs off and counts its frames itself, which can be a command later
+  than the start of VBlank, so a frame is also counted whenever the line
+  goes backwards (assuming events less than a frame apart), and the
+  late frame_count tick then only adds what was not counted that way.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TRACE_HOST
+#include "../source/trace.h"
+
+#define CYCLES_PER_LINE  1232
+#define LINES_PER_FRAME  228
+#define VBLANK_LINE      160
+#define CYCLES_PER_US    16.777216
+
+#define EVENT_SIZE  8
+#define HEADER_SIZE 8
+#define RING_SIZE   (HEADER_SIZE + (TRACE_EVENTS * EVENT_SIZE))
+
+#define TRACE_NAME(id, name, row) name,
+#define TRACE_ROW(id, name, row) row,
+static const char* event_names[TRACE_IDS] = { TRACE_EVENT_LIST(TRACE_NAME) };
+static const int event_rows[TRACE_IDS] = { TRACE_EVENT_LIST(TRACE_ROW) };
+
+static const char* row_names[] = { "states", "drawing", "joybus" };
+
+static uint32_t read_u32(const uint8_t* p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t* p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+int main(int argc, char** argv)
+{
+	if((argc != 2) && (argc != 3))
+	{
+		fprintf(stderr, "usage: trace2json <dump> [output.json]\n");
+		return 1;
+	}
+
+	FILE* file = fopen(argv[1], "rb");
+	if(!file) { fprintf(stderr, "trace2json: %s: cannot open\n", argv[1]); return 1; }
+
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	uint8_t* dump = malloc(size > 0 ? size : 1);
+	if(!dump || (fread(dump, 1, size, file) != (size_t)size)) { fprintf(stderr, "trace2json: %s: cannot read\n", argv[1]); return 1; }
+	fclose(file);
+
+	//The ring is word aligned wherever it sits
+	const uint8_t* ring = NULL;
+
+	for(long x = 0; (x + RING_SIZE) <= size; x += 4)
+	{
+		if(read_u32(dump + x) == TRACE_MAGIC) { ring = dump + x; break; }
+	}
+
+	if(!ring) { fprintf(stderr, "trace2json: %s: no trace ring found\n", argv[1]); return 1; }
+
+	FILE* out = stdout;
+	if((argc == 3) && !(out = fopen(argv[2], "w"))) { fprintf(stderr, "trace2json: %s: cannot create\n", argv[2]); return 1; }
+
+	//Oldest event first, the ring only holds the last TRACE_EVENTS
+	uint32_t next = read_u32(ring + 4);
+	uint32_t count = (next < TRACE_EVENTS) ? next : TRACE_EVENTS;
+	uint32_t first = next - count;
+
+	fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+	for(int row = 0; row < (int)(sizeof(row_names) / sizeof(row_names[0])); row++)
+	{
+		fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", row ? ",\n" : "", row, row_names[row]);
+	}
+
+	int64_t frames = 0;
+	int64_t offset = 0;
+	uint16_t last_frame = 0;
+	int last_line = 0;
+	int wraps = 0;
+
+	for(uint32_t x = 0; x < count; x++)
+	{
+		const uint8_t* event = ring + HEADER_SIZE + (((first + x) & (TRACE_EVENTS - 1)) * EVENT_SIZE);
+
+		uint8_t id = event[0];
+		uint16_t time = read_u16(event + 2);
+		uint16_t frame = read_u16(event + 4);
+		uint16_t arg = read_u16(event + 6);
+
+		//frame_count ticks at the start of VBlank, so lines are counted from there too
+		int line = (event[1] + LINES_PER_FRAME - VBLANK_LINE) % LINES_PER_FRAME;
+
+		if(x && (frame != last_frame))
+		{
+			int ticks = (uint16_t)(frame - last_frame);
+			frames += (ticks > wraps) ? (ticks - wraps) : 0;
+			wraps = 0;
+		}
+
+		else if(x && (line < last_line))
+		{
+			frames++;
+			wraps++;
+		}
+
+		last_frame = frame;
+		last_line = line;
+
+		int64_t coarse = (((frames * LINES_PER_FRAME) + line) * CYCLES_PER_LINE);
+
+		//The timer and the LCD run off the same clock, so the timer is a fixed distance from the coarse time
+		if(!x) { offset = coarse - time; }
+
+		int64_t cycles = time + offset;
+		int64_t wrap = (coarse - cycles + 32768) >> 16;
+		cycles += wrap << 16;
+
+		const char* phase = "i";
+		if((id & ~TRACE_ID_MASK) == TRACE_BEGIN_PHASE) { phase = "B"; }
+		if((id & ~TRACE_ID_MASK) == TRACE_END_PHASE) { phase = "E"; }
+
+		uint8_t index = id & TRACE_ID_MASK;
+		const char* name = (index < TRACE_IDS) ? event_names[index] : "unknown";
+		int row = (index < TRACE_IDS) ? event_rows[index] : 0;
+
+		fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"%s\",%s\"ts\":%.3f,\"pid\":0,\"tid\":%d,\"args\":{\"arg\":%u,\"frame\":%u,\"line\":%u}}",
+			name, phase, (phase[0] == 'i') ? "\"s\":\"t\"," : "", cycles / CYCLES_PER_US, row, arg, frame, event[1]);
+	}
+
+	fprintf(out, "\n]}\n");
+
+	if(out != stdout) { fclose(out); }
+	free(dump);
+
+	fprintf(stderr, "trace2json: %u events, %u dropped\n", count, next - count);
+	return 0;
+}